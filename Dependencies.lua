@@ -10,6 +10,7 @@ IncludeDir["bullet"] = "%{wks.location}/EppoEngine/Vendor/bullet/include"
 IncludeDir["entt"] = "%{wks.location}/EppoEngine/Vendor/entt/single_include"
 IncludeDir["filewatch"] = "%{wks.location}/EppoEngine/Vendor/filewatch"
 IncludeDir["glfw"] = "%{wks.location}/EppoEngine/Vendor/glfw/include"
+IncludeDir["googlebenchmark"] = "%{wks.location}/EppoEngine/Vendor/googlebenchmark/benchmark/include"
 IncludeDir["glm"] = "%{wks.location}/EppoEngine/Vendor/glm"
 IncludeDir["googlemock"] = "%{wks.location}/EppoEngine/Vendor/googletest/googlemock/include"
 IncludeDir["googletest"] = "%{wks.location}/EppoEngine/Vendor/googletest/googletest/include"
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <EppoEngine.h>
+
+namespace Eppo
+{
+	// Keeps assets in memory only, the benchmark has no project or asset registry on disk
+	class BenchmarkAssetManager : public AssetManagerBase
+	{
+	public:
+		bool CreateAsset(const Ref<Asset> asset, const std::filesystem::path& filepath) override
+		{
+			if (IsAssetHandleValid(asset->Handle))
+				return false;
+
+			m_Assets[asset->Handle] = asset;
+			return true;
+		}
+
+		Ref<Asset> GetAsset(const AssetHandle handle) override
+		{
+			if (const auto it = m_Assets.find(handle);
+				it != m_Assets.end())
+				return it->second;
+
+			return nullptr;
+		}
+
+		[[nodiscard]] bool IsAssetHandleValid(const AssetHandle handle) const override { return m_Assets.find(handle) != m_Assets.end(); }
+		[[nodiscard]] bool IsAssetLoaded(const AssetHandle handle) const override { return IsAssetHandleValid(handle); }
+
+		// Meshes are the only assets the benchmark creates
+		[[nodiscard]] AssetType GetAssetType(const AssetHandle handle) const override { return IsAssetHandleValid(handle) ? AssetType::Mesh : AssetType::None; }
+
+	private:
+		std::unordered_map<AssetHandle, Ref<Asset>> m_Assets;
+	};
+}
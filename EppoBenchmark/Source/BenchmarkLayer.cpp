@@ -0,0 +1,202 @@
+#include "BenchmarkLayer.h"
+
+#include "BenchmarkAssetManager.h"
+
+namespace Eppo
+{
+	namespace Utils
+	{
+		static void WriteStatistics(std::stringstream& ss, const TimingStatistics& stats)
+		{
+			ss << "{ \"samples\": " << stats.SampleCount;
+			ss << ", \"min\": " << stats.Min << ", \"avg\": " << stats.Average << ", \"p95\": " << stats.P95 << ", \"p99\": " << stats.P99 << ", \"max\": " << stats.Max << " }";
+		}
+	}
+
+	// Reported name --> profile scope
+	static const std::vector<std::pair<std::string, std::string>> s_CPUPhases =
+	{
+		{ "RenderScene", "Scene::RenderScene" },
+		{ "PrepareBuffers", "VulkanSceneRenderer::PrepareBuffers" },
+		{ "UpdateDescriptors", "VulkanSceneRenderer::UpdateDescriptors" },
+		{ "CommandRecording", "VulkanRenderer::ExecuteRenderCommands" },
+		{ "PreDepthPass", "VulkanSceneRenderer::PreDepthPass" },
+		{ "GeometryPass", "VulkanSceneRenderer::GeometryPass" },
+		{ "SkyboxPass", "VulkanSceneRenderer::SkyboxPass" },
+		{ "CompositePass", "VulkanSceneRenderer::CompositePass" },
+		{ "Present", "VulkanSwapchain::PresentFrame" }
+	};
+
+	BenchmarkLayer::BenchmarkLayer(BenchmarkSpecification specification)
+		: Layer("BenchmarkLayer"), m_Specification(std::move(specification))
+	{}
+
+	void BenchmarkLayer::OnAttach()
+	{
+		// Meshes live in an in-memory asset manager
+		const Ref<Project> project = Project::New();
+		project->SetAssetManager(CreateRef<BenchmarkAssetManager>());
+
+		std::vector<AssetHandle> meshHandles;
+
+		if (m_Specification.MeshFilepaths.empty())
+			EPPO_WARN("No meshes specified, the scene will only contain transforms and lights!");
+		else
+		{
+			const auto start = std::chrono::steady_clock::now();
+
+			// Every unique mesh gets its own GPU buffers, even when loaded from the same file
+			for (uint32_t i = 0; i < m_Specification.Scene.UniqueMeshes; i++)
+			{
+				const auto& filepath = m_Specification.MeshFilepaths[i % m_Specification.MeshFilepaths.size()];
+
+				if (m_Specification.Recook)
+				{
+					const MappedFile source(filepath);
+					DerivedDataCache::Remove(MeshCooker::GetCacheKey(source.GetData(), source.GetSize(), m_Specification.MeshVertexFormat), MeshCooker::MeshExtension);
+				}
+
+				Ref<Mesh> mesh = CreateRef<Mesh>(filepath, m_Specification.MeshVertexFormat);
+				if (!mesh->IsValid())
+					continue;
+
+				AssetManager::CreateAsset(mesh, filepath);
+				meshHandles.emplace_back(mesh->Handle);
+			}
+
+			m_MeshLoadTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+			EPPO_INFO("Loaded {} meshes in {:.2f} ms with {} worker threads", meshHandles.size(), m_MeshLoadTime, ThreadPool::Get().GetThreadCount());
+		}
+
+		if (m_Specification.Scene.PointLights > 8)
+		{
+			EPPO_WARN("The renderer supports up to 8 point lights, clamping {} point lights", m_Specification.Scene.PointLights);
+			m_Specification.Scene.PointLights = 8;
+		}
+
+		m_StressScene = CreateScope<StressScene>(m_Specification.Scene, meshHandles);
+
+		RenderSpecification renderSpec;
+		renderSpec.Width = m_Specification.Width;
+		renderSpec.Height = m_Specification.Height;
+
+		m_SceneRenderer = SceneRenderer::Create(m_StressScene->GetScene(), renderSpec);
+
+		m_Camera = EditorCamera(glm::vec3(0.0f, 0.0f, m_Specification.Scene.Extent * 2.0f));
+		m_Camera.SetViewportSize(glm::vec2(m_Specification.Width, m_Specification.Height));
+
+		EPPO_INFO("Running benchmark: {} mesh entities, {} unique meshes, {} point lights, {} warmup frames, {} frames",
+			m_Specification.Scene.MeshEntities, meshHandles.size(), m_Specification.Scene.PointLights, m_Specification.WarmupFrames, m_Specification.Frames);
+	}
+
+	void BenchmarkLayer::OnDetach()
+	{
+		m_SceneRenderer = nullptr;
+		m_StressScene = nullptr;
+
+		Project::SetActive(nullptr);
+	}
+
+	void BenchmarkLayer::Update(float timestep)
+	{
+		if (m_FrameCount == m_Specification.WarmupFrames)
+		{
+			#if defined(EPPO_ENABLE_PROFILER)
+			CPUProfiler::BeginCapture(m_Specification.Frames, "");
+			#else
+			EPPO_WARN("The built-in profiler is not available in this configuration, only GPU timings will be reported!");
+			#endif
+
+			m_SceneRenderer->GetGPUProfiler().Clear();
+			m_Measuring = true;
+		}
+
+		if (m_Measuring)
+		{
+			// The capture starts and stops on frame boundaries
+			#if defined(EPPO_ENABLE_PROFILER)
+			const bool finished = !CPUProfiler::IsCapturing() && !CPUProfiler::IsCapturePending();
+			#else
+			const bool finished = m_FrameCount >= m_Specification.WarmupFrames + m_Specification.Frames;
+			#endif
+
+			if (!finished)
+				return;
+
+			m_Measuring = false;
+
+			WriteResults();
+			Application::Get().Close();
+		}
+
+		m_StressScene->Update();
+		m_FrameCount++;
+	}
+
+	void BenchmarkLayer::Render()
+	{
+		m_StressScene->GetScene()->OnRenderEditor(m_SceneRenderer, m_Camera);
+	}
+
+	void BenchmarkLayer::WriteResults() const
+	{
+		const StressSceneSpecification& sceneSpec = m_StressScene->GetSpecification();
+
+		std::stringstream ss;
+		ss << "{\n";
+
+		// Configuration
+		ss << "\t\"scene\": { \"meshEntities\": " << sceneSpec.MeshEntities << ", \"pointLights\": " << sceneSpec.PointLights;
+		ss << ", \"uniqueMeshes\": " << sceneSpec.UniqueMeshes << ", \"transformChurn\": " << sceneSpec.TransformChurn << ", \"seed\": " << sceneSpec.Seed << " },\n";
+		ss << "\t\"width\": " << m_Specification.Width << ",\n";
+		ss << "\t\"height\": " << m_Specification.Height << ",\n";
+		ss << "\t\"frames\": " << m_Specification.Frames << ",\n";
+		ss << "\t\"vertexStride\": " << VertexPacking::GetLayout(m_Specification.MeshVertexFormat).GetStride() << ",\n";
+		ss << "\t\"workerThreads\": " << ThreadPool::Get().GetThreadCount() << ",\n";
+		ss << "\t\"meshLoadMs\": " << m_MeshLoadTime << ",\n";
+
+		// CPU time per phase in ms
+		ss << "\t\"cpu\": {";
+
+		#if defined(EPPO_ENABLE_PROFILER)
+		const std::vector<ProfileEvent> events = CPUProfiler::GetCapturedEvents();
+
+		for (size_t i = 0; i < s_CPUPhases.size(); i++)
+		{
+			const auto& [phase, scope] = s_CPUPhases[i];
+
+			std::vector<float> samples;
+			for (const auto& event : events)
+			{
+				if (scope == event.Name)
+					samples.emplace_back(static_cast<float>(event.End - event.Begin) * 0.000001f);
+			}
+
+			ss << (i == 0 ? "\n" : ",\n");
+			ss << "\t\t\"" << phase << "\": ";
+			Utils::WriteStatistics(ss, GPUProfiler::CalculateStatistics(std::move(samples)));
+		}
+		#endif
+
+		ss << "\n\t},\n";
+
+		// GPU time per pass in ms
+		const GPUProfiler& gpuProfiler = m_SceneRenderer->GetGPUProfiler();
+		const auto& passes = gpuProfiler.GetTimingNames();
+
+		ss << "\t\"gpu\": {";
+
+		for (size_t i = 0; i < passes.size(); i++)
+		{
+			ss << (i == 0 ? "\n" : ",\n");
+			ss << "\t\t\"" << passes[i] << "\": ";
+			Utils::WriteStatistics(ss, gpuProfiler.GetStatistics(passes[i]));
+		}
+
+		ss << "\n\t}\n";
+		ss << "}\n";
+
+		Filesystem::WriteText(m_Specification.OutputFilepath, ss.str());
+		EPPO_INFO("Wrote benchmark results to {}", m_Specification.OutputFilepath.string());
+	}
+}
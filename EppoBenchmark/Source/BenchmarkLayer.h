@@ -0,0 +1,56 @@
+#pragma once
+
+#include "StressScene.h"
+
+#include <EppoEngine.h>
+
+namespace Eppo
+{
+	struct BenchmarkSpecification
+	{
+		StressSceneSpecification Scene;
+		std::vector<std::filesystem::path> MeshFilepaths;
+		VertexFormat MeshVertexFormat = VertexFormat::Standard;
+		// Removes cooked meshes before loading so every mesh is imported from its source
+		bool Recook = false;
+
+		// Workers of the engine thread pool, zero picks one per hardware thread
+		uint32_t WorkerThreads = 0;
+
+		uint32_t WarmupFrames = 60;
+		uint32_t Frames = 300;
+
+		uint32_t Width = 1600;
+		uint32_t Height = 900;
+
+		std::filesystem::path OutputFilepath = "BenchmarkResults.json";
+	};
+
+	class BenchmarkLayer : public Layer
+	{
+	public:
+		explicit BenchmarkLayer(BenchmarkSpecification specification);
+		~BenchmarkLayer() override = default;
+
+		void OnAttach() override;
+		void OnDetach() override;
+
+		void Update(float timestep) override;
+		void Render() override;
+
+	private:
+		void WriteResults() const;
+
+	private:
+		BenchmarkSpecification m_Specification;
+
+		Scope<StressScene> m_StressScene;
+		Ref<SceneRenderer> m_SceneRenderer;
+		EditorCamera m_Camera;
+
+		float m_MeshLoadTime = 0.0f;
+
+		uint32_t m_FrameCount = 0;
+		bool m_Measuring = false;
+	};
+}
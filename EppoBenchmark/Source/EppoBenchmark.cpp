@@ -0,0 +1,119 @@
+#include <EppoEngine.h>
+#include <Core/Entrypoint.h>
+
+#include "BenchmarkLayer.h"
+
+#include <charconv>
+
+#if defined(EPPO_PLATFORM_WINDOWS)
+extern "C" {
+	_declspec(dllexport) DWORD AmdPowerXpressRequestHighPerformance = 0x00000001;
+	_declspec(dllexport) DWORD NvOptimusEnablement = 0x00000001;
+}
+#endif
+
+namespace Eppo
+{
+	namespace Utils
+	{
+		// Parses the whole value as a number, leaves the result untouched and reports a usage error otherwise
+		template<typename T>
+		static void ParseNumber(const std::string_view name, const std::string_view value, T& result)
+		{
+			T parsed{};
+			const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), parsed);
+			if (error != std::errc() || end != value.data() + value.size())
+			{
+				EPPO_ERROR("Invalid value '{}' for --{}, expected a number. Using the default of {}", value, name, result);
+				return;
+			}
+
+			result = parsed;
+		}
+
+		// Parses arguments in the form of --name=value
+		static BenchmarkSpecification ParseCommandLineArgs(const ApplicationCommandLineArgs& args)
+		{
+			BenchmarkSpecification spec;
+
+			for (int i = 1; i < args.Count; i++)
+			{
+				const std::string_view arg = args[i];
+				const size_t separator = arg.find('=');
+				if (arg.substr(0, 2) != "--" || separator == std::string_view::npos)
+				{
+					EPPO_WARN("Ignoring argument '{}'", arg);
+					continue;
+				}
+
+				const std::string_view name = arg.substr(2, separator - 2);
+				const std::string value(arg.substr(separator + 1));
+
+				if (name == "meshes")
+					ParseNumber(name, value, spec.Scene.MeshEntities);
+				else if (name == "lights")
+					ParseNumber(name, value, spec.Scene.PointLights);
+				else if (name == "unique-meshes")
+					ParseNumber(name, value, spec.Scene.UniqueMeshes);
+				else if (name == "churn")
+					ParseNumber(name, value, spec.Scene.TransformChurn);
+				else if (name == "extent")
+					ParseNumber(name, value, spec.Scene.Extent);
+				else if (name == "seed")
+					ParseNumber(name, value, spec.Scene.Seed);
+				else if (name == "mesh")
+					spec.MeshFilepaths.emplace_back(value);
+				else if (name == "vertex-format" && value == "standard")
+					spec.MeshVertexFormat = VertexFormat::Standard;
+				else if (name == "vertex-format" && value == "packed")
+					spec.MeshVertexFormat = VertexFormat::Packed;
+				else if (name == "vertex-format" && value == "quantized")
+					spec.MeshVertexFormat = VertexFormat::PackedQuantized;
+				else if (name == "recook")
+					spec.Recook = value != "0";
+				else if (name == "worker-threads")
+					ParseNumber(name, value, spec.WorkerThreads);
+				else if (name == "warmup")
+					ParseNumber(name, value, spec.WarmupFrames);
+				else if (name == "frames")
+					ParseNumber(name, value, spec.Frames);
+				else if (name == "width")
+					ParseNumber(name, value, spec.Width);
+				else if (name == "height")
+					ParseNumber(name, value, spec.Height);
+				else if (name == "output")
+					spec.OutputFilepath = value;
+				else
+					EPPO_WARN("Unknown argument '{}'", arg);
+			}
+
+			return spec;
+		}
+	}
+
+	class Benchmark : public Application
+	{
+	public:
+		Benchmark(const ApplicationSpecification& specification, const BenchmarkSpecification& benchmarkSpecification)
+			: Application(specification)
+		{
+			PushLayer(new BenchmarkLayer(benchmarkSpecification));
+		}
+
+		~Benchmark() = default;
+	};
+
+	Application* CreateApplication(const ApplicationCommandLineArgs args)
+	{
+		const BenchmarkSpecification benchmarkSpec = Utils::ParseCommandLineArgs(args);
+
+		ApplicationSpecification spec;
+		spec.Name = "EppoBenchmark";
+		spec.WindowWidth = benchmarkSpec.Width;
+		spec.WindowHeight = benchmarkSpec.Height;
+		spec.WindowVisible = false;
+		spec.WorkerThreads = benchmarkSpec.WorkerThreads;
+
+		return new Benchmark(spec, benchmarkSpec);
+	}
+}
@@ -0,0 +1,65 @@
+#include "StressScene.h"
+
+#include <glm/gtc/constants.hpp>
+
+namespace Eppo
+{
+	StressScene::StressScene(const StressSceneSpecification& specification, const std::vector<AssetHandle>& meshHandles)
+		: m_Specification(specification), m_Engine(specification.Seed)
+	{
+		EPPO_PROFILE_FUNCTION("StressScene::StressScene");
+
+		m_Scene = CreateRef<Scene>();
+		m_MeshEntities.reserve(m_Specification.MeshEntities);
+
+		std::uniform_real_distribution rotationDistribution(0.0f, glm::two_pi<float>());
+
+		for (uint32_t i = 0; i < m_Specification.MeshEntities; i++)
+		{
+			Entity entity = m_Scene->CreateEntity("Mesh " + std::to_string(i));
+
+			auto& transform = entity.GetComponent<TransformComponent>();
+			transform.Translation = GenerateTranslation();
+			transform.Rotation = glm::vec3(0.0f, rotationDistribution(m_Engine), 0.0f);
+
+			if (!meshHandles.empty())
+				entity.AddComponent<MeshComponent>().MeshHandle = meshHandles[i % meshHandles.size()];
+
+			m_MeshEntities.emplace_back(entity);
+		}
+
+		std::uniform_real_distribution colorDistribution(0.2f, 1.0f);
+
+		for (uint32_t i = 0; i < m_Specification.PointLights; i++)
+		{
+			Entity entity = m_Scene->CreateEntity("Point Light " + std::to_string(i));
+			entity.GetComponent<TransformComponent>().Translation = GenerateTranslation();
+			entity.AddComponent<PointLightComponent>().Color = glm::vec4(colorDistribution(m_Engine), colorDistribution(m_Engine), colorDistribution(m_Engine), 1.0f);
+		}
+	}
+
+	void StressScene::Update()
+	{
+		EPPO_PROFILE_FUNCTION("StressScene::Update");
+
+		if (m_MeshEntities.empty())
+			return;
+
+		// Move a sliding window of entities so every entity gets churned over time
+		const auto count = static_cast<uint32_t>(static_cast<float>(m_MeshEntities.size()) * m_Specification.TransformChurn);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			Entity& entity = m_MeshEntities[(m_ChurnOffset + i) % m_MeshEntities.size()];
+			entity.GetComponent<TransformComponent>().Translation = GenerateTranslation();
+		}
+
+		m_ChurnOffset = (m_ChurnOffset + count) % static_cast<uint32_t>(m_MeshEntities.size());
+	}
+
+	glm::vec3 StressScene::GenerateTranslation()
+	{
+		std::uniform_real_distribution distribution(-m_Specification.Extent, m_Specification.Extent);
+		return { distribution(m_Engine), distribution(m_Engine), distribution(m_Engine) };
+	}
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <EppoEngine.h>
+
+namespace Eppo
+{
+	struct StressSceneSpecification
+	{
+		uint32_t MeshEntities = 1000;
+		uint32_t PointLights = 8;
+		uint32_t UniqueMeshes = 4;
+
+		// Fraction of the mesh entities that get a new transform every frame
+		float TransformChurn = 0.1f;
+
+		// Half extent of the cube the entities are scattered in
+		float Extent = 50.0f;
+
+		uint32_t Seed = 1;
+	};
+
+	// Generates a deterministic scene for the given specification
+	class StressScene
+	{
+	public:
+		StressScene(const StressSceneSpecification& specification, const std::vector<AssetHandle>& meshHandles);
+
+		void Update();
+
+		[[nodiscard]] Ref<Scene> GetScene() const { return m_Scene; }
+		[[nodiscard]] const StressSceneSpecification& GetSpecification() const { return m_Specification; }
+
+	private:
+		glm::vec3 GenerateTranslation();
+
+	private:
+		StressSceneSpecification m_Specification;
+		Ref<Scene> m_Scene;
+
+		std::vector<Entity> m_MeshEntities;
+		uint32_t m_ChurnOffset = 0;
+
+		std::mt19937 m_Engine;
+	};
+}
@@ -16,9 +16,28 @@ layout(location = 0) in vec2 iUV;
 
 layout(binding = 0) uniform sampler2D texComposite;
 
+layout(push_constant) uniform Composite
+{
+	layout(offset = 0) vec2 RenderScale;
+	layout(offset = 8) float Sharpness;
+} uComposite;
+
 layout(location = 0) out vec4 oFragColor;
 
 void main()
 {
-	oFragColor = texture(texComposite, iUV);
+	// Only the top left part of the source image contains the scaled render
+	vec2 texelSize = 1.0f / vec2(textureSize(texComposite, 0));
+	vec2 maxUV = uComposite.RenderScale - 0.5f * texelSize;
+	vec2 uv = min(iUV * uComposite.RenderScale, maxUV);
+
+	vec4 color = texture(texComposite, uv);
+
+	// Light sharpening to counter the blur of the bilinear upscale
+	vec4 neighbours = texture(texComposite, min(uv + vec2(texelSize.x, 0.0f), maxUV));
+	neighbours += texture(texComposite, max(uv - vec2(texelSize.x, 0.0f), 0.5f * texelSize));
+	neighbours += texture(texComposite, min(uv + vec2(0.0f, texelSize.y), maxUV));
+	neighbours += texture(texComposite, max(uv - vec2(0.0f, texelSize.y), 0.5f * texelSize));
+
+	oFragColor = clamp(color + uComposite.Sharpness * (color - neighbours * 0.25f), 0.0f, 1.0f);
 }
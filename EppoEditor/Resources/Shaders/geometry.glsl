@@ -2,6 +2,7 @@
 #version 450
 
 #include "Includes/base.glsl"
+#include "Includes/packing.glsl"
 
 layout(location = 0) in vec3 inPosition;
 layout(location = 1) in vec3 inNormal;
@@ -18,15 +19,21 @@ layout(push_constant) uniform Transform
 	layout(offset = 80) int DiffuseMapIndex;
     layout(offset = 84) int NormalMapIndex;
     layout(offset = 88) int RoughnessMetallicMapIndex;
+    layout(offset = 92) int PackedNormals;
+    layout(offset = 96) vec4 PositionOffset;
+    layout(offset = 112) vec4 PositionScale;
 } uTransform;
 
 void main()
 {
-	outNormal = inNormal;
+	// Quantized positions are unorm within the submesh bounds, the offset and scale are identity otherwise
+	vec3 position = uTransform.PositionOffset.xyz + inPosition * uTransform.PositionScale.xyz;
+
+	outNormal = uTransform.PackedNormals != 0 ? DecodeOctahedral(inNormal.xy) : inNormal;
     outTexCoord = inTexCoord;
-    outFragPos = vec3(uTransform.Transform * vec4(inPosition, 1.0));
+    outFragPos = vec3(uTransform.Transform * vec4(position, 1.0));
 
-	gl_Position = uCamera.ViewProjection * uTransform.Transform * vec4(inPosition, 1.0);
+	gl_Position = uCamera.ViewProjection * uTransform.Transform * vec4(position, 1.0);
 }
 
 #stage frag
@@ -53,6 +60,9 @@ layout(push_constant) uniform Material
 	layout(offset = 80) int DiffuseMapIndex;
     layout(offset = 84) int NormalMapIndex;
     layout(offset = 88) int RoughnessMetallicMapIndex;
+    layout(offset = 92) int PackedNormals;
+    layout(offset = 96) vec4 PositionOffset;
+    layout(offset = 112) vec4 PositionScale;
 } uMaterial;
 
 void main()
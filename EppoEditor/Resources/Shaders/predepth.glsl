@@ -5,19 +5,22 @@
 
 #extension GL_EXT_multiview : enable
 
+// Position-only stream
 layout(location = 0) in vec3 inPosition;
-layout(location = 1) in vec3 inNormal;
-layout(location = 2) in vec2 inTexCoord;
 
 layout(push_constant) uniform PreDepth
 {
 	layout(offset = 0)  mat4 Transform;
     layout(offset = 64) int LightIndex;
+    layout(offset = 80) vec4 PositionOffset;
+    layout(offset = 96) vec4 PositionScale;
 } uPreDepth;
 
 void main()
 {
-    gl_Position = uLights.Projection * uLights.Lights[uPreDepth.LightIndex].View[gl_ViewIndex] * uPreDepth.Transform * vec4(inPosition, 1.0);
+    vec3 position = uPreDepth.PositionOffset.xyz + inPosition * uPreDepth.PositionScale.xyz;
+
+    gl_Position = uLights.Projection * uLights.Lights[uPreDepth.LightIndex].View[gl_ViewIndex] * uPreDepth.Transform * vec4(position, 1.0);
 }
 
 #stage frag
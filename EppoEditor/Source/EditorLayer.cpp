@@ -1,6 +1,7 @@
 #include "EditorLayer.h"
 
 #include "Asset/AssetManagerEditor.h"
+#include "Panel/AssetResidencyPanel.h"
 #include "Panel/ContentBrowserPanel.h"
 #include "Panel/PropertyPanel.h"
 #include "Panel/SceneHierarchyPanel.h"
@@ -11,6 +12,7 @@
 
 namespace Eppo
 {
+	static const std::string ASSET_RESIDENCY_PANEL = "AssetResidencyPanel";
 	static const std::string CONTENT_BROWSER_PANEL = "ContentBrowserPanel";
 	static const std::string PROPERTY_PANEL = "PropertyPanel";
 	static const std::string SCENE_HIERARCHY_PANEL = "SceneHierarchyPanel";
@@ -61,6 +63,9 @@ namespace Eppo
 	
 	void EditorLayer::Update(float timestep)
 	{
+		if (const Ref<Project> project = Project::GetActive())
+			project->GetAssetManagerEditor()->Update();
+
 		if (m_ViewportWidth > 0 && m_ViewportHeight > 0)
 		{
 			m_EditorCamera.SetViewportSize(glm::vec2(m_ViewportWidth, m_ViewportHeight));
@@ -182,6 +187,9 @@ namespace Eppo
 				if (ImGui::MenuItem("Import asset"))
 					ImportAsset();
 
+				if (ImGui::MenuItem("Build asset pack"))
+					BuildAssetPack();
+
 				if (ImGui::MenuItem("Project settings"))
 					s_PreferencesPopup = true;
 
@@ -196,6 +204,9 @@ namespace Eppo
 				if (ImGui::MenuItem("Serialize asset registry"))
 					Project::GetActive()->GetAssetManagerEditor()->SerializeAssetRegistry();
 
+				if (ImGui::MenuItem("Log asset residency"))
+					Project::GetActive()->GetAssetManagerEditor()->LogResidencyReport();
+
 				ImGui::EndMenu();
 			}
 
@@ -230,6 +241,13 @@ namespace Eppo
 		m_ViewportHeight = static_cast<uint32_t>(viewportSize.y);
 
 		UI::Image(m_ViewportRenderer->GetFinalImage(), ImVec2(static_cast<float>(m_ViewportWidth), static_cast<float>(m_ViewportHeight)), ImVec2(0, 1), ImVec2(1, 0));
+		if (m_SceneState == SceneState::Edit && ImGui::IsItemClicked(ImGuiMouseButton_Left))
+		{
+			const ImVec2 mousePosition = ImGui::GetMousePos();
+			const ImVec2 viewportMin = ImGui::GetItemRectMin();
+			PickEntity(glm::vec2(mousePosition.x - viewportMin.x, mousePosition.y - viewportMin.y));
+		}
+
 		if (ImGui::BeginDragDropTarget())
 		{
 			if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("SCENE_ASSET"))
@@ -290,11 +308,39 @@ namespace Eppo
 					SaveProject();
 				break;
 			}
+
+			#if defined(EPPO_ENABLE_PROFILER)
+			case Key::F9:
+			{
+				CPUProfiler::BeginCapture(60);
+				break;
+			}
+			#endif
 		}
 
 		return false;
 	}
 
+	void EditorLayer::PickEntity(const glm::vec2& viewportPosition)
+	{
+		if (m_ViewportWidth == 0 || m_ViewportHeight == 0)
+			return;
+
+		// The viewport shows the image flipped, so up on screen is up in clip space
+		const glm::vec2 ndc(viewportPosition.x / static_cast<float>(m_ViewportWidth) * 2.0f - 1.0f, 1.0f - viewportPosition.y / static_cast<float>(m_ViewportHeight) * 2.0f);
+		const glm::mat4 inverseViewProjection = glm::inverse(m_EditorCamera.GetViewProjectionMatrix());
+
+		glm::vec4 nearPoint = inverseViewProjection * glm::vec4(ndc, 0.0f, 1.0f);
+		glm::vec4 farPoint = inverseViewProjection * glm::vec4(ndc, 1.0f, 1.0f);
+		nearPoint /= nearPoint.w;
+		farPoint /= farPoint.w;
+
+		// Clicking where no mesh is clears the selection
+		const glm::vec3 direction = glm::vec3(farPoint) - glm::vec3(nearPoint);
+		const Entity entity = m_EditorScene->Raycast(Ray(glm::vec3(nearPoint), glm::normalize(direction)), glm::length(direction));
+		m_PanelManager.SetSelectedEntity(entity);
+	}
+
 	void EditorLayer::OnScenePlay()
 	{
 		if (!m_EditorScene)
@@ -303,6 +349,13 @@ namespace Eppo
 		m_SceneState = SceneState::Play;
 		m_ActiveScene = Scene::Copy(m_EditorScene);
 
+		if (const Ref<Project> project = Project::GetActive())
+		{
+			const auto& specification = project->GetSpecification();
+			m_ActiveScene->SetTickRate(specification.SimulationTickRate, specification.MaxSimulationSteps);
+			m_ActiveScene->SetThreadedPhysics(specification.ThreadedPhysics);
+		}
+
 		ScriptEngine::SetSceneContext(m_ActiveScene);
 		m_PanelManager.SetSceneContext(m_ActiveScene);
 		
@@ -467,6 +520,7 @@ namespace Eppo
 				OpenScene(projSpec.StartScene);
 
 			m_PanelManager.AddPanel<ContentBrowserPanel>(CONTENT_BROWSER_PANEL, true, m_PanelManager);
+			m_PanelManager.AddPanel<AssetResidencyPanel>(ASSET_RESIDENCY_PANEL, true, m_PanelManager);
 			Application::Get().GetWindow().SetWindowTitle("EppoEngine Editor - " + projSpec.Name);
 		}
 	}
@@ -552,6 +606,15 @@ namespace Eppo
 		}
 	}
 
+	void EditorLayer::BuildAssetPack()
+	{
+		if (const std::filesystem::path filepath = FileDialog::SaveFile("EppoEngine Asset Pack (*.eppak)\0*.eppak\0");
+			!filepath.empty())
+		{
+			Project::GetActive()->GetAssetManagerEditor()->BuildAssetPack(filepath);
+		}
+	}
+
 	void EditorLayer::UI_File_NewProject()
 	{
 		if (constexpr ImGuiWindowFlags flags = ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_AlwaysAutoResize;
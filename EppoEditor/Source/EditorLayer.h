@@ -23,6 +23,8 @@ namespace Eppo
 
 	private:
 		bool OnKeyPressed(const KeyPressedEvent& e);
+		// Selects the mesh entity under a point of the viewport
+		void PickEntity(const glm::vec2& viewportPosition);
 
 		void OnScenePlay();
 		void OnSceneStop();
@@ -40,6 +42,7 @@ namespace Eppo
 		void SaveSceneAs();
 
 		void ImportAsset();
+		void BuildAssetPack();
 
 		void UI_File_NewProject();
 		void UI_File_Preferences();
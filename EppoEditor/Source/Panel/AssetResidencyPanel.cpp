@@ -0,0 +1,50 @@
+#include "AssetResidencyPanel.h"
+
+namespace Eppo
+{
+	namespace Utils
+	{
+		static float BytesToMegabytes(const uint64_t bytes)
+		{
+			return static_cast<float>(bytes) / (1024.0f * 1024.0f);
+		}
+	}
+
+	AssetResidencyPanel::AssetResidencyPanel(PanelManager& panelManager)
+		: Panel(panelManager)
+	{}
+
+	void AssetResidencyPanel::RenderGui()
+	{
+		ScopedBegin scopedBegin("Asset Residency");
+
+		const auto assetManager = Project::GetActive()->GetAssetManagerEditor();
+
+		if (const uint64_t budget = assetManager->GetMemoryBudget(); budget > 0)
+			ImGui::Text("Resident: %.1f MB of %.1f MB", Utils::BytesToMegabytes(assetManager->GetResidentMemory()), Utils::BytesToMegabytes(budget));
+		else
+			ImGui::Text("Resident: %.1f MB, no budget", Utils::BytesToMegabytes(assetManager->GetResidentMemory()));
+
+		if (ImGui::BeginTable("##Residency", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders))
+		{
+			ImGui::TableSetupColumn("Asset");
+			ImGui::TableSetupColumn("CPU (MB)");
+			ImGui::TableSetupColumn("GPU (MB)");
+			ImGui::TableHeadersRow();
+
+			for (const auto& info : assetManager->GetResidencyReport(32))
+			{
+				ImGui::TableNextRow();
+
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(info.Filepath.string().c_str());
+				ImGui::TableNextColumn();
+				ImGui::Text("%.2f", Utils::BytesToMegabytes(info.Memory.Cpu));
+				ImGui::TableNextColumn();
+				ImGui::Text("%.2f", Utils::BytesToMegabytes(info.Memory.Gpu));
+			}
+
+			ImGui::EndTable();
+		}
+	}
+}
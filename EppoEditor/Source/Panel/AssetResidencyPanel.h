@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Panel/Panel.h"
+
+namespace Eppo
+{
+	class AssetResidencyPanel : public Panel
+	{
+	public:
+		explicit AssetResidencyPanel(PanelManager& panelManager);
+
+		void RenderGui() override;
+	};
+}
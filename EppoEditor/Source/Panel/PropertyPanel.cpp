@@ -34,9 +34,9 @@ namespace Eppo
 		if (!entity)
 			return;
 
-		DrawComponent<TagComponent>(entity, [](auto& component)
+		DrawComponent<TagComponent>(entity, [&entity](auto& component)
 		{
-			std::string& tag = component.Tag;
+			const std::string& tag = component.Tag;
 
 			// ImGui wants a char*, we use std::string
 			// We could cast a c_str to char*, but we still could not write to it
@@ -46,7 +46,7 @@ namespace Eppo
 
 			// Double quote prevents the label from showing
 			if (ImGui::InputText("##Tag", buffer, sizeof(buffer)))
-				tag = std::string(buffer); // TODO: Add support for empty labels --> Don't crash...
+				entity.SetName(buffer); // TODO: Add support for empty labels --> Don't crash...
 		});
 
 		ImGui::SameLine();
@@ -7,6 +7,15 @@ namespace Eppo
 {
 	using AssetHandle = UUID;
 
+	// Bytes an asset keeps resident, on the CPU and in GPU allocations
+	struct AssetMemoryUsage
+	{
+		uint64_t Cpu = 0;
+		uint64_t Gpu = 0;
+
+		[[nodiscard]] uint64_t GetTotal() const { return Cpu + Gpu; }
+	};
+
 	struct Asset
 	{
 		Asset() = default;
@@ -16,6 +25,9 @@ namespace Eppo
 
 		static AssetType GetStaticType() { return AssetType::None; }
 
+		// Assets reporting nothing are never evicted
+		[[nodiscard]] virtual AssetMemoryUsage GetMemoryUsage() const { return {}; }
+
 		virtual bool operator==(const Asset& other) const
 		{
 			return Handle == other.Handle;
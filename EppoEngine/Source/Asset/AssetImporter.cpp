@@ -12,6 +12,13 @@ namespace Eppo
 	{
 		{ AssetType::Mesh, AssetImporter::ImportMesh },
 		{ AssetType::Scene, AssetImporter::ImportScene },
+		{ AssetType::Texture, AssetImporter::ImportTexture },
+	};
+
+	// Loaders that leave GPU work to FinishAsyncLoad
+	static const std::map<AssetType, fn> s_AssetAsyncLoadFunctions =
+	{
+		{ AssetType::Mesh, AssetImporter::LoadMeshAsync },
 	};
 
 	Ref<Asset> AssetImporter::ImportAsset(const AssetHandle handle, const AssetMetadata& metadata)
@@ -32,6 +39,8 @@ namespace Eppo
 		EPPO_PROFILE_FUNCTION("AssetImporter::ImportMesh");
 
 		Ref<Mesh> mesh = CreateRef<Mesh>(Project::GetAssetFilepath(metadata.Filepath));
+		if (!mesh->IsValid())
+			return nullptr;
 
 		return mesh;
 	}
@@ -47,6 +56,49 @@ namespace Eppo
 		return scene;
 	}
 
+	Ref<Texture> AssetImporter::ImportTexture(AssetHandle handle, const AssetMetadata& metadata)
+	{
+		EPPO_PROFILE_FUNCTION("AssetImporter::ImportTexture");
+
+		return Texture::Import(Project::GetAssetFilepath(metadata.Filepath));
+	}
+
+	bool AssetImporter::SupportsAsyncLoad(const AssetType type)
+	{
+		return s_AssetAsyncLoadFunctions.find(type) != s_AssetAsyncLoadFunctions.end();
+	}
+
+	Ref<Asset> AssetImporter::LoadAssetAsync(const AssetHandle handle, const AssetMetadata& metadata)
+	{
+		EPPO_PROFILE_FUNCTION("AssetImporter::LoadAssetAsync");
+
+		if (!SupportsAsyncLoad(metadata.Type))
+			return nullptr;
+
+		return s_AssetAsyncLoadFunctions.at(metadata.Type)(handle, metadata);
+	}
+
+	void AssetImporter::FinishAsyncLoad(const Ref<Asset>& asset, const AssetType type)
+	{
+		EPPO_PROFILE_FUNCTION("AssetImporter::FinishAsyncLoad");
+
+		if (type == AssetType::Mesh)
+			std::static_pointer_cast<Mesh>(asset)->Upload();
+	}
+
+	Ref<Mesh> AssetImporter::LoadMeshAsync(AssetHandle handle, const AssetMetadata& metadata)
+	{
+		EPPO_PROFILE_FUNCTION("AssetImporter::LoadMeshAsync");
+
+		// Reads and decodes only, the upload happens in FinishAsyncLoad.
+		// The filepath is already absolute, workers do not touch the active project.
+		Ref<Mesh> mesh = CreateRef<Mesh>(metadata.Filepath, VertexFormat::Standard, false);
+		if (!mesh->IsValid())
+			return nullptr;
+
+		return mesh;
+	}
+
 	bool AssetImporter::ExportScene(const Ref<Scene>& scene, const std::filesystem::path& filepath)
 	{
 		EPPO_PROFILE_FUNCTION("AssetImporter::ExportScene");
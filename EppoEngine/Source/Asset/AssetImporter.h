@@ -2,6 +2,7 @@
 
 #include "Asset/AssetMetadata.h"
 #include "Renderer/Mesh/Mesh.h"
+#include "Renderer/Texture.h"
 #include "Scene/Scene.h"
 
 namespace Eppo
@@ -14,6 +15,14 @@ namespace Eppo
 
 		static Ref<Mesh> ImportMesh(AssetHandle handle, const AssetMetadata& metadata);
 		static Ref<Scene> ImportScene(AssetHandle handle, const AssetMetadata& metadata);
+		static Ref<Texture> ImportTexture(AssetHandle handle, const AssetMetadata& metadata);
+
+		// Asynchronous loading, the load runs on a worker with an absolute filepath and is finished on the main thread
+		static bool SupportsAsyncLoad(AssetType type);
+		static Ref<Asset> LoadAssetAsync(AssetHandle handle, const AssetMetadata& metadata);
+		static void FinishAsyncLoad(const Ref<Asset>& asset, AssetType type);
+
+		static Ref<Mesh> LoadMeshAsync(AssetHandle handle, const AssetMetadata& metadata);
 
 		// Exporting
 		static bool ExportScene(const Ref<Scene>& scene, const std::filesystem::path& filepath);
@@ -20,6 +20,23 @@ namespace Eppo
 			return std::static_pointer_cast<T>(asset);
 		}
 
+		template<typename T>
+		static Ref<T> GetAssetAsync(const AssetHandle handle)
+		{
+			const Ref<Asset> asset = Project::GetActive()->GetAssetManager()->GetAssetAsync(handle);
+			return std::static_pointer_cast<T>(asset);
+		}
+
+		static AssetLoadState GetAssetLoadState(const AssetHandle handle)
+		{
+			return Project::GetActive()->GetAssetManager()->GetAssetLoadState(handle);
+		}
+
+		static uint64_t GetLoadGeneration()
+		{
+			return Project::GetActive()->GetAssetManager()->GetLoadGeneration();
+		}
+
 		static bool IsAssetHandleValid(const AssetHandle handle)
 		{
 			return Project::GetActive()->GetAssetManager()->IsAssetHandleValid(handle);
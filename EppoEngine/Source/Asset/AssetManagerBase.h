@@ -4,12 +4,32 @@
 
 namespace Eppo
 {
+	enum class AssetLoadState
+	{
+		Unloaded,
+		Loading,
+		Loaded,
+		Failed
+	};
+
 	class AssetManagerBase
 	{
 	public:
 		virtual ~AssetManagerBase() = default;
 		virtual bool CreateAsset(Ref<Asset> asset, const std::filesystem::path& filepath) = 0;
 		virtual Ref<Asset> GetAsset(AssetHandle handle) = 0;
+
+		// Returns the asset once it is resident, until then it schedules the load and returns nullptr
+		virtual Ref<Asset> GetAssetAsync(const AssetHandle handle) { return GetAsset(handle); }
+		[[nodiscard]] virtual AssetLoadState GetAssetLoadState(const AssetHandle handle) const
+		{
+			return IsAssetLoaded(handle) ? AssetLoadState::Loaded : AssetLoadState::Unloaded;
+		}
+
+		// Changes whenever a loaded asset is added, replaced by a reload or evicted, so data cached from
+		// loaded assets only needs to be checked again once it changed
+		[[nodiscard]] virtual uint64_t GetLoadGeneration() const { return 0; }
+
 		[[nodiscard]] virtual bool IsAssetHandleValid(AssetHandle handle) const = 0;
 		[[nodiscard]] virtual bool IsAssetLoaded(AssetHandle handle) const = 0;
 		[[nodiscard]] virtual AssetType GetAssetType(AssetHandle handle) const = 0;
@@ -2,8 +2,20 @@
 #include "AssetManagerEditor.h"
 
 #include "Asset/AssetImporter.h"
+#include "Asset/AssetPack.h"
+#include "Core/Hash.h"
+#include "Core/ThreadPool.h"
+#include "Platform/MappedFile.h"
 #include "Project/Project.h"
+#include "Renderer/Mesh/Mesh.h"
+#include "Renderer/Mesh/MeshCooker.h"
+#include "Renderer/RendererContext.h"
+#include "Renderer/Texture.h"
+#include "Scene/SceneSerializer.h"
 
+#include <optional>
+
+#include <filewatch.h>
 #include <yaml-cpp/yaml.h>
 
 namespace Eppo
@@ -20,6 +32,13 @@ namespace Eppo
 
 	namespace Utils
 	{
+		static constexpr const char* AssetRegistryFilename = "AssetRegistry.epporeg";
+		static constexpr const char* AssetRegistryJournalFilename = "AssetRegistry.epporeg.journal";
+		static constexpr const char* AssetRegistryIndexFilename = "AssetRegistry.epporeg.index";
+
+		// Saving a file often shows up as several events, it is picked up once they stopped
+		static constexpr auto FileChangeDebounceTime = std::chrono::milliseconds(250);
+
 		static AssetType GetAssetTypeFromFileExtension(const std::filesystem::path& extension)
 		{
 			if (s_AssetExtensionMap.find(extension) == s_AssetExtensionMap.end())
@@ -67,10 +86,86 @@ namespace Eppo
 
 			return destPath / filepath.filename();
 		}
+
+		// Bump when the way scenes are stored in packs changes
+		static constexpr uint32_t PackedSceneVersion = 2;
+
+		// Adds the cooked mesh and its textures, fails when any of them is not in the cache
+		static bool AddCookedMeshData(AssetPackBuilder& builder, const DerivedDataKey& key)
+		{
+			const DerivedData mesh = DerivedDataCache::Load(key, MeshCooker::MeshExtension);
+			const CookedMeshHeader* header = MeshCooker::Validate(mesh.Data, mesh.Size, key, VertexFormat::Standard);
+			if (!header)
+				return false;
+
+			std::vector<std::pair<DerivedDataKey, DerivedData>> textures;
+
+			const auto* cookedTextures = reinterpret_cast<const CookedTexture*>(mesh.Data + header->TextureOffset);
+			for (uint32_t i = 0; i < header->TextureCount; i++)
+			{
+				const DerivedDataKey textureKey(cookedTextures[i].Key);
+
+				DerivedData texture = DerivedDataCache::Load(textureKey, MeshCooker::TextureExtension);
+				if (!MeshCooker::ValidateTexture(texture.Data, texture.Size, textureKey))
+					return false;
+
+				textures.emplace_back(textureKey, std::move(texture));
+			}
+
+			builder.AddData(key, mesh.Data, mesh.Size);
+			for (const auto& [textureKey, texture] : textures)
+				builder.AddData(textureKey, texture.Data, texture.Size);
+
+			return true;
+		}
+
+		static std::optional<DerivedDataKey> PackMesh(AssetPackBuilder& builder, const std::filesystem::path& filepath)
+		{
+			const MappedFile source(filepath);
+			if (!source.IsValid())
+				return std::nullopt;
+
+			const DerivedDataKey key = MeshCooker::GetCacheKey(source.GetData(), source.GetSize(), VertexFormat::Standard);
+			if (AddCookedMeshData(builder, key))
+				return key;
+
+			// Importing without upload cooks the mesh into the cache
+			const Mesh mesh(filepath, VertexFormat::Standard, false);
+			if (AddCookedMeshData(builder, key))
+				return key;
+
+			return std::nullopt;
+		}
+
+		// Image files are packed cooked, under the same key as equal images embedded in meshes
+		static std::optional<DerivedDataKey> PackTexture(AssetPackBuilder& builder, const std::filesystem::path& filepath)
+		{
+			const MappedFile source(filepath);
+			if (!source.IsValid())
+				return std::nullopt;
+
+			const DerivedDataKey key = MeshCooker::GetTextureCacheKey(source.GetData(), source.GetSize());
+			if (!DerivedDataCache::Contains(key, MeshCooker::TextureExtension) && !Texture::Cook(key, source.GetData(), source.GetSize()))
+				return std::nullopt;
+
+			const DerivedData texture = DerivedDataCache::Load(key, MeshCooker::TextureExtension);
+			if (!MeshCooker::ValidateTexture(texture.Data, texture.Size, key))
+				return std::nullopt;
+
+			builder.AddData(key, texture.Data, texture.Size);
+			return key;
+		}
 	}
 
 	static const auto s_NullMetadata = AssetMetadata();
 
+	AssetManagerEditor::AssetManagerEditor() = default;
+
+	AssetManagerEditor::~AssetManagerEditor()
+	{
+		m_FileWatchers.clear();
+	}
+
 	bool AssetManagerEditor::CreateAsset(const Ref<Asset> asset, const std::filesystem::path& filepath)
 	{
 		EPPO_PROFILE_FUNCTION("AssetManagerEditor::CreateAsset");
@@ -91,9 +186,9 @@ namespace Eppo
 		metadata.Type = type;
 
 		m_AssetData[handle] = metadata;
-		m_Assets[handle] = asset;
+		AddLoadedAsset(handle, asset);
 
-		SerializeAssetRegistry();
+		AppendToRegistry(AssetRegistryOperation::Add, metadata);
 
 		return true;
 	}
@@ -105,26 +200,97 @@ namespace Eppo
 		if (!IsAssetHandleValid(handle))
 			return nullptr;
 
-		Ref<Asset> asset;
-		if (IsAssetLoaded(handle))
-			asset = m_Assets.at(handle);
-		else
-		{
-			const AssetMetadata& metadata = GetMetadata(handle);
-			asset = AssetImporter::ImportAsset(handle, metadata);
+		if (Ref<Asset> asset = FindLoadedAsset(handle))
+			return asset;
 
-			if (!asset)
+		// An asynchronous load in flight is waited for instead of importing twice
+		std::future<Ref<Asset>> pendingLoad;
+		{
+			std::scoped_lock<std::mutex> lock(m_AssetsMutex);
+			if (const auto it = m_PendingLoads.find(handle); it != m_PendingLoads.end())
 			{
-				EPPO_ERROR("Asset importing failed!");				
+				pendingLoad = std::move(it->second);
+				m_PendingLoads.erase(it);
 			}
+		}
 
-			asset->Handle = handle;
-			m_Assets.insert_or_assign(handle, asset);
+		if (pendingLoad.valid())
+			return FinishAsyncLoad(handle, pendingLoad);
+
+		const AssetMetadata& metadata = GetMetadata(handle);
+		Ref<Asset> asset = AssetImporter::ImportAsset(handle, metadata);
+
+		if (!asset)
+		{
+			EPPO_ERROR("Asset importing failed!");
+			return nullptr;
 		}
 
+		asset->Handle = handle;
+		AddLoadedAsset(handle, asset);
+
 		return asset;
 	}
 
+	Ref<Asset> AssetManagerEditor::GetAssetAsync(const AssetHandle handle)
+	{
+		EPPO_PROFILE_FUNCTION("AssetManagerEditor::GetAssetAsync");
+
+		if (!IsAssetHandleValid(handle))
+			return nullptr;
+
+		if (Ref<Asset> asset = FindLoadedAsset(handle))
+			return asset;
+
+		AssetMetadata metadata = GetMetadata(handle);
+		if (!AssetImporter::SupportsAsyncLoad(metadata.Type))
+			return GetAsset(handle);
+
+		std::future<Ref<Asset>> finishedLoad;
+		{
+			std::scoped_lock<std::mutex> lock(m_AssetsMutex);
+
+			if (m_FailedLoads.find(handle) != m_FailedLoads.end())
+				return nullptr;
+
+			const auto it = m_PendingLoads.find(handle);
+			if (it == m_PendingLoads.end())
+			{
+				// Resolved here so the load does not depend on the active project while it runs
+				metadata.Filepath = Project::GetAssetFilepath(metadata.Filepath);
+
+				m_PendingLoads.emplace(handle, ThreadPool::Get().SubmitAsync([handle, metadata]()
+				{
+					return AssetImporter::LoadAssetAsync(handle, metadata);
+				}));
+
+				return nullptr;
+			}
+
+			if (it->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+				return nullptr;
+
+			finishedLoad = std::move(it->second);
+			m_PendingLoads.erase(it);
+		}
+
+		return FinishAsyncLoad(handle, finishedLoad);
+	}
+
+	AssetLoadState AssetManagerEditor::GetAssetLoadState(const AssetHandle handle) const
+	{
+		std::scoped_lock<std::mutex> lock(m_AssetsMutex);
+
+		if (m_Assets.find(handle) != m_Assets.end())
+			return AssetLoadState::Loaded;
+		if (m_PendingLoads.find(handle) != m_PendingLoads.end())
+			return AssetLoadState::Loading;
+		if (m_FailedLoads.find(handle) != m_FailedLoads.end())
+			return AssetLoadState::Failed;
+
+		return AssetLoadState::Unloaded;
+	}
+
 	bool AssetManagerEditor::IsAssetHandleValid(const AssetHandle handle) const
 	{
 		return handle != 0 && m_AssetData.find(handle) != m_AssetData.end();
@@ -132,6 +298,7 @@ namespace Eppo
 
 	bool AssetManagerEditor::IsAssetLoaded(const AssetHandle handle) const
 	{
+		std::scoped_lock<std::mutex> lock(m_AssetsMutex);
 		return m_Assets.find(handle) != m_Assets.end();
 	}
 
@@ -167,14 +334,184 @@ namespace Eppo
 		{
 			const AssetHandle handle;
 			asset->Handle = handle;
-			m_Assets[handle] = asset;
+			metadata.Handle = handle;
 			m_AssetData[handle] = metadata;
-			SerializeAssetRegistry();
+			AddLoadedAsset(handle, asset);
+
+			AppendToRegistry(AssetRegistryOperation::Add, metadata);
+		}
+
+		return asset;
+	}
+
+	Ref<Asset> AssetManagerEditor::FindLoadedAsset(const AssetHandle handle)
+	{
+		std::scoped_lock<std::mutex> lock(m_AssetsMutex);
+
+		const auto it = m_Assets.find(handle);
+		if (it == m_Assets.end())
+			return nullptr;
+
+		it->second.LastUsed = ++m_UseCounter;
+		return it->second.Instance;
+	}
+
+	Ref<Asset> AssetManagerEditor::FinishAsyncLoad(const AssetHandle handle, std::future<Ref<Asset>>& future)
+	{
+		EPPO_PROFILE_FUNCTION("AssetManagerEditor::FinishAsyncLoad");
+
+		Ref<Asset> asset = future.get();
+		if (!asset)
+		{
+			EPPO_ERROR("Asynchronous load of asset {} failed!", handle);
+
+			std::scoped_lock<std::mutex> lock(m_AssetsMutex);
+			m_FailedLoads.insert(handle);
+			return nullptr;
 		}
 
+		// GPU resources are created here, on the main thread
+		AssetImporter::FinishAsyncLoad(asset, GetAssetType(handle));
+		asset->Handle = handle;
+		AddLoadedAsset(handle, asset);
+
 		return asset;
 	}
 
+	void AssetManagerEditor::AddLoadedAsset(const AssetHandle handle, const Ref<Asset>& asset)
+	{
+		EPPO_PROFILE_FUNCTION("AssetManagerEditor::AddLoadedAsset");
+
+		std::vector<ResidentAsset> evicted;
+
+		{
+			std::scoped_lock<std::mutex> lock(m_AssetsMutex);
+
+			if (const auto it = m_Assets.find(handle); it != m_Assets.end())
+				m_ResidentMemory -= it->second.Memory.GetTotal();
+
+			ResidentAsset& resident = m_Assets[handle];
+			resident.Instance = asset;
+			m_LoadGeneration++;
+			resident.Memory = asset->GetMemoryUsage();
+			resident.LastUsed = ++m_UseCounter;
+
+			m_ResidentMemory += resident.Memory.GetTotal();
+			evicted = EvictToBudget();
+		}
+
+		ReleaseEvicted(evicted);
+	}
+
+	std::vector<AssetManagerEditor::ResidentAsset> AssetManagerEditor::EvictToBudget()
+	{
+		std::vector<ResidentAsset> evicted;
+		if (m_MemoryBudget == 0 || m_ResidentMemory <= m_MemoryBudget)
+			return evicted;
+
+		// Referenced outside of the manager means in use, those stay resident
+		std::vector<std::pair<uint64_t, AssetHandle>> candidates;
+		for (const auto& [handle, resident] : m_Assets)
+		{
+			if (resident.Instance.use_count() == 1 && resident.Memory.GetTotal() > 0)
+				candidates.emplace_back(resident.LastUsed, handle);
+		}
+
+		std::sort(candidates.begin(), candidates.end());
+
+		for (const auto& [lastUsed, handle] : candidates)
+		{
+			if (m_ResidentMemory <= m_MemoryBudget)
+				break;
+
+			const auto it = m_Assets.find(handle);
+			EPPO_TRACE("Evicting asset {} ({} bytes)", handle, it->second.Memory.GetTotal());
+
+			m_ResidentMemory -= it->second.Memory.GetTotal();
+			evicted.emplace_back(std::move(it->second));
+			m_Assets.erase(it);
+			m_LoadGeneration++;
+		}
+
+		if (m_ResidentMemory > m_MemoryBudget)
+			EPPO_WARN("Resident assets use {} bytes, over the budget of {} bytes", m_ResidentMemory, m_MemoryBudget);
+
+		return evicted;
+	}
+
+	void AssetManagerEditor::ReleaseEvicted(std::vector<ResidentAsset>& evicted)
+	{
+		// Frames in flight can still read from the GPU resources, so those go with the garbage collector.
+		// Assets without any are released right here.
+		std::vector<Ref<Asset>> gpuAssets;
+		for (ResidentAsset& resident : evicted)
+		{
+			if (resident.Memory.Gpu > 0)
+				gpuAssets.emplace_back(std::move(resident.Instance));
+		}
+
+		evicted.clear();
+
+		if (!gpuAssets.empty())
+			RendererContext::Get()->SubmitResourceFree([gpuAssets]() {}, false);
+	}
+
+	void AssetManagerEditor::SetMemoryBudget(const uint64_t bytes)
+	{
+		std::vector<ResidentAsset> evicted;
+
+		{
+			std::scoped_lock<std::mutex> lock(m_AssetsMutex);
+			m_MemoryBudget = bytes;
+			evicted = EvictToBudget();
+		}
+
+		ReleaseEvicted(evicted);
+	}
+
+	uint64_t AssetManagerEditor::GetResidentMemory() const
+	{
+		std::scoped_lock<std::mutex> lock(m_AssetsMutex);
+		return m_ResidentMemory;
+	}
+
+	uint64_t AssetManagerEditor::GetLoadGeneration() const
+	{
+		std::scoped_lock<std::mutex> lock(m_AssetsMutex);
+		return m_LoadGeneration;
+	}
+
+	std::vector<AssetResidencyInfo> AssetManagerEditor::GetResidencyReport(const uint32_t maxCount) const
+	{
+		std::vector<AssetResidencyInfo> report;
+
+		{
+			std::scoped_lock<std::mutex> lock(m_AssetsMutex);
+
+			report.reserve(m_Assets.size());
+			for (const auto& [handle, resident] : m_Assets)
+				report.push_back({ handle, GetFilepath(handle), resident.Memory, resident.LastUsed });
+		}
+
+		std::sort(report.begin(), report.end(), [](const AssetResidencyInfo& a, const AssetResidencyInfo& b)
+		{
+			return a.Memory.GetTotal() > b.Memory.GetTotal();
+		});
+
+		if (report.size() > maxCount)
+			report.resize(maxCount);
+
+		return report;
+	}
+
+	void AssetManagerEditor::LogResidencyReport(const uint32_t maxCount) const
+	{
+		EPPO_INFO("Resident assets: {} bytes, budget {} bytes", GetResidentMemory(), m_MemoryBudget);
+
+		for (const auto& info : GetResidencyReport(maxCount))
+			EPPO_INFO("  {:>12} CPU {:>12} GPU  {} ({})", info.Memory.Cpu, info.Memory.Gpu, info.Filepath.string(), info.Handle);
+	}
+
 	const AssetMetadata& AssetManagerEditor::GetMetadata(AssetHandle handle) const
 	{
 		auto it = m_AssetData.find(handle);
@@ -189,7 +526,72 @@ namespace Eppo
 		return GetMetadata(handle).Filepath;
 	}
 
-	void AssetManagerEditor::SerializeAssetRegistry() const
+	bool AssetManagerEditor::BuildAssetPack(const std::filesystem::path& filepath, const bool compress) const
+	{
+		EPPO_PROFILE_FUNCTION("AssetManagerEditor::BuildAssetPack");
+		EPPO_INFO("Building asset pack '{}'", filepath.string());
+
+		AssetPackBuilder builder;
+		builder.SetStartScene(Project::GetActive()->GetSpecification().StartScene);
+
+		for (const auto& [handle, metadata] : m_AssetData)
+		{
+			const std::filesystem::path assetFilepath = Project::GetAssetFilepath(metadata.Filepath);
+
+			switch (metadata.Type)
+			{
+				case AssetType::Mesh:
+				{
+					if (const std::optional<DerivedDataKey> key = Utils::PackMesh(builder, assetFilepath))
+						builder.AddAsset(handle, metadata.Type, *key);
+					else
+						EPPO_ERROR("Failed to pack mesh '{}'!", metadata.Filepath.string());
+					break;
+				}
+
+				case AssetType::Texture:
+				{
+					if (const std::optional<DerivedDataKey> key = Utils::PackTexture(builder, assetFilepath))
+						builder.AddAsset(handle, metadata.Type, *key);
+					else
+						EPPO_ERROR("Failed to pack texture '{}'!", metadata.Filepath.string());
+					break;
+				}
+
+				case AssetType::Scene:
+				{
+					// Scenes are packed in the binary format, converted from the saved file
+					const MappedFile source(assetFilepath);
+					const Ref<Scene> scene = CreateRef<Scene>();
+					SceneSerializer serializer(scene);
+
+					if (!source.IsValid() || !serializer.DeserializeFromMemory(std::string_view(reinterpret_cast<const char*>(source.GetData()), source.GetSize())))
+					{
+						EPPO_ERROR("Failed to pack scene '{}'!", metadata.Filepath.string());
+						break;
+					}
+
+					DerivedDataKey key("Scene", Utils::PackedSceneVersion);
+					key.Append(source.GetData(), source.GetSize());
+
+					const std::vector<uint8_t> data = serializer.SerializeBinaryToMemory(assetFilepath.stem().string());
+					builder.AddData(key, data.data(), data.size());
+					builder.AddAsset(handle, metadata.Type, key);
+					break;
+				}
+
+				default:
+				{
+					EPPO_WARN("Asset '{}' is not packed, there is no runtime loader for {} assets", metadata.Filepath.string(), Utils::AssetTypeToString(metadata.Type));
+					break;
+				}
+			}
+		}
+
+		return builder.Write(filepath, compress);
+	}
+
+	void AssetManagerEditor::SerializeAssetRegistry()
 	{
 		EPPO_PROFILE_FUNCTION("AssetManagerEditor::SerializeAssetRegistry");
 		EPPO_INFO("Serializing asset registry");
@@ -210,17 +612,27 @@ namespace Eppo
 
 		out << YAML::EndSeq;
 
-		std::ofstream fout(Project::GetAssetsDirectory() / "AssetRegistry.epporeg", std::ios::trunc);
-		fout << out.c_str();
+		{
+			// Binary, so the bytes on disk are the ones hashed for the index below
+			std::ofstream fout(Project::GetAssetsDirectory() / Utils::AssetRegistryFilename, std::ios::binary | std::ios::trunc);
+			fout << out.c_str();
+		}
+
+		// The journal is only cleared once its changes are in the registry file
+		AssetRegistryIndex::Write(Project::GetAssetsDirectory() / Utils::AssetRegistryIndexFilename, Hash::GenerateXXH64(out.c_str(), out.size()), m_AssetData);
+		AssetRegistryJournal::Clear(Project::GetAssetsDirectory() / Utils::AssetRegistryJournalFilename);
+		m_JournalRecordCount = 0;
 	}
 
 	bool AssetManagerEditor::DeserializeAssetRegistry()
 	{
 		EPPO_PROFILE_FUNCTION("AssetManagerEditor::DeserializeAssetRegistry");
 
-		std::filesystem::path assetRegistryFile = Project::GetAssetsDirectory() / "AssetRegistry.epporeg";
+		const std::filesystem::path assetRegistryFile = Project::GetAssetsDirectory() / Utils::AssetRegistryFilename;
+		const std::filesystem::path journalFile = Project::GetAssetsDirectory() / Utils::AssetRegistryJournalFilename;
 
-		if (!Filesystem::Exists(assetRegistryFile))
+		const bool hasJournal = Filesystem::Exists(journalFile);
+		if (!Filesystem::Exists(assetRegistryFile) && !hasJournal)
 		{
 			EPPO_WARN("Asset registry file not found at {}", assetRegistryFile);
 			return false;
@@ -228,44 +640,286 @@ namespace Eppo
 
 		EPPO_INFO("Deserializing asset registry");
 
-		YAML::Node data;
+		if (const MappedFile registryFile(assetRegistryFile); registryFile.IsValid())
+		{
+			// The index is used as long as it was written for the registry file as it is now,
+			// version control can change the file behind its back
+			const uint64_t registryHash = Hash::GenerateXXH64(registryFile.GetData(), registryFile.GetSize());
+			const std::filesystem::path indexFile = Project::GetAssetsDirectory() / Utils::AssetRegistryIndexFilename;
+
+			if (!AssetRegistryIndex::Read(indexFile, registryHash, m_AssetData))
+			{
+				EPPO_INFO("Asset registry index is missing or outdated, parsing registry file");
+
+				YAML::Node data;
 
-		// Load the entries in the asset registry
-		try
+				try
+				{
+					data = YAML::Load(std::string(reinterpret_cast<const char*>(registryFile.GetData()), registryFile.GetSize()));
+				}
+				catch (YAML::ParserException& e)
+				{
+					EPPO_ERROR("Failed to load asset registry file '{}'!", assetRegistryFile);
+					EPPO_ERROR("YAML Error: {}", e.what());
+					return false;
+				}
+
+				for (const auto& asset : data)
+				{
+					AssetMetadata metadata;
+					metadata.Handle = asset["AssetHandle"].as<uint64_t>();
+					metadata.Type = Utils::AssetTypeFromString(asset["Type"].as<std::string>());
+					metadata.Filepath = asset["Filepath"].as<std::string>();
+
+					m_AssetData[metadata.Handle] = metadata;
+				}
+
+				AssetRegistryIndex::Write(indexFile, registryHash, m_AssetData);
+			}
+		}
+
+		m_JournalRecordCount = AssetRegistryJournal::Replay(journalFile, m_AssetData);
+		EPPO_TRACE("Asset registry loaded with {} assets, {} journaled changes", m_AssetData.size(), m_JournalRecordCount);
+
+		if (m_JournalRecordCount >= JournalCompactionThreshold)
+			SerializeAssetRegistry();
+
+		// Checking every file would stall opening large projects, missing ones are dropped once the check is done
+		StartMissingAssetCheck();
+
+		return true;
+	}
+
+	void AssetManagerEditor::Update()
+	{
+		EPPO_PROFILE_FUNCTION("AssetManagerEditor::Update");
+
+		ProcessMissingAssets();
+		ProcessFileChanges();
+	}
+
+	void AssetManagerEditor::StartFileWatcher()
+	{
+		EPPO_PROFILE_FUNCTION("AssetManagerEditor::StartFileWatcher");
+
+		const std::filesystem::path assetsDirectory = Project::GetAssetsDirectory();
+		std::vector<std::filesystem::path> directories = { assetsDirectory };
+
+	#if defined(EPPO_PLATFORM_LINUX)
+		// inotify watches a single directory, subdirectories created later are not watched
+		std::error_code error;
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(assetsDirectory, error))
 		{
-			data = YAML::LoadFile(assetRegistryFile.string());
+			if (entry.is_directory())
+				directories.emplace_back(entry.path());
 		}
-		catch (YAML::ParserException& e)
+	#endif
+
+		m_FileWatchers.clear();
+
+		for (const auto& directory : directories)
 		{
-			EPPO_ERROR("Failed to load asset registry file '{}'!", assetRegistryFile);
-			EPPO_ERROR("YAML Error: {}", e.what());
-			return false;
+			const std::filesystem::path relativeDirectory = std::filesystem::relative(directory, assetsDirectory);
+
+			try
+			{
+				m_FileWatchers.emplace_back(CreateScope<filewatch::FileWatch<std::filesystem::path>>(directory, [this, relativeDirectory](const std::filesystem::path& filepath, const filewatch::Event changeType)
+				{
+					OnFileSystemEvent(relativeDirectory / filepath, changeType);
+				}));
+			}
+			catch (const std::system_error& e)
+			{
+				EPPO_WARN("Failed to watch '{}' for changes: {}", directory.string(), e.what());
+			}
+		}
+	}
+
+	void AssetManagerEditor::OnFileSystemEvent(const std::filesystem::path& filepath, const filewatch::Event changeType)
+	{
+		if (changeType != filewatch::Event::added && changeType != filewatch::Event::modified && changeType != filewatch::Event::renamed_new)
+			return;
+
+		std::scoped_lock<std::mutex> lock(m_FileChangesMutex);
+		m_FileChanges[filepath.lexically_normal()] = std::chrono::steady_clock::now();
+	}
+
+	void AssetManagerEditor::ProcessFileChanges()
+	{
+		EPPO_PROFILE_FUNCTION("AssetManagerEditor::ProcessFileChanges");
+
+		std::vector<std::filesystem::path> changedFiles;
+
+		{
+			std::scoped_lock<std::mutex> lock(m_FileChangesMutex);
+
+			const auto now = std::chrono::steady_clock::now();
+			for (auto it = m_FileChanges.begin(); it != m_FileChanges.end();)
+			{
+				if (now - it->second < Utils::FileChangeDebounceTime)
+				{
+					++it;
+					continue;
+				}
+
+				changedFiles.emplace_back(it->first);
+				it = m_FileChanges.erase(it);
+			}
 		}
 
-		for (const auto& asset : data)
+		for (const auto& filepath : changedFiles)
 		{
-			std::filesystem::path filepath = asset["Filepath"].as<std::string>();
-			if (!Filesystem::Exists(Project::GetAssetFilepath(filepath)))
+			const auto it = std::find_if(m_AssetData.begin(), m_AssetData.end(), [&filepath](const auto& entry)
 			{
-				EPPO_WARN("Asset with filepath '{}' has been removed from the asset registry because it does not exist!", filepath);
+				return entry.second.Filepath.lexically_normal() == filepath;
+			});
+
+			if (it == m_AssetData.end())
 				continue;
+
+			const AssetHandle handle = it->first;
+
+			{
+				// A broken file that got fixed can be loaded again
+				std::scoped_lock<std::mutex> lock(m_AssetsMutex);
+				m_FailedLoads.erase(handle);
 			}
 
-			AssetHandle handle = asset["AssetHandle"].as<uint64_t>();
+			// Changed again while reloading, retried once the running reload is done
+			if (IsReloading(handle))
+			{
+				std::scoped_lock<std::mutex> lock(m_FileChangesMutex);
+				m_FileChanges.try_emplace(filepath, std::chrono::steady_clock::now());
+				continue;
+			}
 
-			AssetMetadata metadata;
-			metadata.Handle = handle;
-			metadata.Type = Utils::AssetTypeFromString(asset["Type"].as<std::string>());
-			metadata.Filepath = filepath;
+			// Assets that are not resident pick up the new contents when they are loaded
+			if (ReloadAsset(handle))
+				EPPO_INFO("Asset '{}' changed, reloading", filepath.string());
+		}
 
-			m_AssetData[handle] = metadata;
+		for (auto it = m_PendingReloads.begin(); it != m_PendingReloads.end();)
+		{
+			if (it->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			{
+				++it;
+				continue;
+			}
 
-			EPPO_TRACE("Asset '{}' ({}) deserialized", filepath.string(), handle);
+			FinishReload(it->first, it->second);
+			it = m_PendingReloads.erase(it);
 		}
+	}
 
-		// Since the information can have changed if a asset did not exist, we serialize it again
-		SerializeAssetRegistry();
+	bool AssetManagerEditor::ReloadAsset(const AssetHandle handle)
+	{
+		EPPO_PROFILE_FUNCTION("AssetManagerEditor::ReloadAsset");
+
+		if (!IsAssetHandleValid(handle) || !IsAssetLoaded(handle) || IsReloading(handle))
+			return false;
+
+		AssetMetadata metadata = GetMetadata(handle);
+		if (!AssetImporter::SupportsAsyncLoad(metadata.Type))
+			return false;
+
+		metadata.Filepath = Project::GetAssetFilepath(metadata.Filepath);
+
+		m_PendingReloads.emplace(handle, ThreadPool::Get().SubmitAsync([handle, metadata]()
+		{
+			return AssetImporter::LoadAssetAsync(handle, metadata);
+		}));
 
 		return true;
 	}
+
+	void AssetManagerEditor::FinishReload(const AssetHandle handle, std::future<Ref<Asset>>& future)
+	{
+		EPPO_PROFILE_FUNCTION("AssetManagerEditor::FinishReload");
+
+		Ref<Asset> asset = future.get();
+		if (!asset)
+		{
+			EPPO_ERROR("Reloading asset {} failed, the previous version stays in use", handle);
+			return;
+		}
+
+		Ref<Asset> previous;
+		{
+			std::scoped_lock<std::mutex> lock(m_AssetsMutex);
+			if (const auto it = m_Assets.find(handle); it != m_Assets.end())
+				previous = it->second.Instance;
+		}
+
+		// Evicted while reloading, nothing uses it anymore
+		if (!previous)
+			return;
+
+		AssetImporter::FinishAsyncLoad(asset, GetAssetType(handle));
+		asset->Handle = handle;
+		AddLoadedAsset(handle, asset);
+
+		// Frames in flight can still use the previous version, so the garbage collector releases it
+		RendererContext::Get()->SubmitResourceFree([previous]() {}, false);
+
+		EPPO_INFO("Reloaded asset '{}'", GetFilepath(handle).string());
+	}
+
+	void AssetManagerEditor::ProcessMissingAssets()
+	{
+		if (!m_MissingAssetCheck.valid() || m_MissingAssetCheck.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			return;
+
+		for (const AssetHandle handle : m_MissingAssetCheck.get())
+		{
+			const auto it = m_AssetData.find(handle);
+			if (it == m_AssetData.end())
+				continue;
+
+			EPPO_WARN("Asset with filepath '{}' has been removed from the asset registry because it does not exist!", it->second.Filepath);
+
+			const AssetMetadata metadata = it->second;
+			m_AssetData.erase(it);
+			AppendToRegistry(AssetRegistryOperation::Remove, metadata);
+		}
+	}
+
+	void AssetManagerEditor::AppendToRegistry(const AssetRegistryOperation operation, const AssetMetadata& metadata)
+	{
+		EPPO_PROFILE_FUNCTION("AssetManagerEditor::AppendToRegistry");
+
+		// Records are small and appended in place, so a change costs the same however large the registry is
+		if (!AssetRegistryJournal::Append(Project::GetAssetsDirectory() / Utils::AssetRegistryJournalFilename, operation, metadata))
+		{
+			EPPO_WARN("Failed to journal asset registry change, serializing the full registry");
+			SerializeAssetRegistry();
+			return;
+		}
+
+		if (++m_JournalRecordCount >= JournalCompactionThreshold)
+			SerializeAssetRegistry();
+	}
+
+	void AssetManagerEditor::StartMissingAssetCheck()
+	{
+		std::vector<std::pair<AssetHandle, std::filesystem::path>> assets;
+		assets.reserve(m_AssetData.size());
+		for (const auto& [handle, metadata] : m_AssetData)
+			assets.emplace_back(handle, Project::GetAssetFilepath(metadata.Filepath));
+
+		// The job owns everything it touches, so it can outlive the asset manager
+		m_MissingAssetCheck = ThreadPool::Get().SubmitAsync([assets = std::move(assets)]()
+		{
+			EPPO_PROFILE_FUNCTION("AssetManagerEditor::MissingAssetCheck");
+
+			std::vector<AssetHandle> missing;
+			for (const auto& [handle, filepath] : assets)
+			{
+				std::error_code error;
+				if (!std::filesystem::exists(filepath, error))
+					missing.push_back(handle);
+			}
+
+			return missing;
+		});
+	}
 }
@@ -2,16 +2,44 @@
 
 #include "Asset/AssetManagerBase.h"
 #include "Asset/AssetMetadata.h"
+#include "Asset/AssetRegistryJournal.h"
 
+#include <future>
 #include <map>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace filewatch
+{
+	template<class T>
+	class FileWatch;
+
+	enum class Event;
+}
 
 namespace Eppo
 {
+	struct AssetResidencyInfo
+	{
+		AssetHandle Handle;
+		std::filesystem::path Filepath;
+		AssetMemoryUsage Memory;
+		uint64_t LastUsed = 0;
+	};
+
 	class AssetManagerEditor : public AssetManagerBase
 	{
 	public:
+		// Defined in the source, where the file watcher type is complete
+		AssetManagerEditor();
+		~AssetManagerEditor() override;
+
 		bool CreateAsset(Ref<Asset> asset, const std::filesystem::path& filepath) override;
 		Ref<Asset> GetAsset(AssetHandle handle) override;
+		Ref<Asset> GetAssetAsync(AssetHandle handle) override;
+		[[nodiscard]] AssetLoadState GetAssetLoadState(AssetHandle handle) const override;
+		[[nodiscard]] uint64_t GetLoadGeneration() const override;
 
 		[[nodiscard]] bool IsAssetHandleValid(AssetHandle handle) const override;
 		[[nodiscard]] bool IsAssetLoaded(AssetHandle handle) const override;
@@ -23,11 +51,87 @@ namespace Eppo
 		[[nodiscard]] const std::filesystem::path& GetFilepath(AssetHandle handle) const;
 		[[nodiscard]] const std::map<AssetHandle, AssetMetadata>& GetAssetRegistry() const { return m_AssetData; }
 
-		void SerializeAssetRegistry() const;
+		// Compacts the journal into the registry file and rewrites the binary index
+		void SerializeAssetRegistry();
 		bool DeserializeAssetRegistry();
 
+		// Applies the results of background work, once per frame on the main thread
+		void Update();
+
+		// Loaded assets are imported again on a worker when their files change
+		void StartFileWatcher();
+		// Imports a loaded asset again on a worker, it is replaced in Update once the new version loaded.
+		// Returns false when the asset is not loaded, cannot be reloaded or is being reloaded already.
+		bool ReloadAsset(AssetHandle handle);
+		[[nodiscard]] bool IsReloading(AssetHandle handle) const { return m_PendingReloads.find(handle) != m_PendingReloads.end(); }
+
+		// Packs the cooked data of every registered asset for AssetManagerRuntime, cooking what is not cached yet
+		bool BuildAssetPack(const std::filesystem::path& filepath, bool compress = true) const;
+
+		// Unreferenced assets are evicted least recently used first while the budget is exceeded, zero disables it
+		void SetMemoryBudget(uint64_t bytes);
+		[[nodiscard]] uint64_t GetMemoryBudget() const { return m_MemoryBudget; }
+		[[nodiscard]] uint64_t GetResidentMemory() const;
+
+		// Largest resident assets first
+		[[nodiscard]] std::vector<AssetResidencyInfo> GetResidencyReport(uint32_t maxCount) const;
+		void LogResidencyReport(uint32_t maxCount = 10) const;
+
+	private:
+		// Marks the asset as used
+		Ref<Asset> FindLoadedAsset(AssetHandle handle);
+		Ref<Asset> FinishAsyncLoad(AssetHandle handle, std::future<Ref<Asset>>& future);
+
+		// Journals the change, the registry file is only rewritten once enough changes collected
+		void AppendToRegistry(AssetRegistryOperation operation, const AssetMetadata& metadata);
+		void StartMissingAssetCheck();
+		// Drops assets whose files the background check found missing
+		void ProcessMissingAssets();
+
+		// Called on the watcher threads
+		void OnFileSystemEvent(const std::filesystem::path& filepath, filewatch::Event changeType);
+		void ProcessFileChanges();
+		void FinishReload(AssetHandle handle, std::future<Ref<Asset>>& future);
+
+	private:
+		struct ResidentAsset
+		{
+			Ref<Asset> Instance;
+			AssetMemoryUsage Memory;
+			uint64_t LastUsed = 0;
+		};
+
+		void AddLoadedAsset(AssetHandle handle, const Ref<Asset>& asset);
+		// Expects the assets mutex to be held, evicted assets are returned so they are released outside of it
+		std::vector<ResidentAsset> EvictToBudget();
+		static void ReleaseEvicted(std::vector<ResidentAsset>& evicted);
+
 	private:
 		std::map<AssetHandle, AssetMetadata> m_AssetData;
-		std::map<AssetHandle, Ref<Asset>> m_Assets;
+
+		static constexpr uint32_t JournalCompactionThreshold = 1024;
+		uint32_t m_JournalRecordCount = 0;
+
+		// Handles of registered assets whose files do not exist
+		std::future<std::vector<AssetHandle>> m_MissingAssetCheck;
+
+		// Asset relative filepaths with the time of their last change event
+		std::mutex m_FileChangesMutex;
+		std::map<std::filesystem::path, std::chrono::steady_clock::time_point> m_FileChanges;
+		std::unordered_map<AssetHandle, std::future<Ref<Asset>>> m_PendingReloads;
+
+		// Declared last, so the watcher threads are stopped before anything they use is destroyed
+		std::vector<Scope<filewatch::FileWatch<std::filesystem::path>>> m_FileWatchers;
+
+		// Guards the loaded assets and the load bookkeeping, loads complete on workers
+		mutable std::mutex m_AssetsMutex;
+		std::map<AssetHandle, ResidentAsset> m_Assets;
+		std::unordered_map<AssetHandle, std::future<Ref<Asset>>> m_PendingLoads;
+		std::unordered_set<AssetHandle> m_FailedLoads;
+
+		uint64_t m_MemoryBudget = 0;
+		uint64_t m_ResidentMemory = 0;
+		uint64_t m_UseCounter = 0;
+		uint64_t m_LoadGeneration = 0;
 	};
 }
@@ -0,0 +1,182 @@
+#include "pch.h"
+#include "AssetManagerRuntime.h"
+
+#include "Renderer/Mesh/Mesh.h"
+#include "Renderer/Texture.h"
+#include "Scene/Scene.h"
+#include "Scene/SceneSerializer.h"
+
+namespace Eppo
+{
+	bool AssetManagerRuntime::MountPack(const std::filesystem::path& filepath)
+	{
+		EPPO_PROFILE_FUNCTION("AssetManagerRuntime::MountPack");
+
+		auto pack = CreateScope<AssetPack>(filepath);
+		if (!pack->IsValid())
+			return false;
+
+		EPPO_INFO("Mounted asset pack '{}'", filepath.string());
+		m_Packs.emplace_back(std::move(pack));
+
+		return true;
+	}
+
+	bool AssetManagerRuntime::CreateAsset(const Ref<Asset> asset, const std::filesystem::path& filepath)
+	{
+		EPPO_PROFILE_FUNCTION("AssetManagerRuntime::CreateAsset");
+
+		const AssetHandle handle = asset->Handle;
+		if (IsAssetHandleValid(handle))
+			return false;
+
+		// Packs are read-only, runtime created assets only live in memory
+		AssetType type = AssetType::None;
+		if (std::dynamic_pointer_cast<Scene>(asset))
+			type = AssetType::Scene;
+		else if (std::dynamic_pointer_cast<Mesh>(asset))
+			type = AssetType::Mesh;
+
+		std::scoped_lock<std::mutex> lock(m_AssetsMutex);
+		m_CreatedAssets[handle] = type;
+		m_Assets[handle] = asset;
+
+		return true;
+	}
+
+	Ref<Asset> AssetManagerRuntime::GetAsset(const AssetHandle handle)
+	{
+		EPPO_PROFILE_FUNCTION("AssetManagerRuntime::GetAsset");
+
+		{
+			std::scoped_lock<std::mutex> lock(m_AssetsMutex);
+			if (const auto it = m_Assets.find(handle); it != m_Assets.end())
+				return it->second;
+		}
+
+		const AssetPackEntry* entry = FindAsset(handle);
+		if (!entry)
+			return nullptr;
+
+		Ref<Asset> asset = LoadAsset(*entry);
+		if (!asset)
+		{
+			EPPO_ERROR("Failed to load asset {} from packs!", handle);
+			return nullptr;
+		}
+
+		asset->Handle = handle;
+
+		// Another thread loading the same asset may have been first, its instance is kept
+		std::scoped_lock<std::mutex> lock(m_AssetsMutex);
+		return m_Assets.try_emplace(handle, asset).first->second;
+	}
+
+	bool AssetManagerRuntime::IsAssetHandleValid(const AssetHandle handle) const
+	{
+		if (handle == 0)
+			return false;
+
+		if (FindAsset(handle))
+			return true;
+
+		std::scoped_lock<std::mutex> lock(m_AssetsMutex);
+		return m_CreatedAssets.find(handle) != m_CreatedAssets.end();
+	}
+
+	bool AssetManagerRuntime::IsAssetLoaded(const AssetHandle handle) const
+	{
+		std::scoped_lock<std::mutex> lock(m_AssetsMutex);
+		return m_Assets.find(handle) != m_Assets.end();
+	}
+
+	AssetType AssetManagerRuntime::GetAssetType(const AssetHandle handle) const
+	{
+		if (const AssetPackEntry* entry = FindAsset(handle))
+			return static_cast<AssetType>(entry->Type);
+
+		std::scoped_lock<std::mutex> lock(m_AssetsMutex);
+		if (const auto it = m_CreatedAssets.find(handle); it != m_CreatedAssets.end())
+			return it->second;
+
+		return AssetType::None;
+	}
+
+	AssetHandle AssetManagerRuntime::GetStartScene() const
+	{
+		for (auto it = m_Packs.rbegin(); it != m_Packs.rend(); ++it)
+		{
+			if (const AssetHandle startScene = (*it)->GetStartScene())
+				return startScene;
+		}
+
+		return 0;
+	}
+
+	const AssetPackEntry* AssetManagerRuntime::FindAsset(const AssetHandle handle) const
+	{
+		for (auto it = m_Packs.rbegin(); it != m_Packs.rend(); ++it)
+		{
+			if (const AssetPackEntry* entry = (*it)->FindAsset(handle))
+				return entry;
+		}
+
+		return nullptr;
+	}
+
+	DerivedData AssetManagerRuntime::LoadData(const DerivedDataKey& key) const
+	{
+		for (auto it = m_Packs.rbegin(); it != m_Packs.rend(); ++it)
+		{
+			if (DerivedData data = (*it)->LoadData(key); data.IsValid())
+				return data;
+		}
+
+		return {};
+	}
+
+	Ref<Asset> AssetManagerRuntime::LoadAsset(const AssetPackEntry& entry) const
+	{
+		EPPO_PROFILE_FUNCTION("AssetManagerRuntime::LoadAsset");
+
+		const DerivedDataKey key(entry.Key);
+
+		switch (static_cast<AssetType>(entry.Type))
+		{
+			case AssetType::Mesh:
+			{
+				// Keys are unique across data types, so the extension is not needed to find the blob
+				Ref<Mesh> mesh = CreateRef<Mesh>(key, [this](const DerivedDataKey& dataKey, std::string_view) { return LoadData(dataKey); });
+				if (!mesh->IsValid())
+					return nullptr;
+
+				return mesh;
+			}
+
+			case AssetType::Scene:
+			{
+				const DerivedData data = LoadData(key);
+				if (!data.IsValid())
+					return nullptr;
+
+				Ref<Scene> scene = CreateRef<Scene>();
+				if (SceneSerializer serializer(scene);
+					!serializer.DeserializeFromMemory(std::string_view(reinterpret_cast<const char*>(data.Data), data.Size)))
+				{
+					return nullptr;
+				}
+
+				return scene;
+			}
+
+			case AssetType::Texture:
+			{
+				return Texture::Load(key, [this](const DerivedDataKey& dataKey, std::string_view) { return LoadData(dataKey); });
+			}
+
+			default:
+				EPPO_ERROR("No pack loader available for asset type: {}", Utils::AssetTypeToString(static_cast<AssetType>(entry.Type)));
+				return nullptr;
+		}
+	}
+}
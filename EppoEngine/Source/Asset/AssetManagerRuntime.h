@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Asset/AssetManagerBase.h"
+#include "Asset/AssetPack.h"
+
+#include <mutex>
+
+namespace Eppo
+{
+	// Shipping builds, assets come from mounted packs and nothing is read from the YAML registry
+	class AssetManagerRuntime : public AssetManagerBase
+	{
+	public:
+		// Assets and data of later packs override earlier ones, so patches are mounted last
+		bool MountPack(const std::filesystem::path& filepath);
+
+		bool CreateAsset(Ref<Asset> asset, const std::filesystem::path& filepath) override;
+		Ref<Asset> GetAsset(AssetHandle handle) override;
+
+		[[nodiscard]] bool IsAssetHandleValid(AssetHandle handle) const override;
+		[[nodiscard]] bool IsAssetLoaded(AssetHandle handle) const override;
+		[[nodiscard]] AssetType GetAssetType(AssetHandle handle) const override;
+
+		// Of the last mounted pack that defines one
+		[[nodiscard]] AssetHandle GetStartScene() const;
+
+	private:
+		[[nodiscard]] const AssetPackEntry* FindAsset(AssetHandle handle) const;
+		[[nodiscard]] DerivedData LoadData(const DerivedDataKey& key) const;
+
+		Ref<Asset> LoadAsset(const AssetPackEntry& entry) const;
+
+	private:
+		std::vector<Scope<AssetPack>> m_Packs;
+
+		mutable std::mutex m_AssetsMutex;
+		std::unordered_map<AssetHandle, Ref<Asset>> m_Assets;
+		// Created at runtime, not part of any pack
+		std::unordered_map<AssetHandle, AssetType> m_CreatedAssets;
+	};
+}
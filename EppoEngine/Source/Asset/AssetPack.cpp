@@ -0,0 +1,221 @@
+#include "pch.h"
+#include "AssetPack.h"
+
+#include "Core/Compression.h"
+#include "Platform/MappedFile.h"
+
+namespace Eppo
+{
+	namespace Utils
+	{
+		// Blobs are aligned so cooked data can be read in place
+		static constexpr uint64_t PackAlignment = 16;
+
+		static uint64_t AlignPack(const uint64_t offset)
+		{
+			return (offset + PackAlignment - 1) & ~(PackAlignment - 1);
+		}
+
+		static bool IsInPack(const uint64_t packSize, const uint64_t offset, const uint64_t size)
+		{
+			return offset <= packSize && size <= packSize - offset;
+		}
+	}
+
+	static_assert(std::is_trivially_copyable_v<AssetPackHeader> && std::is_trivially_copyable_v<AssetPackEntry> && std::is_trivially_copyable_v<AssetPackData>);
+
+	AssetPack::AssetPack(const std::filesystem::path& filepath)
+		: m_Filepath(filepath), m_File(CreateRef<MappedFile>(filepath))
+	{
+		EPPO_PROFILE_FUNCTION("AssetPack::AssetPack");
+
+		if (!m_File->IsValid() || m_File->GetSize() < sizeof(AssetPackHeader))
+		{
+			EPPO_ERROR("Failed to open asset pack '{}'!", filepath.string());
+			return;
+		}
+
+		const uint8_t* data = m_File->GetData();
+		const uint64_t size = m_File->GetSize();
+
+		const auto* header = reinterpret_cast<const AssetPackHeader*>(data);
+		if (header->Magic != AssetPackHeader::MagicValue || header->Version != AssetPackHeader::CurrentVersion)
+		{
+			EPPO_ERROR("Asset pack '{}' is not a pack of the current version!", filepath.string());
+			return;
+		}
+
+		if (!Utils::IsInPack(size, header->AssetTableOffset, static_cast<uint64_t>(header->AssetCount) * sizeof(AssetPackEntry))
+			|| !Utils::IsInPack(size, header->DataTableOffset, static_cast<uint64_t>(header->DataCount) * sizeof(AssetPackData)))
+		{
+			EPPO_ERROR("Asset pack '{}' is truncated!", filepath.string());
+			return;
+		}
+
+		m_Header = header;
+		m_Assets = reinterpret_cast<const AssetPackEntry*>(data + header->AssetTableOffset);
+		m_Data = reinterpret_cast<const AssetPackData*>(data + header->DataTableOffset);
+	}
+
+	const AssetPackEntry* AssetPack::FindAsset(const AssetHandle handle) const
+	{
+		if (!m_Header)
+			return nullptr;
+
+		const AssetPackEntry* end = m_Assets + m_Header->AssetCount;
+		const AssetPackEntry* it = std::lower_bound(m_Assets, end, static_cast<uint64_t>(handle), [](const AssetPackEntry& entry, const uint64_t value)
+		{
+			return entry.Handle < value;
+		});
+
+		return it != end && it->Handle == handle ? it : nullptr;
+	}
+
+	const AssetPackData* AssetPack::FindData(const DerivedDataKey& key) const
+	{
+		if (!m_Header)
+			return nullptr;
+
+		const AssetPackData* end = m_Data + m_Header->DataCount;
+		const AssetPackData* it = std::lower_bound(m_Data, end, key.GetValue(), [](const AssetPackData& entry, const uint64_t value)
+		{
+			return entry.Key < value;
+		});
+
+		return it != end && it->Key == key.GetValue() ? it : nullptr;
+	}
+
+	DerivedData AssetPack::LoadData(const DerivedDataKey& key) const
+	{
+		EPPO_PROFILE_FUNCTION("AssetPack::LoadData");
+
+		const AssetPackData* entry = FindData(key);
+		if (!entry || !Utils::IsInPack(m_File->GetSize(), entry->Offset, entry->StoredSize))
+			return {};
+
+		const uint8_t* stored = m_File->GetData() + entry->Offset;
+
+		DerivedData data;
+		data.Size = entry->Size;
+
+		switch (static_cast<AssetPackCompression>(entry->Compression))
+		{
+			case AssetPackCompression::None:
+			{
+				if (entry->StoredSize != entry->Size)
+					return {};
+
+				data.Data = stored;
+				data.Owner = m_File;
+				break;
+			}
+
+			case AssetPackCompression::LZ4:
+			{
+				const auto storage = CreateRef<std::vector<uint8_t>>(entry->Size);
+				if (!Compression::DecompressLZ4(stored, entry->StoredSize, storage->data(), storage->size()))
+				{
+					EPPO_ERROR("Data {} in asset pack '{}' is corrupt!", key.ToString(), m_Filepath.string());
+					return {};
+				}
+
+				data.Data = storage->data();
+				data.Owner = storage;
+				break;
+			}
+
+			default:
+				return {};
+		}
+
+		return data;
+	}
+
+	void AssetPackBuilder::AddAsset(const AssetHandle handle, const AssetType type, const DerivedDataKey& key)
+	{
+		AssetPackEntry& entry = m_Assets[handle];
+		entry.Handle = handle;
+		entry.Key = key.GetValue();
+		entry.Type = static_cast<uint32_t>(type);
+		entry.Reserved = 0;
+	}
+
+	void AssetPackBuilder::AddData(const DerivedDataKey& key, const void* data, const uint64_t size)
+	{
+		if (HasData(key))
+			return;
+
+		const auto* bytes = static_cast<const uint8_t*>(data);
+		m_Data.emplace(key.GetValue(), std::vector<uint8_t>(bytes, bytes + size));
+	}
+
+	bool AssetPackBuilder::Write(const std::filesystem::path& filepath, const bool compress) const
+	{
+		EPPO_PROFILE_FUNCTION("AssetPackBuilder::Write");
+
+		AssetPackHeader header;
+		header.AssetCount = static_cast<uint32_t>(m_Assets.size());
+		header.DataCount = static_cast<uint32_t>(m_Data.size());
+		header.StartScene = m_StartScene;
+
+		std::vector<uint8_t> file(Utils::AlignPack(sizeof(AssetPackHeader)), 0);
+
+		// Maps iterate in key order, which is the order the tables are searched in
+		std::vector<AssetPackData> dataTable;
+		dataTable.reserve(m_Data.size());
+
+		for (const auto& [key, data] : m_Data)
+		{
+			AssetPackData& entry = dataTable.emplace_back();
+			entry.Key = key;
+			entry.Size = data.size();
+			entry.Reserved = 0;
+
+			std::vector<uint8_t> compressed;
+			if (compress)
+				compressed = Compression::CompressLZ4(data.data(), data.size());
+
+			const bool storeCompressed = compress && compressed.size() < data.size();
+			const std::vector<uint8_t>& stored = storeCompressed ? compressed : data;
+
+			entry.Compression = static_cast<uint32_t>(storeCompressed ? AssetPackCompression::LZ4 : AssetPackCompression::None);
+			entry.StoredSize = stored.size();
+
+			file.resize(Utils::AlignPack(file.size()), 0);
+			entry.Offset = file.size();
+			file.insert(file.end(), stored.begin(), stored.end());
+		}
+
+		file.resize(Utils::AlignPack(file.size()), 0);
+		header.AssetTableOffset = file.size();
+		for (const auto& [handle, entry] : m_Assets)
+		{
+			const auto* bytes = reinterpret_cast<const uint8_t*>(&entry);
+			file.insert(file.end(), bytes, bytes + sizeof(AssetPackEntry));
+		}
+
+		file.resize(Utils::AlignPack(file.size()), 0);
+		header.DataTableOffset = file.size();
+		const auto* dataBytes = reinterpret_cast<const uint8_t*>(dataTable.data());
+		file.insert(file.end(), dataBytes, dataBytes + dataTable.size() * sizeof(AssetPackData));
+
+		std::memcpy(file.data(), &header, sizeof(header));
+
+		std::ofstream stream(filepath, std::ios::binary | std::ios::trunc);
+		if (!stream)
+		{
+			EPPO_ERROR("Failed to write asset pack '{}'!", filepath.string());
+			return false;
+		}
+
+		stream.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+		if (!stream)
+		{
+			EPPO_ERROR("Failed to write asset pack '{}'!", filepath.string());
+			return false;
+		}
+
+		EPPO_INFO("Wrote asset pack '{}' ({} assets, {} blobs, {} bytes)", filepath.string(), header.AssetCount, header.DataCount, file.size());
+		return true;
+	}
+}
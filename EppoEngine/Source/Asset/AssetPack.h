@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Asset/Asset.h"
+#include "Asset/DerivedDataCache.h"
+
+namespace Eppo
+{
+	class MappedFile;
+
+	enum class AssetPackCompression : uint32_t
+	{
+		None = 0,
+		LZ4
+	};
+
+	// Layout of .eppak files, all offsets are in bytes from the start of the file
+	struct AssetPackHeader
+	{
+		static constexpr uint32_t MagicValue = 0x4B415045; // "EPAK"
+		static constexpr uint32_t CurrentVersion = 1;
+
+		uint32_t Magic = MagicValue;
+		uint32_t Version = CurrentVersion;
+		uint32_t AssetCount = 0;
+		uint32_t DataCount = 0;
+
+		// Zero when the pack does not define one
+		uint64_t StartScene = 0;
+
+		uint64_t AssetTableOffset = 0;
+		uint64_t DataTableOffset = 0;
+	};
+
+	// Asset table entry, the table is sorted by handle
+	struct AssetPackEntry
+	{
+		uint64_t Handle;
+		// Derived data key of the main blob, further blobs are referenced from inside it
+		uint64_t Key;
+		uint32_t Type;
+		uint32_t Reserved;
+	};
+
+	// Data table entry, the table is sorted by key so assets with equal contents share a blob
+	struct AssetPackData
+	{
+		uint64_t Key;
+		uint64_t Offset;
+		uint64_t Size;
+		uint64_t StoredSize;
+		uint32_t Compression;
+		uint32_t Reserved;
+	};
+
+	// Read-only view of a mapped pack, lookups are binary searches in the tables
+	class AssetPack
+	{
+	public:
+		explicit AssetPack(const std::filesystem::path& filepath);
+
+		[[nodiscard]] bool IsValid() const { return m_Header != nullptr; }
+		[[nodiscard]] const std::filesystem::path& GetFilepath() const { return m_Filepath; }
+		[[nodiscard]] AssetHandle GetStartScene() const { return m_Header ? m_Header->StartScene : 0; }
+
+		[[nodiscard]] const AssetPackEntry* FindAsset(AssetHandle handle) const;
+		[[nodiscard]] const AssetPackData* FindData(const DerivedDataKey& key) const;
+
+		// Stored data points into the mapping, compressed data is decompressed into its own storage
+		[[nodiscard]] DerivedData LoadData(const DerivedDataKey& key) const;
+
+	private:
+		std::filesystem::path m_Filepath;
+		// Shared with the loaded data that points into it
+		Ref<MappedFile> m_File;
+
+		const AssetPackHeader* m_Header = nullptr;
+		const AssetPackEntry* m_Assets = nullptr;
+		const AssetPackData* m_Data = nullptr;
+	};
+
+	// Collects cooked data of assets and writes them as a pack
+	class AssetPackBuilder
+	{
+	public:
+		void SetStartScene(const AssetHandle handle) { m_StartScene = handle; }
+
+		void AddAsset(AssetHandle handle, AssetType type, const DerivedDataKey& key);
+		// Equal keys mean equal contents, so data added under a known key is skipped
+		void AddData(const DerivedDataKey& key, const void* data, uint64_t size);
+		[[nodiscard]] bool HasData(const DerivedDataKey& key) const { return m_Data.find(key.GetValue()) != m_Data.end(); }
+
+		// Blobs only stay compressed when that makes them smaller
+		bool Write(const std::filesystem::path& filepath, bool compress) const;
+
+	private:
+		AssetHandle m_StartScene = 0;
+
+		std::map<uint64_t, AssetPackEntry> m_Assets;
+		std::map<uint64_t, std::vector<uint8_t>> m_Data;
+	};
+}
@@ -0,0 +1,193 @@
+#include "pch.h"
+#include "AssetRegistryJournal.h"
+
+#include "Platform/MappedFile.h"
+
+namespace Eppo
+{
+	namespace Utils
+	{
+		struct RegistryRecord
+		{
+			uint64_t Handle;
+			uint8_t Operation;
+			uint8_t Type;
+			uint16_t FilepathSize;
+			uint32_t Reserved;
+		};
+
+		struct RegistryIndexHeader
+		{
+			static constexpr uint32_t MagicValue = 0x47455245; // "EREG"
+			static constexpr uint32_t CurrentVersion = 1;
+
+			uint32_t Magic = MagicValue;
+			uint32_t Version = CurrentVersion;
+			uint64_t SourceHash = 0;
+			uint64_t Count = 0;
+		};
+
+		static void WriteRecord(std::vector<uint8_t>& buffer, const AssetRegistryOperation operation, const AssetMetadata& metadata)
+		{
+			// Generic form so the same file reads on every platform
+			const std::string filepath = metadata.Filepath.generic_string();
+
+			RegistryRecord record{};
+			record.Handle = metadata.Handle;
+			record.Operation = static_cast<uint8_t>(operation);
+			record.Type = static_cast<uint8_t>(metadata.Type);
+			record.FilepathSize = static_cast<uint16_t>(filepath.size());
+
+			const auto* bytes = reinterpret_cast<const uint8_t*>(&record);
+			buffer.insert(buffer.end(), bytes, bytes + sizeof(RegistryRecord));
+			buffer.insert(buffer.end(), filepath.begin(), filepath.end());
+		}
+
+		// Returns false at the end of the data or on a record cut short
+		static bool ReadRecord(const uint8_t*& ptr, const uint8_t* end, RegistryRecord& record, AssetMetadata& metadata)
+		{
+			if (static_cast<size_t>(end - ptr) < sizeof(RegistryRecord))
+				return false;
+
+			std::memcpy(&record, ptr, sizeof(RegistryRecord));
+			if (static_cast<size_t>(end - ptr) - sizeof(RegistryRecord) < record.FilepathSize)
+				return false;
+
+			ptr += sizeof(RegistryRecord);
+
+			metadata.Handle = record.Handle;
+			metadata.Type = static_cast<AssetType>(record.Type);
+			metadata.Filepath = std::string(reinterpret_cast<const char*>(ptr), record.FilepathSize);
+
+			ptr += record.FilepathSize;
+			return true;
+		}
+	}
+
+	bool AssetRegistryJournal::Append(const std::filesystem::path& filepath, const AssetRegistryOperation operation, const AssetMetadata& metadata)
+	{
+		EPPO_PROFILE_FUNCTION("AssetRegistryJournal::Append");
+
+		std::vector<uint8_t> buffer;
+		Utils::WriteRecord(buffer, operation, metadata);
+
+		std::ofstream stream(filepath, std::ios::binary | std::ios::app);
+		stream.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+		stream.flush();
+
+		return stream.good();
+	}
+
+	uint32_t AssetRegistryJournal::Replay(const std::filesystem::path& filepath, std::map<AssetHandle, AssetMetadata>& registry)
+	{
+		EPPO_PROFILE_FUNCTION("AssetRegistryJournal::Replay");
+
+		std::error_code error;
+		if (!std::filesystem::exists(filepath, error))
+			return 0;
+
+		uint32_t count = 0;
+		size_t completeSize;
+		size_t fileSize;
+
+		{
+			const MappedFile file(filepath);
+			if (!file.IsValid())
+				return 0;
+
+			const uint8_t* ptr = file.GetData();
+			const uint8_t* end = ptr + file.GetSize();
+
+			Utils::RegistryRecord record;
+			AssetMetadata metadata;
+
+			while (Utils::ReadRecord(ptr, end, record, metadata))
+			{
+				if (static_cast<AssetRegistryOperation>(record.Operation) == AssetRegistryOperation::Remove)
+					registry.erase(metadata.Handle);
+				else
+					registry[metadata.Handle] = metadata;
+
+				count++;
+			}
+
+			completeSize = static_cast<size_t>(ptr - file.GetData());
+			fileSize = file.GetSize();
+		}
+
+		// Records appended behind a torn one would never be read, so it is cut off once the mapping is gone
+		if (completeSize != fileSize)
+		{
+			EPPO_WARN("Asset registry journal '{}' ends in an incomplete record, it is dropped", filepath.string());
+
+			std::filesystem::resize_file(filepath, completeSize, error);
+			if (error)
+				EPPO_ERROR("Failed to truncate asset registry journal '{}': {}", filepath.string(), error.message());
+		}
+
+		return count;
+	}
+
+	void AssetRegistryJournal::Clear(const std::filesystem::path& filepath)
+	{
+		std::error_code error;
+		std::filesystem::remove(filepath, error);
+	}
+
+	bool AssetRegistryIndex::Write(const std::filesystem::path& filepath, const uint64_t sourceHash, const std::map<AssetHandle, AssetMetadata>& registry)
+	{
+		EPPO_PROFILE_FUNCTION("AssetRegistryIndex::Write");
+
+		Utils::RegistryIndexHeader header;
+		header.SourceHash = sourceHash;
+		header.Count = registry.size();
+
+		std::vector<uint8_t> buffer(sizeof(header));
+		std::memcpy(buffer.data(), &header, sizeof(header));
+
+		for (const auto& [handle, metadata] : registry)
+			Utils::WriteRecord(buffer, AssetRegistryOperation::Add, metadata);
+
+		std::ofstream stream(filepath, std::ios::binary | std::ios::trunc);
+		stream.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+
+		return stream.good();
+	}
+
+	bool AssetRegistryIndex::Read(const std::filesystem::path& filepath, const uint64_t sourceHash, std::map<AssetHandle, AssetMetadata>& registry)
+	{
+		EPPO_PROFILE_FUNCTION("AssetRegistryIndex::Read");
+
+		std::error_code error;
+		if (!std::filesystem::exists(filepath, error))
+			return false;
+
+		const MappedFile file(filepath);
+		if (!file.IsValid() || file.GetSize() < sizeof(Utils::RegistryIndexHeader))
+			return false;
+
+		Utils::RegistryIndexHeader header;
+		std::memcpy(&header, file.GetData(), sizeof(header));
+
+		if (header.Magic != Utils::RegistryIndexHeader::MagicValue || header.Version != Utils::RegistryIndexHeader::CurrentVersion || header.SourceHash != sourceHash)
+			return false;
+
+		const uint8_t* ptr = file.GetData() + sizeof(header);
+		const uint8_t* end = file.GetData() + file.GetSize();
+
+		std::map<AssetHandle, AssetMetadata> entries;
+		Utils::RegistryRecord record;
+		AssetMetadata metadata;
+
+		for (uint64_t i = 0; i < header.Count; i++)
+		{
+			if (!Utils::ReadRecord(ptr, end, record, metadata))
+				return false;
+
+			entries.emplace_hint(entries.end(), metadata.Handle, metadata);
+		}
+
+		registry = std::move(entries);
+		return true;
+	}
+}
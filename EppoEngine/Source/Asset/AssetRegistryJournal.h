@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Asset/AssetMetadata.h"
+
+#include <map>
+
+namespace Eppo
+{
+	enum class AssetRegistryOperation : uint8_t
+	{
+		Add = 1,
+		Remove
+	};
+
+	// Append-only log of registry changes since the last compaction, one record per change
+	class AssetRegistryJournal
+	{
+	public:
+		static bool Append(const std::filesystem::path& filepath, AssetRegistryOperation operation, const AssetMetadata& metadata);
+		// Applies the records in order and returns how many there were, a torn last record is cut off the file
+		static uint32_t Replay(const std::filesystem::path& filepath, std::map<AssetHandle, AssetMetadata>& registry);
+		static void Clear(const std::filesystem::path& filepath);
+	};
+
+	// Binary snapshot of the registry, valid for the registry file contents it was written from
+	class AssetRegistryIndex
+	{
+	public:
+		static bool Write(const std::filesystem::path& filepath, uint64_t sourceHash, const std::map<AssetHandle, AssetMetadata>& registry);
+		// Fails when there is no index or it was written for different registry contents
+		static bool Read(const std::filesystem::path& filepath, uint64_t sourceHash, std::map<AssetHandle, AssetMetadata>& registry);
+	};
+}
@@ -0,0 +1,121 @@
+#include "pch.h"
+#include "DerivedDataCache.h"
+
+#include "Platform/MappedFile.h"
+
+#include <random>
+
+namespace Eppo
+{
+	DerivedDataKey::DerivedDataKey(const std::string_view type, const uint32_t version)
+		: m_Value(Hash::GenerateXXH64(type.data(), type.size()))
+	{
+		Append(version);
+	}
+
+	DerivedDataKey& DerivedDataKey::Append(const void* data, const size_t size)
+	{
+		m_Value = Hash::GenerateXXH64(data, size, m_Value);
+		return *this;
+	}
+
+	std::string DerivedDataKey::ToString() const
+	{
+		char buffer[17];
+		std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(m_Value));
+
+		return buffer;
+	}
+
+	const std::filesystem::path& DerivedDataCache::GetDirectory()
+	{
+		static const std::filesystem::path directory = []()
+		{
+			if (const char* sharedDirectory = std::getenv("EPPO_DERIVED_DATA_CACHE"); sharedDirectory && *sharedDirectory)
+				return std::filesystem::path(sharedDirectory);
+
+			return std::filesystem::current_path() / "DerivedDataCache";
+		}();
+
+		return directory;
+	}
+
+	std::filesystem::path DerivedDataCache::GetFilepath(const DerivedDataKey& key, const std::string_view extension)
+	{
+		// Fanned out by the first byte so no directory grows too large
+		const std::string name = key.ToString();
+		return GetDirectory() / name.substr(0, 2) / (name + std::string(extension));
+	}
+
+	bool DerivedDataCache::Contains(const DerivedDataKey& key, const std::string_view extension)
+	{
+		std::error_code error;
+		return std::filesystem::exists(GetFilepath(key, extension), error);
+	}
+
+	DerivedData DerivedDataCache::Load(const DerivedDataKey& key, const std::string_view extension)
+	{
+		EPPO_PROFILE_FUNCTION("DerivedDataCache::Load");
+
+		if (!Contains(key, extension))
+			return {};
+
+		const auto file = CreateRef<MappedFile>(GetFilepath(key, extension));
+		if (!file->IsValid())
+			return {};
+
+		DerivedData data;
+		data.Data = file->GetData();
+		data.Size = file->GetSize();
+		data.Owner = file;
+
+		return data;
+	}
+
+	bool DerivedDataCache::Put(const DerivedDataKey& key, const std::string_view extension, const void* data, const uint64_t size)
+	{
+		EPPO_PROFILE_FUNCTION("DerivedDataCache::Put");
+
+		const std::filesystem::path filepath = GetFilepath(key, extension);
+
+		std::error_code error;
+		std::filesystem::create_directories(filepath.parent_path(), error);
+
+		// Unique per writer, also across machines, so readers only ever see complete entries
+		std::random_device random;
+		const uint64_t suffix = (static_cast<uint64_t>(random()) << 32) | random();
+
+		std::filesystem::path tempFilepath = filepath;
+		tempFilepath += "." + std::to_string(suffix) + ".tmp";
+
+		{
+			std::ofstream stream(tempFilepath, std::ios::binary | std::ios::trunc);
+			if (!stream)
+				return false;
+
+			stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+			if (!stream)
+			{
+				stream.close();
+				std::filesystem::remove(tempFilepath, error);
+				return false;
+			}
+		}
+
+		// Equal keys mean equal contents, so losing a race against another writer is fine
+		std::filesystem::rename(tempFilepath, filepath, error);
+		if (error)
+		{
+			std::filesystem::remove(tempFilepath, error);
+			return Contains(key, extension);
+		}
+
+		return true;
+	}
+
+	bool DerivedDataCache::Remove(const DerivedDataKey& key, const std::string_view extension)
+	{
+		std::error_code error;
+		return std::filesystem::remove(GetFilepath(key, extension), error);
+	}
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Core/Hash.h"
+
+#include <string_view>
+
+namespace Eppo
+{
+	// Identifies derived data by what it is made from, equal inputs give equal keys on every machine
+	class DerivedDataKey
+	{
+	public:
+		// The version is bumped whenever the importer producing the data changes its output
+		DerivedDataKey(std::string_view type, uint32_t version);
+		// A key read back from cooked data
+		explicit DerivedDataKey(const uint64_t value) : m_Value(value) {}
+
+		DerivedDataKey& Append(const void* data, size_t size);
+		DerivedDataKey& Append(std::string_view text) { return Append(text.data(), text.size()); }
+
+		template<typename T>
+		DerivedDataKey& Append(const T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Only plain values can be appended to a key!");
+			return Append(&value, sizeof(T));
+		}
+
+		[[nodiscard]] uint64_t GetValue() const { return m_Value; }
+		// Sixteen hexadecimal digits
+		[[nodiscard]] std::string ToString() const;
+
+		bool operator==(const DerivedDataKey& other) const { return m_Value == other.m_Value; }
+		bool operator!=(const DerivedDataKey& other) const { return m_Value != other.m_Value; }
+
+	private:
+		uint64_t m_Value;
+	};
+
+	// Cooked bytes read from the cache or an asset pack, kept alive by the owner
+	struct DerivedData
+	{
+		const uint8_t* Data = nullptr;
+		uint64_t Size = 0;
+		Ref<void> Owner;
+
+		[[nodiscard]] bool IsValid() const { return Data != nullptr; }
+	};
+
+	// Where cooked data is read from, empty data when there is no entry for the key
+	using DerivedDataLoader = std::function<DerivedData(const DerivedDataKey& key, std::string_view extension)>;
+
+	// Content addressed store for cooked data. Entries are immutable and written atomically,
+	// so the directory can be shared between machines through EPPO_DERIVED_DATA_CACHE.
+	class DerivedDataCache
+	{
+	public:
+		static const std::filesystem::path& GetDirectory();
+		static std::filesystem::path GetFilepath(const DerivedDataKey& key, std::string_view extension);
+
+		[[nodiscard]] static bool Contains(const DerivedDataKey& key, std::string_view extension);
+		// Maps the entry, pages are read on first access
+		[[nodiscard]] static DerivedData Load(const DerivedDataKey& key, std::string_view extension);
+		static bool Put(const DerivedDataKey& key, std::string_view extension, const void* data, uint64_t size);
+		static bool Remove(const DerivedDataKey& key, std::string_view extension);
+	};
+}
@@ -2,10 +2,13 @@
 #include "Application.h"
 
 #include "Core/Filesystem.h"
+#include "Core/ThreadPool.h"
 #include "Scripting/ScriptEngine.h"
 
 #include <GLFW/glfw3.h>
 
+#include <charconv>
+
 namespace Eppo
 {
 	Application* Application::s_Instance = nullptr;
@@ -26,6 +29,7 @@ namespace Eppo
 		windowSpec.Width = m_Specification.WindowWidth;
 		windowSpec.Height = m_Specification.WindowHeight;
 		windowSpec.Title = m_Specification.Name;
+		windowSpec.Visible = m_Specification.WindowVisible;
 
 		m_Window = CreateScope<Window>(windowSpec);
 		m_Window->Init();
@@ -33,8 +37,32 @@ namespace Eppo
 
 		// Initialize systems
 		Filesystem::Init();
+		ThreadPool::Init(m_Specification.WorkerThreads);
 		ScriptEngine::Init();
 
+		// Capture the first frames with the built-in profiler, e.g. --profile-frames=100
+		#if defined(EPPO_ENABLE_PROFILER)
+		for (int i = 1; i < m_Specification.CommandLineArgs.Count; i++)
+		{
+			constexpr std::string_view option = "--profile-frames=";
+
+			const std::string_view arg = m_Specification.CommandLineArgs[i];
+			if (arg.substr(0, option.size()) != option)
+				continue;
+
+			const std::string_view value = arg.substr(option.size());
+			uint32_t frameCount = 0;
+			const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), frameCount);
+			if (error != std::errc() || end != value.data() + value.size() || frameCount == 0)
+			{
+				EPPO_WARN("Ignoring invalid frame count '{}' for --profile-frames", value);
+				continue;
+			}
+
+			CPUProfiler::BeginCapture(frameCount);
+		}
+		#endif
+
 		// Add GUI layer
 		m_ImGuiLayer = new ImGuiLayer();
 		PushLayer(m_ImGuiLayer, true);
@@ -48,6 +76,7 @@ namespace Eppo
 			layer->OnDetach();
 
 		ScriptEngine::Shutdown();
+		ThreadPool::Shutdown();
 		// TODO: Remove Renderer::Shutdown();
 		m_Window->Shutdown();
 	}
@@ -118,8 +147,9 @@ namespace Eppo
 
 		while (m_IsRunning)
 		{
-			auto time = static_cast<float>(glfwGetTime());
-			float timestep = time - m_LastFrameTime;
+			// Seconds since start stay in double, a float loses sub-millisecond precision after a few hours
+			const double time = glfwGetTime();
+			const auto timestep = static_cast<float>(time - m_LastFrameTime);
 			m_LastFrameTime = time;
 
 			ExecuteMainThreadQueue();
@@ -39,6 +39,12 @@ namespace Eppo
 		uint32_t WindowWidth = 1600;
 		uint32_t WindowHeight = 900;
 
+		// Hidden windows still render through the swapchain, used for automated runs
+		bool WindowVisible = true;
+
+		// Workers of the engine thread pool, zero picks one per hardware thread
+		uint32_t WorkerThreads = 0;
+
 		ApplicationCommandLineArgs CommandLineArgs;
 	};
 
@@ -82,7 +88,7 @@ namespace Eppo
 
 		bool m_IsRunning = true;
 		bool m_IsMinimized = false;
-		float m_LastFrameTime = 0;
+		double m_LastFrameTime = 0.0;
 
 		static Application* s_Instance;
 		friend int ::main(int argc, char** argv);
@@ -6,9 +6,11 @@
 	#define EPPO_ENABLE_ASSERTS
 	#define EPPO_ENABLE_VERIFY
 	#define EPPO_TRACK_MEMORY
+	#define EPPO_ENABLE_PROFILER
 #elif defined(EPPO_RELEASE)
 	#define EPPO_ENABLE_ASSERTS
 	#define EPPO_ENABLE_VERIFY
+	#define EPPO_ENABLE_PROFILER
 #endif
 
 #define BIT(x) (1 << x)
@@ -0,0 +1,182 @@
+#include "pch.h"
+#include "Compression.h"
+
+namespace Eppo
+{
+	namespace Utils
+	{
+		static constexpr uint32_t LZ4MinMatch = 4;
+		// Matches may not start in the last twelve bytes and the last five bytes are always literals
+		static constexpr size_t LZ4MatchStartLimit = 12;
+		static constexpr size_t LZ4LastLiterals = 5;
+		static constexpr size_t LZ4MaxOffset = 65535;
+		static constexpr uint32_t LZ4HashBits = 16;
+
+		static uint32_t Read32(const uint8_t* ptr)
+		{
+			uint32_t value;
+			std::memcpy(&value, ptr, sizeof(uint32_t));
+			return value;
+		}
+
+		static uint32_t HashLZ4(const uint32_t sequence)
+		{
+			return (sequence * 2654435761u) >> (32 - LZ4HashBits);
+		}
+
+		static void WriteLength(std::vector<uint8_t>& dst, size_t length)
+		{
+			for (; length >= 255; length -= 255)
+				dst.push_back(255);
+			dst.push_back(static_cast<uint8_t>(length));
+		}
+
+		static bool ReadLength(const uint8_t*& ip, const uint8_t* ipEnd, size_t& length)
+		{
+			uint8_t byte;
+			do
+			{
+				if (ip >= ipEnd)
+					return false;
+
+				byte = *ip++;
+				length += byte;
+			} while (byte == 255);
+
+			return true;
+		}
+
+		static void WriteSequence(std::vector<uint8_t>& dst, const uint8_t* literals, const size_t literalLength, const size_t offset, const size_t matchLength)
+		{
+			const size_t matchCode = matchLength - LZ4MinMatch;
+
+			const uint8_t token = static_cast<uint8_t>((std::min<size_t>(literalLength, 15) << 4) | std::min<size_t>(matchCode, 15));
+			dst.push_back(token);
+
+			if (literalLength >= 15)
+				WriteLength(dst, literalLength - 15);
+			dst.insert(dst.end(), literals, literals + literalLength);
+
+			dst.push_back(static_cast<uint8_t>(offset & 0xFF));
+			dst.push_back(static_cast<uint8_t>(offset >> 8));
+
+			if (matchCode >= 15)
+				WriteLength(dst, matchCode - 15);
+		}
+	}
+
+	std::vector<uint8_t> Compression::CompressLZ4(const void* data, const size_t size)
+	{
+		EPPO_PROFILE_FUNCTION("Compression::CompressLZ4");
+
+		const auto* src = static_cast<const uint8_t*>(data);
+		const uint8_t* srcEnd = src + size;
+		const uint8_t* anchor = src;
+
+		std::vector<uint8_t> dst;
+		dst.reserve(size + size / 255 + 16);
+
+		if (size > Utils::LZ4MatchStartLimit)
+		{
+			// Positions are stored plus one, zero marks an empty slot
+			std::vector<uint32_t> table(1u << Utils::LZ4HashBits, 0);
+
+			const uint8_t* matchStartLimit = srcEnd - Utils::LZ4MatchStartLimit;
+			const uint8_t* matchEndLimit = srcEnd - Utils::LZ4LastLiterals;
+
+			// Greedy parse, the first match found is taken
+			const uint8_t* ip = src;
+			while (ip < matchStartLimit)
+			{
+				const uint32_t sequence = Utils::Read32(ip);
+				uint32_t& slot = table[Utils::HashLZ4(sequence)];
+
+				const uint32_t candidate = slot;
+				slot = static_cast<uint32_t>(ip - src) + 1;
+
+				if (candidate == 0 || static_cast<size_t>(ip - src) - (candidate - 1) > Utils::LZ4MaxOffset || Utils::Read32(src + candidate - 1) != sequence)
+				{
+					ip++;
+					continue;
+				}
+
+				const uint8_t* match = src + candidate - 1;
+
+				size_t matchLength = Utils::LZ4MinMatch;
+				while (ip + matchLength < matchEndLimit && ip[matchLength] == match[matchLength])
+					matchLength++;
+
+				Utils::WriteSequence(dst, anchor, ip - anchor, ip - match, matchLength);
+
+				ip += matchLength;
+				anchor = ip;
+			}
+		}
+
+		// The block always ends with a literals only sequence
+		const size_t literalLength = srcEnd - anchor;
+		dst.push_back(static_cast<uint8_t>(std::min<size_t>(literalLength, 15) << 4));
+		if (literalLength >= 15)
+			Utils::WriteLength(dst, literalLength - 15);
+		dst.insert(dst.end(), anchor, srcEnd);
+
+		return dst;
+	}
+
+	bool Compression::DecompressLZ4(const void* source, const size_t sourceSize, void* destination, const size_t destinationSize)
+	{
+		EPPO_PROFILE_FUNCTION("Compression::DecompressLZ4");
+
+		const auto* ip = static_cast<const uint8_t*>(source);
+		const uint8_t* ipEnd = ip + sourceSize;
+
+		auto* dst = static_cast<uint8_t*>(destination);
+		uint8_t* op = dst;
+		uint8_t* opEnd = dst + destinationSize;
+
+		while (ip < ipEnd)
+		{
+			const uint8_t token = *ip++;
+
+			size_t literalLength = token >> 4;
+			if (literalLength == 15 && !Utils::ReadLength(ip, ipEnd, literalLength))
+				return false;
+
+			if (literalLength > static_cast<size_t>(ipEnd - ip) || literalLength > static_cast<size_t>(opEnd - op))
+				return false;
+
+			std::memcpy(op, ip, literalLength);
+			ip += literalLength;
+			op += literalLength;
+
+			// Only the last sequence has no match
+			if (ip == ipEnd)
+				break;
+
+			if (ipEnd - ip < 2)
+				return false;
+
+			const size_t offset = ip[0] | (static_cast<size_t>(ip[1]) << 8);
+			ip += 2;
+
+			if (offset == 0 || offset > static_cast<size_t>(op - dst))
+				return false;
+
+			size_t matchLength = token & 15;
+			if (matchLength == 15 && !Utils::ReadLength(ip, ipEnd, matchLength))
+				return false;
+			matchLength += Utils::LZ4MinMatch;
+
+			if (matchLength > static_cast<size_t>(opEnd - op))
+				return false;
+
+			// Matches may overlap the bytes they produce, so they are copied forward byte by byte
+			const uint8_t* match = op - offset;
+			for (size_t i = 0; i < matchLength; i++)
+				op[i] = match[i];
+			op += matchLength;
+		}
+
+		return op == opEnd;
+	}
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+namespace Eppo
+{
+	class Compression
+	{
+	public:
+		// LZ4 block format, decompresses at memory speed which keeps pack loads IO bound
+		static std::vector<uint8_t> CompressLZ4(const void* data, size_t size);
+		// The destination size has to be the exact uncompressed size, fails on malformed input
+		static bool DecompressLZ4(const void* source, size_t sourceSize, void* destination, size_t destinationSize);
+	};
+}
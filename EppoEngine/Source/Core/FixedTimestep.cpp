@@ -0,0 +1,39 @@
+#include "pch.h"
+#include "FixedTimestep.h"
+
+namespace Eppo
+{
+	FixedTimestep::FixedTimestep(const uint32_t tickRate, const uint32_t maxStepsPerFrame)
+	{
+		SetTickRate(tickRate, maxStepsPerFrame);
+	}
+
+	uint32_t FixedTimestep::Advance(const double frameTime)
+	{
+		m_Accumulator += frameTime;
+
+		const auto steps = static_cast<uint32_t>(std::min(std::floor(m_Accumulator / m_Step), static_cast<double>(m_MaxStepsPerFrame)));
+		m_Accumulator -= static_cast<double>(steps) * m_Step;
+		m_Time += static_cast<double>(steps) * m_Step;
+
+		if (m_Accumulator >= m_Step)
+			m_Accumulator = std::fmod(m_Accumulator, m_Step);
+
+		return steps;
+	}
+
+	void FixedTimestep::Reset()
+	{
+		m_Accumulator = 0.0;
+		m_Time = 0.0;
+	}
+
+	void FixedTimestep::SetTickRate(const uint32_t tickRate, const uint32_t maxStepsPerFrame)
+	{
+		EPPO_ASSERT(tickRate > 0 && maxStepsPerFrame > 0)
+
+		m_TickRate = tickRate;
+		m_MaxStepsPerFrame = maxStepsPerFrame;
+		m_Step = 1.0 / static_cast<double>(tickRate);
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+namespace Eppo
+{
+	// Turns variable frame times into a whole number of fixed steps. The time left over is kept for the next
+	// frame and tells how far between two steps a frame is, so rendering can blend the last two states.
+	class FixedTimestep
+	{
+	public:
+		explicit FixedTimestep(uint32_t tickRate = 60, uint32_t maxStepsPerFrame = 8);
+
+		// Adds the time of a frame and returns the steps to take for it. Frames behind by more than the
+		// maximum drop the extra time, so a slow frame does not make the next ones slower still.
+		uint32_t Advance(double frameTime);
+		void Reset();
+
+		void SetTickRate(uint32_t tickRate, uint32_t maxStepsPerFrame);
+
+		[[nodiscard]] uint32_t GetTickRate() const { return m_TickRate; }
+		[[nodiscard]] uint32_t GetMaxStepsPerFrame() const { return m_MaxStepsPerFrame; }
+		[[nodiscard]] double GetStep() const { return m_Step; }
+		// Time of all steps taken since the last reset
+		[[nodiscard]] double GetTime() const { return m_Time; }
+		// Zero right at the last step, approaching one just before the next
+		[[nodiscard]] float GetAlpha() const { return static_cast<float>(m_Accumulator / m_Step); }
+
+	private:
+		uint32_t m_TickRate;
+		uint32_t m_MaxStepsPerFrame;
+		double m_Step;
+
+		double m_Accumulator = 0.0;
+		double m_Time = 0.0;
+	};
+}
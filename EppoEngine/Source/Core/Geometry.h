@@ -0,0 +1,168 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace Eppo
+{
+	// Axis aligned box, the default one is empty and unions with any box to that box
+	struct AABB
+	{
+		glm::vec3 Min = glm::vec3(std::numeric_limits<float>::max());
+		glm::vec3 Max = glm::vec3(std::numeric_limits<float>::lowest());
+
+		AABB() = default;
+		AABB(const glm::vec3& min, const glm::vec3& max)
+			: Min(min), Max(max)
+		{}
+
+		[[nodiscard]] bool IsValid() const { return Min.x <= Max.x && Min.y <= Max.y && Min.z <= Max.z; }
+
+		[[nodiscard]] glm::vec3 GetCenter() const { return (Min + Max) * 0.5f; }
+		[[nodiscard]] glm::vec3 GetExtents() const { return (Max - Min) * 0.5f; }
+
+		// Half the surface area, enough to compare the cost of boxes
+		[[nodiscard]] float GetArea() const
+		{
+			const glm::vec3 size = Max - Min;
+			return size.x * size.y + size.y * size.z + size.z * size.x;
+		}
+
+		[[nodiscard]] bool Contains(const AABB& other) const
+		{
+			return Min.x <= other.Min.x && Min.y <= other.Min.y && Min.z <= other.Min.z
+				&& Max.x >= other.Max.x && Max.y >= other.Max.y && Max.z >= other.Max.z;
+		}
+
+		[[nodiscard]] bool Overlaps(const AABB& other) const
+		{
+			return Min.x <= other.Max.x && Min.y <= other.Max.y && Min.z <= other.Max.z
+				&& Max.x >= other.Min.x && Max.y >= other.Min.y && Max.z >= other.Min.z;
+		}
+
+		// Box around this box after the transform
+		[[nodiscard]] AABB Transform(const glm::mat4& transform) const
+		{
+			const glm::vec3 center = glm::vec3(transform * glm::vec4(GetCenter(), 1.0f));
+			const glm::vec3 extents = GetExtents();
+
+			glm::vec3 transformedExtents(0.0f);
+			for (int i = 0; i < 3; i++)
+				transformedExtents += glm::abs(glm::vec3(transform[i])) * extents[i];
+
+			return { center - transformedExtents, center + transformedExtents };
+		}
+
+		static AABB Union(const AABB& a, const AABB& b)
+		{
+			return { glm::min(a.Min, b.Min), glm::max(a.Max, b.Max) };
+		}
+	};
+
+	struct Sphere
+	{
+		glm::vec3 Center = glm::vec3(0.0f);
+		float Radius = 0.0f;
+
+		Sphere() = default;
+		Sphere(const glm::vec3& center, const float radius)
+			: Center(center), Radius(radius)
+		{}
+
+		[[nodiscard]] bool Overlaps(const AABB& box) const
+		{
+			const glm::vec3 closest = glm::min(glm::max(Center, box.Min), box.Max);
+			const glm::vec3 offset = closest - Center;
+
+			return glm::dot(offset, offset) <= Radius * Radius;
+		}
+	};
+
+	struct Ray
+	{
+		glm::vec3 Origin = glm::vec3(0.0f);
+		glm::vec3 Direction = glm::vec3(0.0f, 0.0f, -1.0f);
+		// Kept next to the direction so box tests need no divisions
+		glm::vec3 InverseDirection = glm::vec3(std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), -1.0f);
+
+		Ray() = default;
+		Ray(const glm::vec3& origin, const glm::vec3& direction)
+			: Origin(origin), Direction(direction), InverseDirection(1.0f / direction)
+		{}
+
+		// Distance along the ray to where it enters the box, zero when it starts inside
+		[[nodiscard]] bool Intersects(const AABB& box, const float maxDistance, float& distance) const
+		{
+			const glm::vec3 t0 = (box.Min - Origin) * InverseDirection;
+			const glm::vec3 t1 = (box.Max - Origin) * InverseDirection;
+			const glm::vec3 tMin = glm::min(t0, t1);
+			const glm::vec3 tMax = glm::max(t0, t1);
+
+			const float enter = std::max({ tMin.x, tMin.y, tMin.z, 0.0f });
+			const float exit = std::min({ tMax.x, tMax.y, tMax.z, maxDistance });
+			if (enter > exit)
+				return false;
+
+			distance = enter;
+			return true;
+		}
+	};
+
+	enum class Containment : uint8_t
+	{
+		Outside,
+		Intersects,
+		Inside
+	};
+
+	struct Frustum
+	{
+		// Normal in xyz facing inwards and distance in w, points inside have dot(normal, p) + w >= 0
+		std::array<glm::vec4, 6> Planes;
+
+		Frustum() = default;
+
+		// Planes of a projection with depth from zero to one
+		explicit Frustum(const glm::mat4& viewProjection)
+		{
+			const auto row = [&viewProjection](const int i)
+			{
+				return glm::vec4(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+			};
+
+			Planes[0] = row(3) + row(0);
+			Planes[1] = row(3) - row(0);
+			Planes[2] = row(3) + row(1);
+			Planes[3] = row(3) - row(1);
+			Planes[4] = row(2);
+			Planes[5] = row(3) - row(2);
+
+			for (auto& plane : Planes)
+				plane /= glm::length(glm::vec3(plane));
+		}
+
+		[[nodiscard]] Containment Classify(const AABB& box) const
+		{
+			const glm::vec3 center = box.GetCenter();
+			const glm::vec3 extents = box.GetExtents();
+
+			Containment result = Containment::Inside;
+			for (const auto& plane : Planes)
+			{
+				const glm::vec3 normal(plane);
+				const float distance = glm::dot(normal, center) + plane.w;
+				const float radius = glm::dot(glm::abs(normal), extents);
+
+				if (distance < -radius)
+					return Containment::Outside;
+				if (distance < radius)
+					result = Containment::Intersects;
+			}
+
+			return result;
+		}
+	};
+}
@@ -19,6 +19,38 @@ namespace Eppo
 
 			memcpy(ptr, &value, sizeof(uint64_t));
 		}
+
+		static constexpr uint64_t XXH64Prime1 = 0x9E3779B185EBCA87;
+		static constexpr uint64_t XXH64Prime2 = 0xC2B2AE3D27D4EB4F;
+		static constexpr uint64_t XXH64Prime3 = 0x165667B19E3779F9;
+		static constexpr uint64_t XXH64Prime4 = 0x85EBCA77C2B2AE63;
+		static constexpr uint64_t XXH64Prime5 = 0x27D4EB2F165667C5;
+
+		static uint64_t RotateLeft(const uint64_t value, const uint32_t bits)
+		{
+			return (value << bits) | (value >> (64 - bits));
+		}
+
+		template<typename T>
+		static T ReadUnaligned(const uint8_t* ptr)
+		{
+			T value;
+			memcpy(&value, ptr, sizeof(T));
+			return value;
+		}
+
+		static uint64_t XXH64Round(uint64_t accumulator, const uint64_t input)
+		{
+			accumulator += input * XXH64Prime2;
+			accumulator = RotateLeft(accumulator, 31);
+			return accumulator * XXH64Prime1;
+		}
+
+		static uint64_t XXH64MergeRound(uint64_t accumulator, const uint64_t value)
+		{
+			accumulator ^= XXH64Round(0, value);
+			return accumulator * XXH64Prime1 + XXH64Prime4;
+		}
 	}
 
 	uint64_t Hash::GenerateFnv(const std::string& contents)
@@ -54,4 +86,69 @@ namespace Eppo
 
 		return hash;
 	}
+
+	uint64_t Hash::GenerateXXH64(const void* data, const size_t size, const uint64_t seed)
+	{
+		EPPO_PROFILE_FUNCTION("Hash::GenerateXXH64");
+
+		const auto* ptr = static_cast<const uint8_t*>(data);
+		const uint8_t* end = ptr + size;
+
+		uint64_t hash;
+
+		if (size >= 32)
+		{
+			uint64_t v1 = seed + Utils::XXH64Prime1 + Utils::XXH64Prime2;
+			uint64_t v2 = seed + Utils::XXH64Prime2;
+			uint64_t v3 = seed;
+			uint64_t v4 = seed - Utils::XXH64Prime1;
+
+			// Four independent lanes of 8 bytes
+			for (const uint8_t* limit = end - 32; ptr <= limit; ptr += 32)
+			{
+				v1 = Utils::XXH64Round(v1, Utils::ReadUnaligned<uint64_t>(ptr));
+				v2 = Utils::XXH64Round(v2, Utils::ReadUnaligned<uint64_t>(ptr + 8));
+				v3 = Utils::XXH64Round(v3, Utils::ReadUnaligned<uint64_t>(ptr + 16));
+				v4 = Utils::XXH64Round(v4, Utils::ReadUnaligned<uint64_t>(ptr + 24));
+			}
+
+			hash = Utils::RotateLeft(v1, 1) + Utils::RotateLeft(v2, 7) + Utils::RotateLeft(v3, 12) + Utils::RotateLeft(v4, 18);
+			hash = Utils::XXH64MergeRound(hash, v1);
+			hash = Utils::XXH64MergeRound(hash, v2);
+			hash = Utils::XXH64MergeRound(hash, v3);
+			hash = Utils::XXH64MergeRound(hash, v4);
+		}
+		else
+			hash = seed + Utils::XXH64Prime5;
+
+		hash += static_cast<uint64_t>(size);
+
+		for (; ptr + 8 <= end; ptr += 8)
+		{
+			hash ^= Utils::XXH64Round(0, Utils::ReadUnaligned<uint64_t>(ptr));
+			hash = Utils::RotateLeft(hash, 27) * Utils::XXH64Prime1 + Utils::XXH64Prime4;
+		}
+
+		if (ptr + 4 <= end)
+		{
+			hash ^= static_cast<uint64_t>(Utils::ReadUnaligned<uint32_t>(ptr)) * Utils::XXH64Prime1;
+			hash = Utils::RotateLeft(hash, 23) * Utils::XXH64Prime2 + Utils::XXH64Prime3;
+			ptr += 4;
+		}
+
+		for (; ptr < end; ptr++)
+		{
+			hash ^= *ptr * Utils::XXH64Prime5;
+			hash = Utils::RotateLeft(hash, 11) * Utils::XXH64Prime1;
+		}
+
+		// Avalanche
+		hash ^= hash >> 33;
+		hash *= Utils::XXH64Prime2;
+		hash ^= hash >> 29;
+		hash *= Utils::XXH64Prime3;
+		hash ^= hash >> 32;
+
+		return hash;
+	}
 }
@@ -9,5 +9,8 @@ namespace Eppo
 	public:
 		static uint64_t GenerateFnv(const std::string& contents);
 		static uint64_t GenerateFnv(Buffer buffer);
+
+		// XXH64, several GB/s for hashing file contents. Chaining works by passing the previous hash as seed
+		static uint64_t GenerateXXH64(const void* data, size_t size, uint64_t seed = 0);
 	};
 }
@@ -0,0 +1,142 @@
+#include "pch.h"
+#include "JobGraph.h"
+
+#include <optional>
+
+namespace Eppo
+{
+	struct JobGraph::RunState
+	{
+		RunState(const JobGraph& graph, ThreadPool& threadPool)
+			: Graph(graph), Pool(threadPool), PendingDependencies(graph.m_Nodes.size())
+		{
+			for (size_t i = 0; i < graph.m_Nodes.size(); i++)
+				PendingDependencies[i] = graph.m_Nodes[i].DependencyCount;
+		}
+
+		const JobGraph& Graph;
+		ThreadPool& Pool;
+
+		std::vector<std::atomic<uint32_t>> PendingDependencies;
+
+		std::mutex Mutex;
+		std::condition_variable Condition;
+		// Ready jobs, taken by the pool and by the thread running the graph
+		std::queue<JobId> Jobs;
+		std::queue<JobId> MainThreadJobs;
+		uint32_t DoneCount = 0;
+	};
+
+	JobId JobGraph::Add(Job job, const std::vector<JobId>& dependencies, const bool mainThread)
+	{
+		const auto id = static_cast<JobId>(m_Nodes.size());
+
+		Node& node = m_Nodes.emplace_back();
+		node.Fn = std::move(job);
+		node.MainThread = mainThread;
+
+		for (const JobId dependency : dependencies)
+		{
+			EPPO_ASSERT(dependency < id)
+			m_Nodes[dependency].Dependents.push_back(id);
+			node.DependencyCount++;
+		}
+
+		return id;
+	}
+
+	void JobGraph::Run(ThreadPool& threadPool) const
+	{
+		EPPO_PROFILE_FUNCTION("JobGraph::Run");
+
+		const auto jobCount = static_cast<uint32_t>(m_Nodes.size());
+		if (jobCount == 0)
+			return;
+
+		const auto state = CreateRef<RunState>(*this, threadPool);
+
+		for (JobId id = 0; id < jobCount; id++)
+		{
+			if (m_Nodes[id].DependencyCount == 0)
+				Schedule(state, id);
+		}
+
+		// The calling thread runs main thread jobs and helps with the other jobs of this graph until everything
+		// is done. Unrelated jobs on the pool are left alone, they may take far longer than a frame.
+		while (true)
+		{
+			std::optional<JobId> job;
+
+			{
+				std::unique_lock<std::mutex> lock(state->Mutex);
+				state->Condition.wait(lock, [&state, jobCount]()
+				{
+					return state->DoneCount == jobCount || !state->MainThreadJobs.empty() || !state->Jobs.empty();
+				});
+
+				if (state->DoneCount == jobCount)
+					break;
+
+				std::queue<JobId>& jobs = state->MainThreadJobs.empty() ? state->Jobs : state->MainThreadJobs;
+				job = jobs.front();
+				jobs.pop();
+			}
+
+			RunJob(state, *job);
+		}
+	}
+
+	void JobGraph::Clear()
+	{
+		m_Nodes.clear();
+	}
+
+	void JobGraph::Schedule(const Ref<RunState>& state, const JobId id)
+	{
+		const bool mainThread = state->Graph.m_Nodes[id].MainThread;
+
+		{
+			std::scoped_lock<std::mutex> lock(state->Mutex);
+			(mainThread ? state->MainThreadJobs : state->Jobs).push(id);
+			state->Condition.notify_all();
+		}
+
+		if (mainThread || state->Pool.GetThreadCount() == 0)
+			return;
+
+		// The pool job takes whichever job is ready when it starts, or nothing when the thread running the
+		// graph got to them first
+		state->Pool.Submit([state]()
+		{
+			std::optional<JobId> job;
+
+			{
+				std::scoped_lock<std::mutex> lock(state->Mutex);
+				if (state->Jobs.empty())
+					return;
+
+				job = state->Jobs.front();
+				state->Jobs.pop();
+			}
+
+			RunJob(state, *job);
+		});
+	}
+
+	void JobGraph::RunJob(const Ref<RunState>& state, const JobId id)
+	{
+		const Node& node = state->Graph.m_Nodes[id];
+		node.Fn();
+
+		for (const JobId dependent : node.Dependents)
+		{
+			if (--state->PendingDependencies[dependent] == 0)
+				Schedule(state, dependent);
+		}
+
+		// Nothing of the graph is touched after this, Run may return right away
+		std::scoped_lock<std::mutex> lock(state->Mutex);
+		state->DoneCount++;
+		state->Condition.notify_all();
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Core/ThreadPool.h"
+
+namespace Eppo
+{
+	using JobId = uint32_t;
+
+	// Jobs that start once the jobs they depend on are done. The graph is built once and can be run any
+	// number of times, the calling thread takes part and is the only one running main thread jobs. It only
+	// runs jobs of the graph, never other jobs queued on the pool.
+	class JobGraph
+	{
+	public:
+		// Dependencies have to be added before the job depending on them
+		JobId Add(Job job, const std::vector<JobId>& dependencies = {}, bool mainThread = false);
+
+		// Returns when all jobs are done
+		void Run(ThreadPool& threadPool) const;
+		void Clear();
+
+		[[nodiscard]] uint32_t GetJobCount() const { return static_cast<uint32_t>(m_Nodes.size()); }
+
+	private:
+		struct Node
+		{
+			Job Fn;
+			std::vector<JobId> Dependents;
+			uint32_t DependencyCount = 0;
+			bool MainThread = false;
+		};
+
+		// Progress of one run, shared with the jobs in flight
+		struct RunState;
+
+		static void Schedule(const Ref<RunState>& state, JobId id);
+		static void RunJob(const Ref<RunState>& state, JobId id);
+
+	private:
+		std::vector<Node> m_Nodes;
+	};
+}
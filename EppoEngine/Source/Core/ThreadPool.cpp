@@ -0,0 +1,194 @@
+#include "pch.h"
+#include "ThreadPool.h"
+
+namespace Eppo
+{
+	namespace Utils
+	{
+		struct ParallelForState
+		{
+			std::atomic<uint32_t> NextIndex{ 0 };
+			std::atomic<uint32_t> DoneCount{ 0 };
+
+			std::mutex Mutex;
+			std::condition_variable Condition;
+		};
+
+		static void RunParallelFor(ParallelForState& state, const uint32_t count, const std::function<void(uint32_t)>& fn)
+		{
+			for (uint32_t i = state.NextIndex++; i < count; i = state.NextIndex++)
+			{
+				fn(i);
+
+				if (++state.DoneCount == count)
+				{
+					std::scoped_lock<std::mutex> lock(state.Mutex);
+					state.Condition.notify_all();
+				}
+			}
+		}
+	}
+
+	static Scope<ThreadPool> s_ThreadPool;
+
+	// Pool and deque of the worker running on this thread
+	static thread_local const ThreadPool* s_WorkerPool = nullptr;
+	static thread_local uint32_t s_WorkerIndex = 0;
+
+	ThreadPool::ThreadPool(const uint32_t threadCount)
+	{
+		m_Queues.reserve(threadCount + 1);
+		for (uint32_t i = 0; i < threadCount + 1; i++)
+			m_Queues.emplace_back(CreateScope<JobQueue>());
+
+		m_Threads.reserve(threadCount);
+		for (uint32_t i = 0; i < threadCount; i++)
+			m_Threads.emplace_back([this, i]() { WorkerLoop(i); });
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		Stop();
+	}
+
+	void ThreadPool::Stop()
+	{
+		{
+			std::scoped_lock<std::mutex> lock(m_Mutex);
+			m_Stopping = true;
+		}
+
+		m_Condition.notify_all();
+
+		for (auto& thread : m_Threads)
+			thread.join();
+
+		m_Threads.clear();
+	}
+
+	void ThreadPool::Submit(Job job)
+	{
+		const uint32_t queueIndex = s_WorkerPool == this ? s_WorkerIndex : GetThreadCount();
+
+		// Counted first, so the count never drops below the jobs actually queued
+		m_QueuedJobCount++;
+
+		{
+			JobQueue& queue = *m_Queues[queueIndex];
+			std::scoped_lock<std::mutex> lock(queue.Mutex);
+			queue.Jobs.push_back(std::move(job));
+		}
+
+		// Taking the lock orders this with a worker about to sleep, so the wake up is not lost
+		{
+			std::scoped_lock<std::mutex> lock(m_Mutex);
+		}
+
+		m_Condition.notify_one();
+	}
+
+	bool ThreadPool::TryTakeJob(const uint32_t queueIndex, Job& job)
+	{
+		if (m_QueuedJobCount == 0)
+			return false;
+
+		// Newest job of the own deque first, it is the most likely to still be in cache
+		{
+			JobQueue& queue = *m_Queues[queueIndex];
+			std::scoped_lock<std::mutex> lock(queue.Mutex);
+			if (!queue.Jobs.empty())
+			{
+				job = std::move(queue.Jobs.back());
+				queue.Jobs.pop_back();
+				m_QueuedJobCount--;
+				return true;
+			}
+		}
+
+		// Then the oldest job of any other deque, starting at the next one to spread the stealing
+		const auto queueCount = static_cast<uint32_t>(m_Queues.size());
+		for (uint32_t i = 1; i < queueCount; i++)
+		{
+			JobQueue& queue = *m_Queues[(queueIndex + i) % queueCount];
+			std::scoped_lock<std::mutex> lock(queue.Mutex);
+			if (!queue.Jobs.empty())
+			{
+				job = std::move(queue.Jobs.front());
+				queue.Jobs.pop_front();
+				m_QueuedJobCount--;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void ThreadPool::ParallelFor(const uint32_t count, const std::function<void(uint32_t)>& fn)
+	{
+		EPPO_PROFILE_FUNCTION("ThreadPool::ParallelFor");
+
+		if (count == 0)
+			return;
+
+		// Helpers that start after all indices are taken return without touching fn
+		const auto state = CreateRef<Utils::ParallelForState>();
+
+		const uint32_t helperCount = std::min(GetThreadCount(), count - 1);
+		for (uint32_t i = 0; i < helperCount; i++)
+			Submit([state, count, &fn]() { Utils::RunParallelFor(*state, count, fn); });
+
+		Utils::RunParallelFor(*state, count, fn);
+
+		std::unique_lock<std::mutex> lock(state->Mutex);
+		state->Condition.wait(lock, [&state, count]() { return state->DoneCount == count; });
+	}
+
+	uint32_t ThreadPool::GetDefaultThreadCount()
+	{
+		return std::max(std::thread::hardware_concurrency(), 2u) - 1;
+	}
+
+	void ThreadPool::Init(const uint32_t threadCount)
+	{
+		EPPO_ASSERT(!s_ThreadPool)
+		s_ThreadPool = CreateScope<ThreadPool>(threadCount > 0 ? threadCount : GetDefaultThreadCount());
+
+		EPPO_INFO("Thread pool started with {} workers", s_ThreadPool->GetThreadCount());
+	}
+
+	void ThreadPool::Shutdown()
+	{
+		// Jobs still queued may use the pool themselves, so it stays reachable until they are done
+		if (s_ThreadPool)
+			s_ThreadPool->Stop();
+
+		s_ThreadPool.reset();
+	}
+
+	ThreadPool& ThreadPool::Get()
+	{
+		EPPO_ASSERT(s_ThreadPool)
+		return *s_ThreadPool;
+	}
+
+	void ThreadPool::WorkerLoop(const uint32_t workerIndex)
+	{
+		s_WorkerPool = this;
+		s_WorkerIndex = workerIndex;
+
+		while (true)
+		{
+			if (Job job; TryTakeJob(workerIndex, job))
+			{
+				job();
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_Condition.wait(lock, [this]() { return m_Stopping || m_QueuedJobCount > 0; });
+
+			if (m_Stopping && m_QueuedJobCount == 0)
+				return;
+		}
+	}
+}
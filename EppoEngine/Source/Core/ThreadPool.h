@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+
+namespace Eppo
+{
+	using Job = std::function<void()>;
+
+	// Work-stealing pool, every worker has its own deque. Jobs submitted from a worker go to the back of
+	// its deque and are taken from there first, idle workers steal from the front of the others.
+	class ThreadPool
+	{
+	public:
+		// Threads on top of the calling thread, which takes part in ParallelFor as well
+		explicit ThreadPool(uint32_t threadCount);
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		void Submit(Job job);
+
+		// Runs fn on a worker, the future carries its result or exception
+		template<typename F>
+		auto SubmitAsync(F&& fn) -> std::future<std::invoke_result_t<F>>
+		{
+			using Result = std::invoke_result_t<F>;
+
+			auto task = CreateRef<std::packaged_task<Result()>>(std::forward<F>(fn));
+			std::future<Result> future = task->get_future();
+			Submit([task]() { (*task)(); });
+
+			return future;
+		}
+
+		// Calls fn for every index in [0, count) and returns when all calls are done.
+		// The calling thread takes indices as well, so nested calls from jobs cannot deadlock.
+		void ParallelFor(uint32_t count, const std::function<void(uint32_t)>& fn);
+
+		[[nodiscard]] uint32_t GetThreadCount() const { return static_cast<uint32_t>(m_Threads.size()); }
+
+		// One worker less than the hardware threads, leaving one for the calling thread
+		static uint32_t GetDefaultThreadCount();
+
+		// Engine wide pool, owned by the application. Zero uses the default thread count
+		static void Init(uint32_t threadCount = 0);
+		static void Shutdown();
+		static ThreadPool& Get();
+
+	private:
+		struct JobQueue
+		{
+			std::mutex Mutex;
+			std::deque<Job> Jobs;
+		};
+
+		void Stop();
+		void WorkerLoop(uint32_t workerIndex);
+		bool TryTakeJob(uint32_t queueIndex, Job& job);
+
+	private:
+		std::vector<std::thread> m_Threads;
+
+		// One per worker, the last one takes jobs from threads outside the pool
+		std::vector<Scope<JobQueue>> m_Queues;
+		std::atomic<uint32_t> m_QueuedJobCount = 0;
+
+		std::mutex m_Mutex;
+		std::condition_variable m_Condition;
+		bool m_Stopping = false;
+	};
+}
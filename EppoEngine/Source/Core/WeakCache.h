@@ -0,0 +1,61 @@
+#pragma once
+
+#include <mutex>
+
+namespace Eppo
+{
+	// Shares values by key without owning them, a value lives exactly as long as something else holds it.
+	// Entries of released values are dropped whenever the table doubled in size. Safe to use from any thread.
+	template<typename Key, typename T, typename Hasher = std::hash<Key>>
+	class WeakCache
+	{
+	public:
+		[[nodiscard]] Ref<T> Find(const Key& key)
+		{
+			std::scoped_lock<std::mutex> lock(m_Mutex);
+
+			const auto it = m_Entries.find(key);
+			if (it == m_Entries.end())
+				return nullptr;
+
+			return it->second.lock();
+		}
+
+		// Returns the value already shared under the key when there is one, so a value created by two threads
+		// at once still ends up shared. Otherwise the given value is stored and returned.
+		Ref<T> Insert(const Key& key, Ref<T> value)
+		{
+			std::scoped_lock<std::mutex> lock(m_Mutex);
+
+			if (const auto it = m_Entries.find(key); it != m_Entries.end())
+			{
+				if (Ref<T> shared = it->second.lock())
+					return shared;
+			}
+
+			if (m_Entries.size() >= m_CleanupSize)
+			{
+				for (auto it = m_Entries.begin(); it != m_Entries.end();)
+					it = it->second.expired() ? m_Entries.erase(it) : std::next(it);
+
+				m_CleanupSize = std::max<size_t>(MinCleanupSize, m_Entries.size() * 2);
+			}
+
+			m_Entries[key] = value;
+			return value;
+		}
+
+		[[nodiscard]] size_t GetEntryCount()
+		{
+			std::scoped_lock<std::mutex> lock(m_Mutex);
+			return m_Entries.size();
+		}
+
+	private:
+		static constexpr size_t MinCleanupSize = 64;
+
+		std::mutex m_Mutex;
+		std::unordered_map<Key, std::weak_ptr<T>, Hasher> m_Entries;
+		size_t m_CleanupSize = MinCleanupSize;
+	};
+}
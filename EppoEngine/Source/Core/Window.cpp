@@ -41,6 +41,7 @@ namespace Eppo
 		EPPO_INFO("Creating window '{}' ({}x{}@{}Hz)", m_Specification.Title, m_Specification.Width, m_Specification.Height, m_Specification.RefreshRate);
 		glfwWindowHint(GLFW_POSITION_X, 25);
 		glfwWindowHint(GLFW_POSITION_Y, 50);
+		glfwWindowHint(GLFW_VISIBLE, m_Specification.Visible ? GLFW_TRUE : GLFW_FALSE);
 		m_Window = glfwCreateWindow(static_cast<int>(m_Specification.Width), static_cast<int>(m_Specification.Height),
 		                            m_Specification.Title.c_str(), nullptr, nullptr);
 	}
@@ -18,6 +18,8 @@ namespace Eppo
 		
 		// If this is set to true, glfw will override above information with information gathered from the primary monitor
 		bool OverrideSpecification = false;
+
+		bool Visible = true;
 	};
 
 	class Window
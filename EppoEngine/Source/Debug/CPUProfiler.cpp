@@ -0,0 +1,264 @@
+#include "pch.h"
+#include "CPUProfiler.h"
+
+#include "Core/Filesystem.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace Eppo
+{
+	namespace
+	{
+		// Events per thread, older events are overwritten when a capture records more than this
+		constexpr uint64_t s_RingBufferSize = 1 << 16;
+
+		// Atomic, so a capture can copy events while their thread overwrites them. Relaxed accesses compile
+		// to plain loads and stores.
+		struct EventSlot
+		{
+			std::atomic<const char*> Name = nullptr;
+			std::atomic<uint64_t> Begin = 0;
+			std::atomic<uint64_t> End = 0;
+		};
+
+		struct ThreadBuffer
+		{
+			uint32_t ThreadId = 0;
+			std::unique_ptr<EventSlot[]> Events = std::make_unique<EventSlot[]>(s_RingBufferSize);
+
+			// Only written by the owning thread. Events below the head are complete, the reserved count is
+			// raised before a slot is overwritten so a capture can tell which of its copies are torn.
+			std::atomic<uint64_t> Head = 0;
+			std::atomic<uint64_t> Reserved = 0;
+			uint64_t CaptureStart = 0;
+		};
+
+		struct ProfilerData
+		{
+			std::mutex Mutex;
+			std::vector<std::unique_ptr<ThreadBuffer>> ThreadBuffers;
+
+			std::atomic<uint32_t> RequestedFrames = 0;
+			uint32_t FramesRemaining = 0;
+			std::filesystem::path Filepath;
+
+			uint64_t CaptureBegin = 0;
+			std::vector<uint64_t> FrameMarks;
+			std::vector<ProfileEvent> CapturedEvents;
+		};
+
+		ProfilerData& GetData()
+		{
+			static ProfilerData data;
+			return data;
+		}
+
+		thread_local ThreadBuffer* t_ThreadBuffer = nullptr;
+
+		ThreadBuffer* RegisterThread()
+		{
+			ProfilerData& data = GetData();
+			std::scoped_lock<std::mutex> lock(data.Mutex);
+
+			auto& buffer = data.ThreadBuffers.emplace_back(std::make_unique<ThreadBuffer>());
+			buffer->ThreadId = static_cast<uint32_t>(data.ThreadBuffers.size());
+
+			return buffer.get();
+		}
+
+		void WriteEscaped(std::stringstream& ss, const char* str)
+		{
+			for (; *str; str++)
+			{
+				if (*str == '"' || *str == '\\')
+					ss << '\\';
+				ss << *str;
+			}
+		}
+	}
+
+	std::atomic<bool> CPUProfiler::s_Capturing = false;
+
+	void CPUProfiler::BeginCapture(const uint32_t frameCount, const std::filesystem::path& filepath)
+	{
+		if (frameCount == 0 || IsCapturing())
+			return;
+
+		ProfilerData& data = GetData();
+
+		{
+			std::scoped_lock<std::mutex> lock(data.Mutex);
+			data.Filepath = filepath;
+		}
+
+		// The capture starts at the next frame boundary
+		data.RequestedFrames.store(frameCount);
+	}
+
+	void CPUProfiler::EndCapture()
+	{
+		if (!IsCapturing())
+			return;
+
+		s_Capturing.store(false, std::memory_order_release);
+		FinishCapture();
+	}
+
+	void CPUProfiler::NewFrame()
+	{
+		ProfilerData& data = GetData();
+
+		if (IsCapturing())
+		{
+			data.FrameMarks.push_back(GetTimestamp());
+
+			if (--data.FramesRemaining == 0)
+				EndCapture();
+
+			return;
+		}
+
+		if (data.RequestedFrames.load(std::memory_order_relaxed) > 0)
+			StartCapture();
+	}
+
+	bool CPUProfiler::IsCapturePending()
+	{
+		return GetData().RequestedFrames.load(std::memory_order_relaxed) > 0;
+	}
+
+	std::vector<ProfileEvent> CPUProfiler::GetCapturedEvents()
+	{
+		ProfilerData& data = GetData();
+		std::scoped_lock<std::mutex> lock(data.Mutex);
+
+		return data.CapturedEvents;
+	}
+
+	uint32_t CPUProfiler::GetCapturedFrameCount()
+	{
+		ProfilerData& data = GetData();
+		std::scoped_lock<std::mutex> lock(data.Mutex);
+
+		return data.FrameMarks.empty() ? 0 : static_cast<uint32_t>(data.FrameMarks.size() - 1);
+	}
+
+	void CPUProfiler::RecordEvent(const char* name, const uint64_t begin, const uint64_t end)
+	{
+		if (!t_ThreadBuffer)
+			t_ThreadBuffer = RegisterThread();
+
+		const uint64_t head = t_ThreadBuffer->Head.load(std::memory_order_relaxed);
+		t_ThreadBuffer->Reserved.store(head + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		EventSlot& slot = t_ThreadBuffer->Events[head % s_RingBufferSize];
+		slot.Name.store(name, std::memory_order_relaxed);
+		slot.Begin.store(begin, std::memory_order_relaxed);
+		slot.End.store(end, std::memory_order_relaxed);
+
+		t_ThreadBuffer->Head.store(head + 1, std::memory_order_release);
+	}
+
+	uint64_t CPUProfiler::GetTimestamp()
+	{
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+
+	void CPUProfiler::StartCapture()
+	{
+		ProfilerData& data = GetData();
+
+		{
+			std::scoped_lock<std::mutex> lock(data.Mutex);
+
+			for (const auto& buffer : data.ThreadBuffers)
+				buffer->CaptureStart = buffer->Head.load(std::memory_order_acquire);
+
+			data.FramesRemaining = data.RequestedFrames.exchange(0);
+			data.CaptureBegin = GetTimestamp();
+			data.FrameMarks.clear();
+			data.FrameMarks.push_back(data.CaptureBegin);
+		}
+
+		s_Capturing.store(true, std::memory_order_release);
+	}
+
+	void CPUProfiler::FinishCapture()
+	{
+		ProfilerData& data = GetData();
+		std::scoped_lock<std::mutex> lock(data.Mutex);
+
+		// Copy the events of this capture out of the ring buffers
+		data.CapturedEvents.clear();
+		std::vector<std::pair<uint32_t, size_t>> threadRanges;
+
+		for (const auto& buffer : data.ThreadBuffers)
+		{
+			// Threads still finish scopes that began during the capture, they can write while this copies
+			const uint64_t head = buffer->Head.load(std::memory_order_acquire);
+			const uint64_t start = std::max(buffer->CaptureStart, head > s_RingBufferSize ? head - s_RingBufferSize : 0);
+
+			const size_t first = data.CapturedEvents.size();
+			for (uint64_t i = start; i < head; i++)
+			{
+				const EventSlot& slot = buffer->Events[i % s_RingBufferSize];
+				data.CapturedEvents.push_back({ slot.Name.load(std::memory_order_relaxed), slot.Begin.load(std::memory_order_relaxed), slot.End.load(std::memory_order_relaxed) });
+			}
+
+			// Events whose slots were reserved again in the meantime may be torn, they are dropped
+			std::atomic_thread_fence(std::memory_order_acquire);
+			const uint64_t reserved = buffer->Reserved.load(std::memory_order_relaxed);
+			if (reserved > start + s_RingBufferSize)
+			{
+				const uint64_t torn = std::min(reserved - s_RingBufferSize, head) - start;
+				data.CapturedEvents.erase(data.CapturedEvents.begin() + first, data.CapturedEvents.begin() + first + torn);
+			}
+
+			threadRanges.emplace_back(buffer->ThreadId, data.CapturedEvents.size());
+		}
+
+		if (data.Filepath.empty())
+			return;
+
+		const auto toMicroseconds = [&data](const uint64_t timestamp)
+		{
+			return static_cast<double>(timestamp - std::min(timestamp, data.CaptureBegin)) / 1000.0;
+		};
+
+		std::stringstream ss;
+		ss << std::fixed;
+		ss.precision(3);
+
+		ss << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+		ss << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"EppoEngine\"}}";
+
+		for (const uint64_t frameMark : data.FrameMarks)
+			ss << ",\n{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":0,\"ts\":" << toMicroseconds(frameMark) << "}";
+
+		size_t first = 0;
+		for (const auto& [threadId, last] : threadRanges)
+		{
+			if (first != last)
+				ss << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << threadId << ",\"args\":{\"name\":\"Thread " << threadId << "\"}}";
+
+			for (size_t i = first; i < last; i++)
+			{
+				const ProfileEvent& event = data.CapturedEvents[i];
+
+				ss << ",\n{\"name\":\"";
+				WriteEscaped(ss, event.Name);
+				ss << "\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":0,\"tid\":" << threadId;
+				ss << ",\"ts\":" << toMicroseconds(event.Begin) << ",\"dur\":" << static_cast<double>(event.End - event.Begin) / 1000.0 << "}";
+			}
+
+			first = last;
+		}
+
+		ss << "\n]}\n";
+
+		Filesystem::WriteText(data.Filepath, ss.str());
+		EPPO_INFO("Wrote CPU profile with {} events over {} frames to {}", data.CapturedEvents.size(), data.FrameMarks.size() - 1, data.Filepath.string());
+	}
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+
+namespace Eppo
+{
+	struct ProfileEvent
+	{
+		const char* Name = nullptr;
+		uint64_t Begin = 0;
+		uint64_t End = 0;
+	};
+
+	// Records scopes into per thread ring buffers while a capture is running and writes them as a Chrome trace
+	class CPUProfiler
+	{
+	public:
+		// An empty filepath keeps the capture in memory only, see GetCapturedEvents
+		static void BeginCapture(uint32_t frameCount, const std::filesystem::path& filepath = "Profile.json");
+		static void EndCapture();
+		static void NewFrame();
+
+		static bool IsCapturing() { return s_Capturing.load(std::memory_order_relaxed); }
+		static bool IsCapturePending();
+
+		static std::vector<ProfileEvent> GetCapturedEvents();
+		static uint32_t GetCapturedFrameCount();
+
+		static void RecordEvent(const char* name, uint64_t begin, uint64_t end);
+		static uint64_t GetTimestamp();
+
+	private:
+		static void StartCapture();
+		static void FinishCapture();
+
+	private:
+		static std::atomic<bool> s_Capturing;
+	};
+
+	class ProfileScope
+	{
+	public:
+		explicit ProfileScope(const char* name)
+			: m_Name(name), m_Active(CPUProfiler::IsCapturing())
+		{
+			if (m_Active)
+				m_Begin = CPUProfiler::GetTimestamp();
+		}
+
+		~ProfileScope()
+		{
+			if (m_Active)
+				CPUProfiler::RecordEvent(m_Name, m_Begin, CPUProfiler::GetTimestamp());
+		}
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+
+	private:
+		const char* m_Name;
+		bool m_Active;
+		uint64_t m_Begin = 0;
+	};
+}
@@ -1,14 +1,26 @@
 #pragma once
 
+#if defined(EPPO_ENABLE_PROFILER)
+	#include "Debug/CPUProfiler.h"
+
+	#define EPPO_PROFILE_CONCAT_INTERNAL(a, b) a##b
+	#define EPPO_PROFILE_CONCAT(a, b) EPPO_PROFILE_CONCAT_INTERNAL(a, b)
+	#define EPPO_PROFILE_SCOPE_INTERNAL(name) ::Eppo::ProfileScope EPPO_PROFILE_CONCAT(eppoProfileScope, __LINE__)(name)
+	#define EPPO_PROFILE_FRAME_INTERNAL ::Eppo::CPUProfiler::NewFrame()
+#else
+	#define EPPO_PROFILE_SCOPE_INTERNAL(name)
+	#define EPPO_PROFILE_FRAME_INTERNAL
+#endif
+
 #if defined(TRACY_ENABLE)
 	#include <tracy/Tracy.hpp>
-	#define EPPO_PROFILE_FUNCTION(name) ZoneScopedN(name)
-	#define EPPO_PROFILE_FRAME_MARK FrameMark
+	#define EPPO_PROFILE_FUNCTION(name) ZoneScopedN(name); EPPO_PROFILE_SCOPE_INTERNAL(name)
+	#define EPPO_PROFILE_FRAME_MARK FrameMark; EPPO_PROFILE_FRAME_INTERNAL
 	#define EPPO_PROFILE_GPU(context, cmd, name) TracyVkZone(context, cmd, name)
 	#define EPPO_PROFILE_GPU_END(context, cmd) TracyVkCollect(context, cmd)
 #else
-	#define EPPO_PROFILE_FUNCTION(name)
-	#define EPPO_PROFILE_FRAME_MARK
+	#define EPPO_PROFILE_FUNCTION(name) EPPO_PROFILE_SCOPE_INTERNAL(name)
+	#define EPPO_PROFILE_FRAME_MARK EPPO_PROFILE_FRAME_INTERNAL
 	#define EPPO_PROFILE_GPU(context, cmd, name)
 	#define EPPO_PROFILE_GPU_END(context, cmd)
 #endif
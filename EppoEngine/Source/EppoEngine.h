@@ -8,19 +8,28 @@
 #include "Asset/AssetManager.h"
 #include "Asset/AssetManagerBase.h"
 #include "Asset/AssetManagerEditor.h"
+#include "Asset/AssetManagerRuntime.h"
 #include "Asset/AssetMetadata.h"
+#include "Asset/AssetPack.h"
+#include "Asset/DerivedDataCache.h"
 
 // Core
 #include "Core/Application.h"
 #include "Core/Buffer.h"
+#include "Core/Compression.h"
 #include "Core/Filesystem.h"
+#include "Core/FixedTimestep.h"
+#include "Core/Geometry.h"
 #include "Core/Hash.h"
 #include "Core/Input.h"
+#include "Core/JobGraph.h"
 #include "Core/KeyCodes.h"
 #include "Core/Layer.h"
 #include "Core/MouseCodes.h"
 #include "Core/Ref.h"
+#include "Core/ThreadPool.h"
 #include "Core/UUID.h"
+#include "Core/WeakCache.h"
 
 // Events
 #include "Event/ApplicationEvent.h"
@@ -37,10 +46,14 @@
 // Renderer
 #include "Renderer/Camera/EditorCamera.h"
 #include "Renderer/Mesh/Mesh.h"
+#include "Renderer/Mesh/MeshCooker.h"
+#include "Renderer/DynamicResolution.h"
+#include "Renderer/GPUProfiler.h"
 #include "Renderer/Image.h"
 #include "Renderer/IndexBuffer.h"
 #include "Renderer/SceneRenderer.h"
 #include "Renderer/Shader.h"
+#include "Renderer/Texture.h"
 #include "Renderer/UniformBuffer.h"
 #include "Renderer/VertexBuffer.h"
 
@@ -48,6 +61,8 @@
 #include "Scene/Entity.h"
 #include "Scene/Scene.h"
 #include "Scene/SceneSerializer.h"
+#include "Scene/SpatialIndex.h"
+#include "Scene/SystemScheduler.h"
 
 // Scripting
 #include "Scripting/ScriptEngine.h"
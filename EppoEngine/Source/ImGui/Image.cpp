@@ -28,6 +28,22 @@ namespace Eppo::UI
 		}
 	}
 
+	void RemoveImage(const Ref<Eppo::Image>& image)
+	{
+		const auto vkImage = std::dynamic_pointer_cast<VulkanImage>(image);
+		if (!vkImage)
+			return;
+
+		const auto& imageInfo = vkImage->GetImageInfo();
+
+		if (const auto it = s_ImageCache.find(imageInfo.ImageView);
+			it != s_ImageCache.end())
+		{
+			ImGui_ImplVulkan_RemoveTexture(it->second.DescriptorSet);
+			s_ImageCache.erase(it);
+		}
+	}
+
 	void Image(const Ref<Eppo::Image>& image, const ImVec2& imageSize, const ImVec2& uv0, const ImVec2& uv1)
 	{
 		const auto vkImage = std::dynamic_pointer_cast<VulkanImage>(image);
@@ -7,6 +7,7 @@
 namespace Eppo::UI
 {
 	void ClearResources();
+	void RemoveImage(const Ref<Eppo::Image>& image);
 	void Image(const Ref<Eppo::Image>& image, const ImVec2& imageSize, const ImVec2& uv0 = ImVec2(0.0f, 0.0f), const ImVec2& uv1 = ImVec2(1.0f, 1.0f));
 	bool ImageButton(const std::string& id, const Ref<Eppo::Image>& image, const ImVec2& imageSize, const ImVec2& uv0 = ImVec2(0.0f, 0.0f), const ImVec2& uv1 = ImVec2(1.0f, 1.0f));
 	bool ImageButton(const Ref<Eppo::Image>& image, const ImVec2& imageSize, const ImVec2& uv0 = ImVec2(0.0f, 0.0f), const ImVec2& uv1 = ImVec2(1.0f, 1.0f));
@@ -0,0 +1,291 @@
+#include "pch.h"
+#include "PhysicsWorld.h"
+
+#include <bullet/btBulletDynamicsCommon.h>
+
+namespace Eppo
+{
+	namespace Utils
+	{
+		static glm::vec3 BulletToGlm(const btVector3& v)
+		{
+			return { v.getX(), v.getY(), v.getZ() };
+		}
+
+		static btVector3 GlmToBullet(const glm::vec3& v)
+		{
+			return { v.x, v.y, v.z };
+		}
+
+		static btQuaternion GlmToBullet(const glm::quat& q)
+		{
+			return { q.x, q.y, q.z, q.w };
+		}
+	}
+
+	// Bullet only hands new transforms to the motion states of active bodies, which makes them the list of
+	// bodies to sync
+	ATTRIBUTE_ALIGNED16(class) PhysicsMotionState : public btMotionState
+	{
+	public:
+		BT_DECLARE_ALIGNED_ALLOCATOR();
+
+		PhysicsMotionState(PhysicsWorld& world, const entt::entity entity, const btTransform& transform)
+			: m_World(world), m_Entity(entity), m_Transform(transform)
+		{}
+
+		[[nodiscard]] entt::entity GetEntity() const { return m_Entity; }
+
+		void getWorldTransform(btTransform& worldTransform) const override
+		{
+			worldTransform = m_Transform;
+		}
+
+		void setWorldTransform(const btTransform& worldTransform) override
+		{
+			m_Transform = worldTransform;
+
+			PhysicsPose& pose = m_World.m_MovedBodies.emplace_back();
+			pose.Entity = m_Entity;
+			pose.Translation = Utils::BulletToGlm(worldTransform.getOrigin());
+			worldTransform.getRotation().getEulerZYX(pose.Rotation.z, pose.Rotation.y, pose.Rotation.x);
+		}
+
+	private:
+		PhysicsWorld& m_World;
+		entt::entity m_Entity;
+		btTransform m_Transform;
+	};
+
+	PhysicsWorld::PhysicsWorld(const bool threaded)
+	{
+		EPPO_PROFILE_FUNCTION("PhysicsWorld::PhysicsWorld");
+
+		m_CollisionConfiguration = CreateScope<btDefaultCollisionConfiguration>();
+		m_Dispatcher = CreateScope<btCollisionDispatcher>(m_CollisionConfiguration.get());
+		m_Broadphase = CreateScope<btDbvtBroadphase>();
+		m_Solver = CreateScope<btSequentialImpulseConstraintSolver>();
+
+		m_World = CreateScope<btDiscreteDynamicsWorld>(m_Dispatcher.get(), m_Broadphase.get(), m_Solver.get(), m_CollisionConfiguration.get());
+		m_World->setGravity(btVector3(0.0f, -9.81f, 0.0f));
+
+		if (threaded)
+			m_Thread = std::thread(&PhysicsWorld::ThreadLoop, this);
+	}
+
+	PhysicsWorld::~PhysicsWorld()
+	{
+		EPPO_PROFILE_FUNCTION("PhysicsWorld::~PhysicsWorld");
+
+		if (m_Thread.joinable())
+		{
+			{
+				std::scoped_lock<std::mutex> lock(m_StepMutex);
+				m_Stopping = true;
+			}
+
+			m_StepCondition.notify_all();
+			m_Thread.join();
+		}
+
+		for (int i = m_World->getNumCollisionObjects() - 1; i >= 0; i--)
+			RemoveBody(btRigidBody::upcast(m_World->getCollisionObjectArray()[i]));
+
+		// Shapes are owned by the cache, they go after the bodies using them
+		m_World.reset();
+		m_BoxShapes.clear();
+	}
+
+	btRigidBody* PhysicsWorld::AddBody(const entt::entity entity, const glm::vec3& translation, const glm::quat& rotation, const glm::vec3& halfExtents, const float mass)
+	{
+		EPPO_PROFILE_FUNCTION("PhysicsWorld::AddBody");
+
+		WaitForStep();
+
+		btCollisionShape* shape = GetBoxShape(halfExtents);
+
+		btTransform transform;
+		transform.setIdentity();
+		transform.setOrigin(Utils::GlmToBullet(translation));
+		transform.setRotation(Utils::GlmToBullet(rotation));
+
+		auto localInertia(btVector3(0.0f, 0.0f, 0.0f));
+		if (mass > 0.0f)
+			shape->calculateLocalInertia(mass, localInertia);
+
+		auto* motionState = new PhysicsMotionState(*this, entity, transform);
+		const btRigidBody::btRigidBodyConstructionInfo rbInfo(mass, motionState, shape, localInertia);
+		auto* body = new btRigidBody(rbInfo);
+
+		m_World->addRigidBody(body);
+
+		return body;
+	}
+
+	void PhysicsWorld::RemoveBody(btRigidBody* body)
+	{
+		EPPO_PROFILE_FUNCTION("PhysicsWorld::RemoveBody");
+
+		// Queued impulses may still point at the body
+		WaitForStep();
+		ExecuteCommands();
+
+		// Nor may the poses waiting to be synced
+		const entt::entity entity = static_cast<PhysicsMotionState*>(body->getMotionState())->GetEntity();
+		const auto isBody = [entity](const PhysicsPose& pose) { return pose.Entity == entity; };
+		m_MovedBodies.erase(std::remove_if(m_MovedBodies.begin(), m_MovedBodies.end(), isBody), m_MovedBodies.end());
+		m_PublishedBodies.erase(std::remove_if(m_PublishedBodies.begin(), m_PublishedBodies.end(), isBody), m_PublishedBodies.end());
+
+		m_World->removeRigidBody(body);
+
+		delete body->getMotionState();
+		delete body;
+	}
+
+	void PhysicsWorld::ApplyImpulse(btRigidBody* body, const glm::vec3& impulse, const glm::vec3& worldPosition)
+	{
+		EPPO_PROFILE_FUNCTION("PhysicsWorld::ApplyImpulse");
+
+		const auto fn = [body, impulse, worldPosition]()
+		{
+			// Sleeping bodies are not simulated, so they are woken up to respond
+			body->activate();
+			body->applyImpulse(Utils::GlmToBullet(impulse), Utils::GlmToBullet(worldPosition));
+		};
+
+		if (!IsThreaded())
+		{
+			fn();
+			return;
+		}
+
+		std::scoped_lock<std::mutex> lock(m_CommandMutex);
+		m_CommandQueue.AddCommand(fn);
+	}
+
+	void PhysicsWorld::ApplyCentralImpulse(btRigidBody* body, const glm::vec3& impulse)
+	{
+		EPPO_PROFILE_FUNCTION("PhysicsWorld::ApplyCentralImpulse");
+
+		const auto fn = [body, impulse]()
+		{
+			body->activate();
+			body->applyCentralImpulse(Utils::GlmToBullet(impulse));
+		};
+
+		if (!IsThreaded())
+		{
+			fn();
+			return;
+		}
+
+		std::scoped_lock<std::mutex> lock(m_CommandMutex);
+		m_CommandQueue.AddCommand(fn);
+	}
+
+	void PhysicsWorld::Step(const float timestep)
+	{
+		EPPO_PROFILE_FUNCTION("PhysicsWorld::Step");
+
+		if (!IsThreaded())
+		{
+			SimulateStep(timestep);
+			std::swap(m_MovedBodies, m_PublishedBodies);
+			return;
+		}
+
+		// The step started by the last call is published, and the next one starts right away
+		WaitForStep();
+		std::swap(m_MovedBodies, m_PublishedBodies);
+		ExecuteCommands();
+
+		{
+			std::scoped_lock<std::mutex> lock(m_StepMutex);
+			m_StepTimestep = timestep;
+			m_StepRequested = true;
+		}
+
+		m_StepCondition.notify_all();
+	}
+
+	void PhysicsWorld::SimulateStep(const float timestep)
+	{
+		EPPO_PROFILE_FUNCTION("PhysicsWorld::SimulateStep");
+
+		m_MovedBodies.clear();
+
+		// Steps are fixed already, without substeps Bullet takes exactly one step of that size
+		m_World->stepSimulation(timestep, 0);
+	}
+
+	void PhysicsWorld::ThreadLoop()
+	{
+		while (true)
+		{
+			float timestep;
+
+			{
+				std::unique_lock<std::mutex> lock(m_StepMutex);
+				m_StepCondition.wait(lock, [this]() { return m_StepRequested || m_Stopping; });
+
+				if (m_Stopping)
+					return;
+
+				timestep = m_StepTimestep;
+			}
+
+			SimulateStep(timestep);
+
+			{
+				std::scoped_lock<std::mutex> lock(m_StepMutex);
+				m_StepRequested = false;
+			}
+
+			m_StepCondition.notify_all();
+		}
+	}
+
+	void PhysicsWorld::WaitForStep()
+	{
+		if (!IsThreaded())
+			return;
+
+		EPPO_PROFILE_FUNCTION("PhysicsWorld::WaitForStep");
+
+		std::unique_lock<std::mutex> lock(m_StepMutex);
+		m_StepCondition.wait(lock, [this]() { return !m_StepRequested; });
+	}
+
+	void PhysicsWorld::ExecuteCommands()
+	{
+		EPPO_PROFILE_FUNCTION("PhysicsWorld::ExecuteCommands");
+
+		std::scoped_lock<std::mutex> lock(m_CommandMutex);
+		m_CommandQueue.Execute();
+	}
+
+	uint32_t PhysicsWorld::GetBodyCount() const
+	{
+		return static_cast<uint32_t>(m_World->getNumCollisionObjects());
+	}
+
+	btCollisionShape* PhysicsWorld::GetBoxShape(const glm::vec3& halfExtents)
+	{
+		auto& shape = m_BoxShapes[halfExtents];
+		if (!shape)
+			shape = CreateScope<btBoxShape>(Utils::GlmToBullet(halfExtents));
+
+		return shape.get();
+	}
+
+	size_t PhysicsWorld::ShapeKeyHash::operator()(const glm::vec3& halfExtents) const
+	{
+		const std::hash<float> hash;
+
+		size_t seed = hash(halfExtents.x);
+		seed ^= hash(halfExtents.y) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+		seed ^= hash(halfExtents.z) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+
+		return seed;
+	}
+}
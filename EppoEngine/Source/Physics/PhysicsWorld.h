@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Renderer/CommandQueue.h"
+
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+class btBroadphaseInterface;
+class btCollisionDispatcher;
+class btCollisionShape;
+class btDefaultCollisionConfiguration;
+class btDiscreteDynamicsWorld;
+class btRigidBody;
+class btSequentialImpulseConstraintSolver;
+
+namespace Eppo
+{
+	struct PhysicsPose
+	{
+		entt::entity Entity = entt::null;
+		glm::vec3 Translation = glm::vec3(0.0f);
+		// Euler angles, as the transform component keeps them
+		glm::vec3 Rotation = glm::vec3(0.0f);
+	};
+
+	// Bullet world of a running scene. After each step it lists only the bodies Bullet moved, sleeping and
+	// static bodies are left out. Bodies of the same size share their collision shape.
+	//
+	// A threaded world steps on a thread of its own, one step ahead of the scene: a step starts when Step
+	// returns and its poses are published by the next call to Step. Impulses are queued until the thread is
+	// between steps. The other functions are not called concurrently with each other, the scene runs them
+	// one system at a time.
+	class PhysicsWorld
+	{
+	public:
+		explicit PhysicsWorld(bool threaded = false);
+		~PhysicsWorld();
+
+		PhysicsWorld(const PhysicsWorld&) = delete;
+		PhysicsWorld& operator=(const PhysicsWorld&) = delete;
+
+		// Box shaped body, a mass of zero makes it static
+		btRigidBody* AddBody(entt::entity entity, const glm::vec3& translation, const glm::quat& rotation, const glm::vec3& halfExtents, float mass);
+		void RemoveBody(btRigidBody* body);
+
+		void ApplyImpulse(btRigidBody* body, const glm::vec3& impulse, const glm::vec3& worldPosition);
+		void ApplyCentralImpulse(btRigidBody* body, const glm::vec3& impulse);
+
+		void Step(float timestep);
+
+		// Poses of the bodies that moved in the last published step
+		[[nodiscard]] const std::vector<PhysicsPose>& GetMovedBodies() const { return m_PublishedBodies; }
+
+		[[nodiscard]] bool IsThreaded() const { return m_Thread.joinable(); }
+
+		[[nodiscard]] uint32_t GetBodyCount() const;
+		[[nodiscard]] uint32_t GetShapeCount() const { return static_cast<uint32_t>(m_BoxShapes.size()); }
+
+	private:
+		btCollisionShape* GetBoxShape(const glm::vec3& halfExtents);
+
+		void SimulateStep(float timestep);
+		void ThreadLoop();
+		// Returns once the thread is between steps, so the world may be touched
+		void WaitForStep();
+		void ExecuteCommands();
+
+		struct ShapeKeyHash
+		{
+			size_t operator()(const glm::vec3& halfExtents) const;
+		};
+
+	private:
+		Scope<btDefaultCollisionConfiguration> m_CollisionConfiguration;
+		Scope<btCollisionDispatcher> m_Dispatcher;
+		Scope<btBroadphaseInterface> m_Broadphase;
+		Scope<btSequentialImpulseConstraintSolver> m_Solver;
+		Scope<btDiscreteDynamicsWorld> m_World;
+
+		std::unordered_map<glm::vec3, Scope<btCollisionShape>, ShapeKeyHash> m_BoxShapes;
+
+		// Filled by the motion states of the bodies while Bullet steps, swapped with the published ones after
+		std::vector<PhysicsPose> m_MovedBodies;
+		std::vector<PhysicsPose> m_PublishedBodies;
+
+		CommandQueue m_CommandQueue;
+		std::mutex m_CommandMutex;
+
+		std::thread m_Thread;
+		std::mutex m_StepMutex;
+		std::condition_variable m_StepCondition;
+		float m_StepTimestep = 0.0f;
+		bool m_StepRequested = false;
+		bool m_Stopping = false;
+
+		friend class PhysicsMotionState;
+	};
+}
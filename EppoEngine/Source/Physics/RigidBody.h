@@ -6,10 +6,13 @@ class btRigidBody;
 
 namespace Eppo
 {
+	class PhysicsWorld;
+
+	// Handle to the body of an entity in the physics world of its running scene
 	class RigidBody
 	{
 	public:
-		explicit RigidBody(btRigidBody* body);
+		RigidBody(PhysicsWorld* world, btRigidBody* body);
 		RigidBody() = default;
 
 		void ApplyLinearImpulse(const glm::vec3& impulse, const glm::vec3& worldPosition) const;
@@ -20,6 +23,7 @@ namespace Eppo
 		void ClearBody();
 
 	private:
-		btRigidBody* m_Body;
+		PhysicsWorld* m_World = nullptr;
+		btRigidBody* m_Body = nullptr;
 	};
 }
@@ -0,0 +1,39 @@
+#include "pch.h"
+#include "Platform/MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Eppo
+{
+	MappedFile::MappedFile(const std::filesystem::path& filepath)
+	{
+		EPPO_PROFILE_FUNCTION("MappedFile::MappedFile");
+
+		const int fd = open(filepath.c_str(), O_RDONLY);
+		if (fd < 0)
+			return;
+
+		// The mapping keeps its own reference to the file
+		struct stat fileStat{};
+		if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+		{
+			void* data = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			if (data != MAP_FAILED)
+			{
+				m_Data = static_cast<const uint8_t*>(data);
+				m_Size = static_cast<size_t>(fileStat.st_size);
+			}
+		}
+
+		close(fd);
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if (m_Data)
+			munmap(const_cast<uint8_t*>(m_Data), m_Size);
+	}
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <filesystem>
+
+namespace Eppo
+{
+	// Read-only memory mapping of a whole file, pages are loaded by the OS on first access
+	class MappedFile
+	{
+	public:
+		explicit MappedFile(const std::filesystem::path& filepath);
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		[[nodiscard]] bool IsValid() const { return m_Data != nullptr; }
+		[[nodiscard]] const uint8_t* GetData() const { return m_Data; }
+		[[nodiscard]] size_t GetSize() const { return m_Size; }
+
+	private:
+		const uint8_t* m_Data = nullptr;
+		size_t m_Size = 0;
+
+		// Platform handles that have to stay open while mapped
+		void* m_FileHandle = nullptr;
+		void* m_MappingHandle = nullptr;
+	};
+}
@@ -116,4 +116,15 @@ namespace Eppo
 	{
 		vmaUnmapMemory(s_Data->Allocator, allocation);
 	}
+
+	uint64_t VulkanAllocator::GetAllocationSize(const VmaAllocation allocation)
+	{
+		if (!allocation)
+			return 0;
+
+		VmaAllocationInfo allocationInfo{};
+		vmaGetAllocationInfo(s_Data->Allocator, allocation, &allocationInfo);
+
+		return allocationInfo.size;
+	}
 }
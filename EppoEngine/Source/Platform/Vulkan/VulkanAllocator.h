@@ -18,5 +18,8 @@ namespace Eppo
 
 		static void* MapMemory(VmaAllocation allocation);
 		static void UnmapMemory(VmaAllocation allocation);
+
+		// Size of the memory backing the allocation, which can exceed the requested size
+		static uint64_t GetAllocationSize(VmaAllocation allocation);
 	};
 }
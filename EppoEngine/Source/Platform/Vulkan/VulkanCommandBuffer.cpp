@@ -60,9 +60,12 @@ namespace Eppo
 			vkCmdResetQueryPool(commandBuffer, queryPool, 0, m_QueryCount);
 		}
 
+		// Every result is followed by its availability value
 		m_Timestamps.resize(VulkanConfig::MaxFramesInFlight);
 		for (auto& timestamp : m_Timestamps)
-			timestamp.resize(m_QueryCount);
+			timestamp.resize(m_QueryCount * 2);
+
+		m_WrittenQueryCounts.resize(VulkanConfig::MaxFramesInFlight, 0);
 
 		m_TimestampDeltas.resize(VulkanConfig::MaxFramesInFlight);
 		for (auto& timestamp : m_TimestampDeltas)
@@ -118,6 +121,9 @@ namespace Eppo
 			commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
 			commandBufferBeginInfo.pNext = nullptr;
 
+			// The fence of this frame slot has been waited on, so the queries of its previous use can be read before resetting them
+			RT_ResolveQueries(frameIndex);
+
 			VK_CHECK(vkBeginCommandBuffer(m_CommandBuffers[frameIndex], &commandBufferBeginInfo), "Failed to begin command buffer!")
 
 			vkCmdResetQueryPool(m_CommandBuffers[frameIndex], m_QueryPools[frameIndex], 0, m_QueryCount);
@@ -130,8 +136,10 @@ namespace Eppo
 
 	void VulkanCommandBuffer::RT_End()
 	{
+		const uint32_t queryCount = m_QueryIndex;
+
 		const auto renderer = VulkanContext::Get()->GetRenderer();
-		renderer->SubmitCommand([this]()
+		renderer->SubmitCommand([this, queryCount]()
 		{
 			const auto context = VulkanContext::Get();
 			const uint32_t frameIndex = context->GetCurrentFrameIndex();
@@ -141,24 +149,7 @@ namespace Eppo
 
 			VK_CHECK(vkEndCommandBuffer(m_CommandBuffers[frameIndex]), "Failed to end command buffer!")
 
-			// Statistics
-			const auto physicalDevice = context->GetPhysicalDevice();
-			const VkDevice device = context->GetLogicalDevice()->GetNativeDevice();
-			vkGetQueryPoolResults(device, m_QueryPools[frameIndex], 0, m_QueryCount, sizeof(uint64_t) * m_QueryCount, m_Timestamps[frameIndex].data(), sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
-
-			for (uint32_t i = 0; i < m_QueryIndex; i += 2)
-			{
-				const uint64_t begin = m_Timestamps[frameIndex][i];
-				const uint64_t end = m_Timestamps[frameIndex][i + 1];
-
-				float delta = 0.0f;
-				if (end > begin)
-					delta = (end - begin) * physicalDevice->GetDeviceProperties().limits.timestampPeriod * 0.000001f;
-
-				m_TimestampDeltas[frameIndex][i / 2] = delta;
-			}
-
-			vkGetQueryPoolResults(device, m_PipelineQueryPools[frameIndex], 0, 1, sizeof(PipelineStatistics), &m_PipelineStatistics[frameIndex], sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+			m_WrittenQueryCounts[frameIndex] = queryCount;
 		});
 	}
 
@@ -219,13 +210,66 @@ namespace Eppo
 		});
 	}
 
-	float VulkanCommandBuffer::GetTimestamp(const uint32_t frameIndex, const uint32_t queryIndex) const
+	float VulkanCommandBuffer::GetTimestamp(const uint32_t queryIndex) const
 	{
-		const auto& timing = m_TimestampDeltas[frameIndex];
+		const auto& timing = m_TimestampDeltas[m_ResolvedFrameIndex];
 
 		return timing[queryIndex / 2];
 	}
 
+	void VulkanCommandBuffer::RT_ResolveQueries(const uint32_t frameIndex)
+	{
+		EPPO_PROFILE_FUNCTION("VulkanCommandBuffer::RT_ResolveQueries");
+
+		const uint32_t queryCount = m_WrittenQueryCounts[frameIndex];
+		if (queryCount == 0)
+			return;
+
+		m_WrittenQueryCounts[frameIndex] = 0;
+
+		const auto context = VulkanContext::Get();
+		const VkDevice device = context->GetLogicalDevice()->GetNativeDevice();
+		constexpr VkQueryResultFlags flags = VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT;
+
+		// Timestamps, VK_NOT_READY is returned when some of the queries are unavailable
+		auto& timestamps = m_Timestamps[frameIndex];
+		const VkResult result = vkGetQueryPoolResults(device, m_QueryPools[frameIndex], 0, queryCount, sizeof(uint64_t) * 2 * queryCount, timestamps.data(), sizeof(uint64_t) * 2, flags);
+		if (result != VK_SUCCESS && result != VK_NOT_READY)
+		{
+			EPPO_WARN("Failed to get timestamp query results!");
+			return;
+		}
+
+		// Skip the frame if the total frame time is not available
+		if (timestamps[1] == 0 || timestamps[3] == 0)
+			return;
+
+		const float timestampPeriod = context->GetPhysicalDevice()->GetDeviceProperties().limits.timestampPeriod;
+
+		for (uint32_t i = 0; i < queryCount; i += 2)
+		{
+			const uint64_t begin = timestamps[i * 2];
+			const uint64_t end = timestamps[(i + 1) * 2];
+			const bool available = timestamps[i * 2 + 1] != 0 && timestamps[(i + 1) * 2 + 1] != 0;
+
+			float delta = 0.0f;
+			if (available && end > begin)
+				delta = static_cast<float>(end - begin) * timestampPeriod * 0.000001f;
+
+			m_TimestampDeltas[frameIndex][i / 2] = delta;
+		}
+
+		// Pipeline statistics
+		std::array<uint64_t, 7> statistics{};
+		vkGetQueryPoolResults(device, m_PipelineQueryPools[frameIndex], 0, 1, sizeof(statistics), statistics.data(), sizeof(statistics), flags);
+
+		if (statistics[6] != 0)
+			memcpy(&m_PipelineStatistics[frameIndex], statistics.data(), sizeof(PipelineStatistics));
+
+		m_ResolvedFrameIndex = frameIndex;
+		m_ResolvedFrameCount++;
+	}
+
 	void VulkanCommandBuffer::ResetCommandBuffer(const uint32_t frameIndex) const
 	{
 		vkResetCommandBuffer(m_CommandBuffers[frameIndex], 0);
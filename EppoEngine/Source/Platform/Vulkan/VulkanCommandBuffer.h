@@ -2,19 +2,10 @@
 
 #include "Platform/Vulkan/Vulkan.h"
 #include "Renderer/CommandBuffer.h"
+#include "Renderer/GPUProfiler.h"
 
 namespace Eppo
 {
-	struct PipelineStatistics
-	{
-		uint64_t InputAssemblyVertices = 0;
-		uint64_t InputAssemblyPrimitives = 0;
-		uint64_t VertexShaderInvocations = 0;
-		uint64_t ClippingInvocations = 0;
-		uint64_t ClippingPrimitives = 0;
-		uint64_t FragmentShaderInvocations = 0;
-	};
-
 	class VulkanCommandBuffer : public CommandBuffer
 	{
 	public:
@@ -27,12 +18,18 @@ namespace Eppo
 
 		uint32_t RT_BeginTimestampQuery();
 		void RT_EndTimestampQuery(uint32_t queryIndex) const;
-		[[nodiscard]] float GetTimestamp(uint32_t frameIndex, uint32_t queryIndex = 0) const;
-		[[nodiscard]] const PipelineStatistics& GetPipelineStatistics(const uint32_t frameIndex) const { return m_PipelineStatistics[frameIndex]; }
+
+		// Results are read back when the frame slot is reused, so they lag MaxFramesInFlight frames behind
+		[[nodiscard]] float GetTimestamp(uint32_t queryIndex = 0) const;
+		[[nodiscard]] const PipelineStatistics& GetPipelineStatistics() const { return m_PipelineStatistics[m_ResolvedFrameIndex]; }
+		[[nodiscard]] uint64_t GetResolvedFrameCount() const { return m_ResolvedFrameCount; }
 
 		void ResetCommandBuffer(uint32_t frameIndex) const;
 		[[nodiscard]] VkCommandBuffer GetCurrentCommandBuffer() const;
 
+	private:
+		void RT_ResolveQueries(uint32_t frameIndex);
+
 	private:
 		VkCommandPool m_CommandPool;
 		std::vector<VkCommandBuffer> m_CommandBuffers;
@@ -43,11 +40,15 @@ namespace Eppo
 		std::vector<std::vector<float>> m_TimestampDeltas;
 		uint32_t m_QueryIndex = 2;
 		uint32_t m_QueryCount = 12;
+		std::vector<uint32_t> m_WrittenQueryCounts;
 
 		std::vector<VkQueryPool> m_PipelineQueryPools;
 		std::vector<PipelineStatistics> m_PipelineStatistics;
 		uint32_t m_PipelineQueryCount = 6;
 
+		uint32_t m_ResolvedFrameIndex = 0;
+		uint64_t m_ResolvedFrameCount = 0;
+
 		bool m_ManualSubmission;
 	};
 }
@@ -124,6 +124,16 @@ namespace Eppo
 		vkDeviceWaitIdle(m_LogicalDevice->GetNativeDevice());
 	}
 
+	void VulkanContext::BeginUploadBatch()
+	{
+		m_LogicalDevice->BeginUploadBatch();
+	}
+
+	void VulkanContext::EndUploadBatch()
+	{
+		m_LogicalDevice->EndUploadBatch();
+	}
+
 	void VulkanContext::SubmitResourceFree(const std::function<void()>& fn, const bool freeOnShutdown)
 	{
 		m_GarbageCollector.SubmitFreeFn(fn, freeOnShutdown);
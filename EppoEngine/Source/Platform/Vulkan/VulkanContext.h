@@ -27,7 +27,10 @@ namespace Eppo
 		void PresentFrame() override;
 		void WaitIdle() override;
 
-		void SubmitResourceFree(const std::function<void()>& fn, bool freeOnShutdown = true);
+		void BeginUploadBatch() override;
+		void EndUploadBatch() override;
+
+		void SubmitResourceFree(const std::function<void()>& fn, bool freeOnShutdown = true) override;
 		void RunGC(uint32_t frameNumber);
 
 		[[nodiscard]] Ref<VulkanLogicalDevice> GetLogicalDevice() const { return m_LogicalDevice; }
@@ -112,14 +112,14 @@ namespace Eppo
 
 		VK_CHECK(vkCreateSampler(device, &samplerCreateInfo, nullptr, &m_ImageInfo.Sampler), "Failed to create sampler!");
 
-		VkCommandBuffer commandBuffer = context->GetLogicalDevice()->GetCommandBuffer(true);
+		VkCommandBuffer commandBuffer = context->GetLogicalDevice()->GetUploadCommandBuffer();
 
 		if (Utils::IsDepthFormat(m_Specification.Format))
 			TransitionImage(commandBuffer, m_ImageInfo.Image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL);
 		else
 			TransitionImage(commandBuffer, m_ImageInfo.Image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 		
-		context->GetLogicalDevice()->FlushCommandBuffer(commandBuffer);
+		context->GetLogicalDevice()->FlushUploadCommandBuffer(commandBuffer, VK_NULL_HANDLE, VK_NULL_HANDLE);
 
 		if (m_Specification.Format == ImageFormat::Depth)
 			m_ImageInfo.ImageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
@@ -163,7 +163,8 @@ namespace Eppo
 		memcpy(memData, data, size);
 		VulkanAllocator::UnmapMemory(stagingBufferAlloc);
 
-		const VkCommandBuffer commandBuffer = VulkanContext::Get()->GetLogicalDevice()->GetCommandBuffer(true);
+		const Ref<VulkanLogicalDevice> logicalDevice = VulkanContext::Get()->GetLogicalDevice();
+		const VkCommandBuffer commandBuffer = logicalDevice->GetUploadCommandBuffer();
 
 		// Transition to layout optimal for transferring
 		TransitionImage(commandBuffer, m_ImageInfo.Image, m_ImageInfo.ImageLayout, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
@@ -185,9 +186,7 @@ namespace Eppo
 		TransitionImage(commandBuffer, m_ImageInfo.Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 
 		// Flush command buffer
-		VulkanContext::Get()->GetLogicalDevice()->FlushCommandBuffer(commandBuffer);
-
-		VulkanAllocator::DestroyBuffer(stagingBuffer, stagingBufferAlloc);
+		logicalDevice->FlushUploadCommandBuffer(commandBuffer, stagingBuffer, stagingBufferAlloc);
 	}
 
 	void VulkanImage::Release()
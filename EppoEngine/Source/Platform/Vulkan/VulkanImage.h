@@ -28,6 +28,7 @@ namespace Eppo
 
 		[[nodiscard]] uint32_t GetWidth() const override { return m_Specification.Width; }
 		[[nodiscard]] uint32_t GetHeight() const override { return m_Specification.Height; }
+		[[nodiscard]] uint64_t GetMemoryUsage() const override { return VulkanAllocator::GetAllocationSize(m_ImageInfo.Allocation); }
 
 		ImageInfo& GetImageInfo() { return m_ImageInfo; }
 
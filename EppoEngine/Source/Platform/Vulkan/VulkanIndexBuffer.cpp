@@ -98,7 +98,7 @@ namespace Eppo
 		// Copy data from staging buffer to GPU local buffer
 		Ref<VulkanContext> context = VulkanContext::Get();
 		Ref<VulkanLogicalDevice> logicalDevice = context->GetLogicalDevice();
-		VkCommandBuffer commandBuffer = logicalDevice->GetCommandBuffer(true);
+		VkCommandBuffer commandBuffer = logicalDevice->GetUploadCommandBuffer();
 
 		VkBufferCopy copyRegion{};
 		copyRegion.srcOffset = 0;
@@ -106,9 +106,6 @@ namespace Eppo
 		copyRegion.size = buffer.Size;
 
 		vkCmdCopyBuffer(commandBuffer, stagingBuffer, m_Buffer, 1, &copyRegion);
-		logicalDevice->FlushCommandBuffer(commandBuffer);
-
-		// Clean up
-		VulkanAllocator::DestroyBuffer(stagingBuffer, stagingBufferAlloc);
+		logicalDevice->FlushUploadCommandBuffer(commandBuffer, stagingBuffer, stagingBufferAlloc);
 	}
 }
@@ -17,6 +17,7 @@ namespace Eppo
 
 		VkBuffer GetBuffer() const { return m_Buffer; }
 		uint32_t GetIndexCount() const override { return m_Size / sizeof(uint32_t); }
+		[[nodiscard]] uint64_t GetMemoryUsage() const override { return VulkanAllocator::GetAllocationSize(m_Allocation); }
 
 	private:
 		void CopyWithStagingBuffer(Buffer buffer) const;
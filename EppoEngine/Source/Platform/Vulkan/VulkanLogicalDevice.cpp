@@ -172,4 +172,46 @@ namespace Eppo
 	{
 		vkFreeCommandBuffers(m_Device, m_CommandPool, 1, &commandBuffer);
 	}
+
+	void VulkanLogicalDevice::BeginUploadBatch()
+	{
+		EPPO_ASSERT(!m_UploadCommandBuffer)
+		m_UploadCommandBuffer = GetCommandBuffer(true);
+	}
+
+	void VulkanLogicalDevice::EndUploadBatch()
+	{
+		EPPO_PROFILE_FUNCTION("VulkanLogicalDevice::EndUploadBatch");
+
+		EPPO_ASSERT(m_UploadCommandBuffer)
+		FlushCommandBuffer(m_UploadCommandBuffer);
+		m_UploadCommandBuffer = VK_NULL_HANDLE;
+
+		for (const auto& [buffer, allocation] : m_UploadStagingBuffers)
+			VulkanAllocator::DestroyBuffer(buffer, allocation);
+
+		m_UploadStagingBuffers.clear();
+	}
+
+	VkCommandBuffer VulkanLogicalDevice::GetUploadCommandBuffer() const
+	{
+		if (m_UploadCommandBuffer)
+			return m_UploadCommandBuffer;
+
+		return GetCommandBuffer(true);
+	}
+
+	void VulkanLogicalDevice::FlushUploadCommandBuffer(VkCommandBuffer commandBuffer, VkBuffer stagingBuffer, VmaAllocation stagingAllocation)
+	{
+		if (commandBuffer == m_UploadCommandBuffer)
+		{
+			m_UploadStagingBuffers.emplace_back(stagingBuffer, stagingAllocation);
+			return;
+		}
+
+		FlushCommandBuffer(commandBuffer);
+
+		if (stagingBuffer)
+			VulkanAllocator::DestroyBuffer(stagingBuffer, stagingAllocation);
+	}
 }
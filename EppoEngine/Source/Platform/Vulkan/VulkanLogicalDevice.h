@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Platform/Vulkan/VulkanAllocator.h"
 #include "Platform/Vulkan/VulkanPhysicalDevice.h"
 
 namespace Eppo
@@ -20,11 +21,23 @@ namespace Eppo
 		void FlushCommandBuffer(VkCommandBuffer commandBuffer) const;
 		void FreeCommandBuffer(VkCommandBuffer commandBuffer) const;
 
+		// Uploads between begin and end share one command buffer and are submitted together at the end
+		void BeginUploadBatch();
+		void EndUploadBatch();
+
+		// Returns the batch command buffer while batching, a new one otherwise
+		VkCommandBuffer GetUploadCommandBuffer() const;
+		// Flushes the upload right away when not batching, the staging buffer is destroyed once the copy is done
+		void FlushUploadCommandBuffer(VkCommandBuffer commandBuffer, VkBuffer stagingBuffer, VmaAllocation stagingAllocation);
+
 	private:
 		Ref<VulkanPhysicalDevice> m_PhysicalDevice;
 		VkDevice m_Device;
 
 		VkQueue m_GraphicsQueue;
 		VkCommandPool m_CommandPool;
+
+		VkCommandBuffer m_UploadCommandBuffer = VK_NULL_HANDLE;
+		std::vector<std::pair<VkBuffer, VmaAllocation>> m_UploadStagingBuffers;
 	};
 }
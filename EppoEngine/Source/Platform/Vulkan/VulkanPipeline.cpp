@@ -98,7 +98,7 @@ namespace Eppo
 			VkVertexInputAttributeDescription& attributeDescription = attributeDescriptions.emplace_back();
 			attributeDescription.binding = 0;
 			attributeDescription.location = static_cast<uint32_t>(i);
-			attributeDescription.format = Utils::ShaderDataTypeToVkFormat(elements[i].Type);
+			attributeDescription.format = Utils::ShaderDataTypeToVkFormat(elements[i].Type, elements[i].Normalized);
 			attributeDescription.offset = static_cast<uint32_t>(elements[i].Offset);
 		}
 
@@ -23,7 +23,7 @@
 namespace Eppo
 {
 	VulkanSceneRenderer::VulkanSceneRenderer(Ref<Scene> scene, const RenderSpecification& renderSpec)
-		: m_RenderSpecification(renderSpec), m_Scene(scene)
+		: m_RenderSpecification(renderSpec), m_Scene(scene), m_DynamicResolution(renderSpec.DynamicResolution)
 	{
 		Ref<VulkanContext> context = VulkanContext::Get();
 		Ref<VulkanSwapchain> swapchain = context->GetSwapchain();
@@ -56,13 +56,10 @@ namespace Eppo
 			pipelineSpec.Width = 1024;
 			pipelineSpec.Height = 1024;
 			pipelineSpec.Shader = renderer->GetShader("predepth");
-			pipelineSpec.Layout = {
-				{ ShaderDataType::Float3, "inPosition" },
-				{ ShaderDataType::Float3, "inNormal" },
-				{ ShaderDataType::Float2, "inTexCoord" }
-			};
+			pipelineSpec.Layout = VertexPacking::GetPositionLayout(VertexFormat::Standard);
 
 			m_PreDepthPipeline = Pipeline::Create(pipelineSpec);
+			m_PreDepthPipelines = CreateVertexFormatVariants(m_PreDepthPipeline, true);
 		}
 
 		// Environment
@@ -112,13 +109,10 @@ namespace Eppo
 			pipelineSpec.Width = m_RenderSpecification.Width;
 			pipelineSpec.Height = m_RenderSpecification.Height;
 			pipelineSpec.Shader = renderer->GetShader("geometry");
-			pipelineSpec.Layout = {
-				{ ShaderDataType::Float3, "inPosition" },
-				{ ShaderDataType::Float3, "inNormal" },
-				{ ShaderDataType::Float2, "inTexCoord" }
-			};
+			pipelineSpec.Layout = VertexPacking::GetLayout(VertexFormat::Standard);
 
 			m_GeometryPipeline = Pipeline::Create(pipelineSpec);
+			m_GeometryPipelines = CreateVertexFormatVariants(m_GeometryPipeline, false);
 		}
 
 		// Skybox
@@ -173,6 +167,25 @@ namespace Eppo
 			m_CompositePipeline = Pipeline::Create(pipelineSpec);
 		}
 
+		// Upscale
+		{
+			ImageSpecification imageSpec;
+			imageSpec.Format = ImageFormat::RGBA8;
+			imageSpec.Usage = ImageUsage::Attachment;
+			imageSpec.Width = m_RenderSpecification.Width;
+			imageSpec.Height = m_RenderSpecification.Height;
+
+			PipelineSpecification pipelineSpec;
+			pipelineSpec.RenderAttachments = {
+				RenderAttachment{ Image::Create(imageSpec), false, glm::vec4(0.0f) }
+			};
+			pipelineSpec.Width = m_RenderSpecification.Width;
+			pipelineSpec.Height = m_RenderSpecification.Height;
+			pipelineSpec.Shader = renderer->GetShader("composite");
+
+			m_UpscalePipeline = Pipeline::Create(pipelineSpec);
+		}
+
 		// Execute image transitions
 		context->GetLogicalDevice()->FlushCommandBuffer(cmd);
 
@@ -185,6 +198,11 @@ namespace Eppo
 				m_DescriptorSets[i][j] = static_cast<VkDescriptorSet>(renderer->AllocateDescriptor(descriptorSetLayouts[j]));
 		}
 
+		// Create descriptor sets from composite shader
+		const auto compositeShader = std::static_pointer_cast<VulkanShader>(m_UpscalePipeline->GetSpecification().Shader);
+		for (auto& descriptorSet : m_CompositeDescriptorSets)
+			descriptorSet = static_cast<VkDescriptorSet>(renderer->AllocateDescriptor(compositeShader->GetDescriptorSetLayouts()[0]));
+
 		// Vertex and Index buffers
 		m_DebugLineVertexBuffer = VertexBuffer::Create(sizeof(LineVertex) * 100);
 		m_DebugLineIndexBuffer = IndexBuffer::Create(sizeof(uint32_t) * 100);
@@ -203,24 +221,97 @@ namespace Eppo
 
 		ImGui::Begin("Performance");
 
-		uint32_t frameIndex = VulkanContext::Get()->GetCurrentFrameIndex();
-		frameIndex = frameIndex == 0 ? 1 : 0;
-
 		const auto cmd = std::static_pointer_cast<VulkanCommandBuffer>(m_CommandBuffer);
 
-		ImGui::Text("GPU Time: %.3fms", cmd->GetTimestamp(frameIndex));
-		ImGui::Text("PreDepth Pass: %.3fms", cmd->GetTimestamp(frameIndex, m_TimestampQueries.PreDepthQuery));
-		ImGui::Text("Geometry Pass: %.3fms", cmd->GetTimestamp(frameIndex, m_TimestampQueries.GeometryQuery));
-		ImGui::Text("Skybox Pass: %.3fms", cmd->GetTimestamp(frameIndex, m_TimestampQueries.SkyboxQuery));
+		ImGui::Text("GPU Time: %.3fms", cmd->GetTimestamp());
+		ImGui::Text("PreDepth Pass: %.3fms", cmd->GetTimestamp(m_TimestampQueries.PreDepthQuery));
+		ImGui::Text("Geometry Pass: %.3fms", cmd->GetTimestamp(m_TimestampQueries.GeometryQuery));
+		ImGui::Text("Skybox Pass: %.3fms", cmd->GetTimestamp(m_TimestampQueries.SkyboxQuery));
 
 		if (m_RenderSpecification.DebugRendering)
-			ImGui::Text("Debug Line Pass: %.3fms", cmd->GetTimestamp(frameIndex, m_TimestampQueries.DebugLineQuery));
+			ImGui::Text("Debug Line Pass: %.3fms", cmd->GetTimestamp(m_TimestampQueries.DebugLineQuery));
+
+		ImGui::Text("Composite Pass: %.3fms", cmd->GetTimestamp(m_TimestampQueries.CompositeQuery));
+
+		ImGui::Separator();
+
+		if (ImGui::TreeNode("GPU history"))
+		{
+			ImGui::Text("Frames: %u", m_GPUProfiler.GetFrameCount());
+
+			if (ImGui::BeginTable("GPUHistory", 5))
+			{
+				ImGui::TableSetupColumn("Pass");
+				ImGui::TableSetupColumn("Min");
+				ImGui::TableSetupColumn("Avg");
+				ImGui::TableSetupColumn("P95");
+				ImGui::TableSetupColumn("P99");
+				ImGui::TableHeadersRow();
+
+				for (const auto& name : m_GPUProfiler.GetTimingNames())
+				{
+					const TimingStatistics stats = m_GPUProfiler.GetStatistics(name);
+
+					ImGui::TableNextRow();
+					ImGui::TableNextColumn(); ImGui::TextUnformatted(name.c_str());
+					ImGui::TableNextColumn(); ImGui::Text("%.3f", stats.Min);
+					ImGui::TableNextColumn(); ImGui::Text("%.3f", stats.Average);
+					ImGui::TableNextColumn(); ImGui::Text("%.3f", stats.P95);
+					ImGui::TableNextColumn(); ImGui::Text("%.3f", stats.P99);
+				}
+
+				ImGui::EndTable();
+			}
+
+			if (ImGui::Button("Export CSV"))
+				m_GPUProfiler.ExportCSV("GPUProfile.csv");
+
+			ImGui::SameLine();
+
+			if (ImGui::Button("Export JSON"))
+				m_GPUProfiler.ExportJSON("GPUProfile.json");
+
+			ImGui::SameLine();
+
+			if (ImGui::Button("Clear"))
+				m_GPUProfiler.Clear();
+
+			ImGui::TreePop();
+		}
+
+		ImGui::Separator();
+
+		auto& drsSpec = m_DynamicResolution.GetSpecification();
+		if (ImGui::Checkbox("Dynamic resolution", &drsSpec.Enabled))
+			m_DynamicResolution.Reset();
+
+		if (drsSpec.Enabled)
+		{
+			ImGui::DragFloat("Target GPU time (ms)", &drsSpec.TargetFrameTime, 0.1f, 1.0f, 100.0f);
+			ImGui::DragFloatRange2("Scale bounds", &drsSpec.MinScale, &drsSpec.MaxScale, 0.01f, 0.25f, 1.0f);
+			ImGui::SliderFloat("Sharpness", &drsSpec.Sharpness, 0.0f, 1.0f);
+		}
+
+		ImGui::Text("Render scale: %.2f", m_DynamicResolution.GetScale());
+		ImGui::Text("Render resolution: %ux%u", m_RenderWidth, m_RenderHeight);
 
-		ImGui::Text("Composite Pass: %.3fms", cmd->GetTimestamp(frameIndex, m_TimestampQueries.CompositeQuery));
+		ImGui::Separator();
+
+		auto& lodSpec = m_RenderSpecification.MeshLod;
+		ImGui::Checkbox("Mesh LODs", &lodSpec.Enabled);
+
+		if (lodSpec.Enabled)
+		{
+			ImGui::DragFloat("LOD error threshold (px)", &lodSpec.ErrorThreshold, 0.1f, 0.1f, 32.0f);
+
+			int shadowLodBias = static_cast<int>(lodSpec.ShadowLodBias);
+			if (ImGui::SliderInt("Shadow LOD bias", &shadowLodBias, 0, static_cast<int>(Primitive::MaxLods) - 1))
+				lodSpec.ShadowLodBias = static_cast<uint32_t>(shadowLodBias);
+		}
 
 		ImGui::Separator();
 
-		const auto& pipelineStats = cmd->GetPipelineStatistics(frameIndex);
+		const auto& pipelineStats = cmd->GetPipelineStatistics();
 
 		ImGui::Text("Pipeline statistics:");
 		ImGui::Text("Input Assembly Vertices: %llu", pipelineStats.InputAssemblyVertices);
@@ -236,6 +327,13 @@ namespace Eppo
 		ImGui::Text("Meshes: %u", m_RenderStatistics.Meshes);
 		ImGui::Text("Submeshes: %u", m_RenderStatistics.Submeshes);
 		ImGui::Text("Instances: %u", m_RenderStatistics.MeshInstances);
+
+		for (uint32_t lod = 0; lod < Primitive::MaxLods; lod++)
+			ImGui::Text("LOD %u triangles: %u", lod, m_RenderStatistics.LodTriangles[lod]);
+
+		ImGui::Text("Shadow vertex data: %.2f MB", static_cast<double>(m_RenderStatistics.PreDepthVertexBytes) / (1024.0 * 1024.0));
+		ImGui::Text("Geometry vertex data: %.2f MB", static_cast<double>(m_RenderStatistics.GeometryVertexBytes) / (1024.0 * 1024.0));
+
 		ImGui::Text("Camera position: %.2f, %.2f, %.2f", m_CameraBuffer.Position.x, m_CameraBuffer.Position.y, m_CameraBuffer.Position.z);
 
 		ImGui::End();
@@ -257,9 +355,59 @@ namespace Eppo
 		ImGui::End();
 	}
 
-	void VulkanSceneRenderer::Resize(uint32_t width, uint32_t height)
+	void VulkanSceneRenderer::Resize(const uint32_t width, const uint32_t height)
 	{
-		//m_GeometryFramebuffer->Resize(width, height);
+		EPPO_PROFILE_FUNCTION("VulkanSceneRenderer::Resize");
+
+		if (width == 0 || height == 0)
+			return;
+
+		if (width == m_RenderSpecification.Width && height == m_RenderSpecification.Height)
+			return;
+
+		m_RenderSpecification.Width = width;
+		m_RenderSpecification.Height = height;
+
+		// Frames in flight can still reference the old attachments, so they are retired through the garbage collector
+		std::vector<Ref<Image>> retiredImages;
+
+		const auto recreateAttachment = [&retiredImages, width, height](RenderAttachment& attachment)
+		{
+			retiredImages.emplace_back(attachment.RenderImage);
+
+			ImageSpecification imageSpec = attachment.RenderImage->GetSpecification();
+			imageSpec.Width = width;
+			imageSpec.Height = height;
+
+			attachment.RenderImage = Image::Create(imageSpec);
+		};
+
+		// Geometry (color attachments and depth attachment)
+		for (auto& attachment : m_GeometryPipeline->GetSpecification().RenderAttachments)
+			recreateAttachment(attachment);
+
+		// Skybox and debug lines render on top of the geometry attachments
+		auto& skyboxSpec = m_SkyboxPipeline->GetSpecification();
+		skyboxSpec.RenderAttachments[0].RenderImage = m_GeometryPipeline->GetFinalImage();
+		skyboxSpec.RenderAttachments[1].RenderImage = m_GeometryPipeline->GetImage(3);
+
+		if (m_DebugLinePipeline)
+			m_DebugLinePipeline->GetSpecification().RenderAttachments[0].RenderImage = m_GeometryPipeline->GetFinalImage();
+
+		// Upscale
+		auto& upscaleSpec = m_UpscalePipeline->GetSpecification();
+		recreateAttachment(upscaleSpec.RenderAttachments[0]);
+		upscaleSpec.Width = width;
+		upscaleSpec.Height = height;
+
+		VulkanContext::Get()->SubmitResourceFree([retiredImages]()
+		{
+			for (const auto& image : retiredImages)
+			{
+				UI::RemoveImage(image);
+				image->Release();
+			}
+		}, false);
 	}
 
 	void VulkanSceneRenderer::BeginScene(const EditorCamera& editorCamera)
@@ -320,6 +468,9 @@ namespace Eppo
 
 	Ref<Image> VulkanSceneRenderer::GetFinalImage()
 	{
+		if (m_UpscaleActive)
+			return m_UpscalePipeline->GetFinalImage();
+
 		return m_GeometryPipeline->GetFinalImage();
 	}
 
@@ -327,6 +478,10 @@ namespace Eppo
 	{
 		EPPO_PROFILE_FUNCTION("VulkanSceneRenderer::Flush");
 
+		UpdateGPUProfiler();
+		UpdateRenderScale();
+		SelectMeshLods();
+
 		m_CommandBuffer->RT_Begin();
 
 		// Prepare buffers
@@ -359,6 +514,109 @@ namespace Eppo
 		m_CommandBuffer->RT_End();
 	}
 
+	void VulkanSceneRenderer::UpdateGPUProfiler()
+	{
+		EPPO_PROFILE_FUNCTION("VulkanSceneRenderer::UpdateGPUProfiler");
+
+		const auto cmd = std::static_pointer_cast<VulkanCommandBuffer>(m_CommandBuffer);
+
+		// Only record frames that were resolved since the last update
+		const uint64_t resolvedFrameCount = cmd->GetResolvedFrameCount();
+		if (resolvedFrameCount == m_LastResolvedFrameCount)
+			return;
+
+		m_LastResolvedFrameCount = resolvedFrameCount;
+
+		m_GPUProfiler.BeginFrame(resolvedFrameCount);
+		m_GPUProfiler.AddTiming("Total", cmd->GetTimestamp());
+		m_GPUProfiler.AddTiming("PreDepth", cmd->GetTimestamp(m_TimestampQueries.PreDepthQuery));
+		m_GPUProfiler.AddTiming("Geometry", cmd->GetTimestamp(m_TimestampQueries.GeometryQuery));
+		m_GPUProfiler.AddTiming("Skybox", cmd->GetTimestamp(m_TimestampQueries.SkyboxQuery));
+
+		if (m_RenderSpecification.DebugRendering)
+			m_GPUProfiler.AddTiming("DebugLine", cmd->GetTimestamp(m_TimestampQueries.DebugLineQuery));
+
+		m_GPUProfiler.AddTiming("Composite", cmd->GetTimestamp(m_TimestampQueries.CompositeQuery));
+		m_GPUProfiler.SetPipelineStatistics(cmd->GetPipelineStatistics());
+	}
+
+	void VulkanSceneRenderer::UpdateRenderScale()
+	{
+		EPPO_PROFILE_FUNCTION("VulkanSceneRenderer::UpdateRenderScale");
+
+		const auto cmd = std::static_pointer_cast<VulkanCommandBuffer>(m_CommandBuffer);
+
+		// The controller counts frames over and under budget, so it only gets to see each resolved timing once.
+		// Turning it off still takes effect right away.
+		const uint64_t resolvedFrameCount = cmd->GetResolvedFrameCount();
+		float scale = m_DynamicResolution.GetScale();
+		if (resolvedFrameCount != m_LastScaledFrameCount || !m_DynamicResolution.GetSpecification().Enabled)
+		{
+			m_LastScaledFrameCount = resolvedFrameCount;
+			scale = m_DynamicResolution.Update(cmd->GetTimestamp());
+		}
+
+		m_UpscaleActive = m_DynamicResolution.GetSpecification().Enabled;
+		m_RenderWidth = std::max(1u, static_cast<uint32_t>(static_cast<float>(m_RenderSpecification.Width) * scale));
+		m_RenderHeight = std::max(1u, static_cast<uint32_t>(static_cast<float>(m_RenderSpecification.Height) * scale));
+
+		// Attachments keep their full size, the scaled passes only render to the top left part of them
+		for (const auto& pipeline : { m_GeometryPipeline, m_SkyboxPipeline, m_DebugLinePipeline })
+		{
+			if (!pipeline)
+				continue;
+
+			auto& spec = pipeline->GetSpecification();
+			spec.Width = m_RenderWidth;
+			spec.Height = m_RenderHeight;
+		}
+	}
+
+	void VulkanSceneRenderer::SelectMeshLods()
+	{
+		EPPO_PROFILE_FUNCTION("VulkanSceneRenderer::SelectMeshLods");
+
+		m_SubmeshLods.clear();
+
+		const MeshLodSpecification& spec = m_RenderSpecification.MeshLod;
+		const glm::mat4& projection = m_CameraBuffer.Projection;
+		const glm::vec3 cameraPosition = glm::vec3(m_CameraBuffer.Position);
+
+		// Pixels covered by one unit at distance one, orthographic projections do not scale with distance
+		const float pixelsPerUnit = std::abs(projection[1][1]) * static_cast<float>(m_RenderHeight) * 0.5f;
+		const bool perspective = projection[3][3] == 0.0f;
+
+		for (const auto& dc : m_DrawList[EntityType::Mesh])
+		{
+			const auto meshCmd = std::static_pointer_cast<MeshCommand>(dc);
+
+			for (const auto& submesh : meshCmd->Mesh->GetSubmeshes())
+			{
+				uint32_t lod = 0;
+
+				if (spec.Enabled && submesh.GetLodCount() > 1)
+				{
+					const glm::mat4 transform = meshCmd->Transform * submesh.GetLocalTransform();
+					const glm::vec3 center = glm::vec3(transform * glm::vec4(submesh.GetBoundingCenter(), 1.0f));
+					const float scale = std::max({ glm::length(glm::vec3(transform[0])), glm::length(glm::vec3(transform[1])), glm::length(glm::vec3(transform[2])) });
+					const float radius = submesh.GetBoundingRadius() * scale;
+					const float distance = glm::distance(center, cameraPosition);
+
+					// Full detail when the camera is inside the bounding sphere
+					if (!perspective || distance > radius)
+					{
+						const float projectedRadius = perspective ? radius * pixelsPerUnit / distance : radius * pixelsPerUnit;
+
+						while (lod + 1 < submesh.GetLodCount() && submesh.GetLodError(lod + 1) * projectedRadius <= spec.ErrorThreshold)
+							lod++;
+					}
+				}
+
+				m_SubmeshLods.emplace_back(lod);
+			}
+		}
+	}
+
 	void Eppo::VulkanSceneRenderer::PrepareBuffers()
 	{
 		EPPO_PROFILE_FUNCTION("VulkanSceneRenderer::PrepareBuffers");
@@ -374,7 +632,7 @@ namespace Eppo
 		m_EnvironmentUB->SetData(&m_EnvironmentBuffer, sizeof(EnvironmentData));
 
 		// Lights UB
-		m_LightsBuffer.Projection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 50.0f);
+		m_LightsBuffer.Projection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, PointLightCommand::ShadowRange);
 		m_LightsBuffer.NumLights = 0;
 
 		std::vector<LineVertex> lineVertices;
@@ -566,6 +824,16 @@ namespace Eppo
 			}
 
 			writer.UpdateSet(descriptorSets[2]);
+			writer.Clear();
+
+			// Composite
+			{
+				// Binding 0
+				const auto& info = std::static_pointer_cast<VulkanImage>(m_GeometryPipeline->GetFinalImage())->GetImageInfo();
+				writer.WriteImage(0, info.ImageView, info.Sampler, info.ImageLayout, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+			}
+
+			writer.UpdateSet(m_CompositeDescriptorSets[frameIndex]);
 		});
 	}
 
@@ -586,6 +854,44 @@ namespace Eppo
 		});
 	}
 
+	std::array<Ref<Pipeline>, VertexPacking::FormatCount> VulkanSceneRenderer::CreateVertexFormatVariants(const Ref<Pipeline>& pipeline, const bool positionsOnly)
+	{
+		std::array<Ref<Pipeline>, VertexPacking::FormatCount> variants;
+
+		for (uint32_t i = 0; i < VertexPacking::FormatCount; i++)
+		{
+			const auto format = static_cast<VertexFormat>(i);
+			const VertexBufferLayout layout = positionsOnly ? VertexPacking::GetPositionLayout(format) : VertexPacking::GetLayout(format);
+
+			// Formats sharing a layout share the pipeline, equal strides alone can still differ in their elements
+			for (uint32_t j = 0; j < i && !variants[i]; j++)
+			{
+				if (variants[j]->GetSpecification().Layout == layout)
+					variants[i] = variants[j];
+			}
+
+			if (variants[i])
+				continue;
+
+			if (format == VertexFormat::Standard)
+			{
+				variants[i] = pipeline;
+				continue;
+			}
+
+			PipelineSpecification spec = pipeline->GetSpecification();
+			spec.Layout = layout;
+			spec.CreateDepthImage = false;
+
+			variants[i] = Pipeline::Create(spec);
+
+			// Attachments are only needed for their formats at creation, the pass always renders to those of the main pipeline
+			variants[i]->GetSpecification().RenderAttachments.clear();
+		}
+
+		return variants;
+	}
+
 	void VulkanSceneRenderer::PreDepthPass()
 	{
 		const auto cmd = std::static_pointer_cast<VulkanCommandBuffer>(m_CommandBuffer);
@@ -626,6 +932,7 @@ namespace Eppo
 
 				// Bind pipeline
 				vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->GetPipeline());
+				VkPipeline boundPipeline = pipeline->GetPipeline();
 
 				// Set viewport and scissor
 				VkViewport viewport{};
@@ -648,6 +955,8 @@ namespace Eppo
 				vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->GetPipelineLayout(), 0, 3, descriptorSets.data(), 0, nullptr);
 
 				// Render geometry
+				uint32_t submeshIndex = 0;
+
 				for (const auto& dc : m_DrawList[EntityType::Mesh])
 				{
 					const auto meshCmd = std::static_pointer_cast<MeshCommand>(dc);
@@ -655,8 +964,19 @@ namespace Eppo
 
 					for (const auto& submesh : meshCmd->Mesh->GetSubmeshes())
 					{
-						// Bind vertex buffer
-						const auto vertexBuffer = std::static_pointer_cast<VulkanVertexBuffer>(submesh.GetVertexBuffer());
+						// Shadows can use coarser geometry than the camera
+						const uint32_t lod = std::min(m_SubmeshLods[submeshIndex++] + m_RenderSpecification.MeshLod.ShadowLodBias, submesh.GetLodCount() - 1);
+
+						// Bind the pipeline matching the position format, descriptor sets stay bound as the layouts are identical
+						const auto formatPipeline = std::static_pointer_cast<VulkanPipeline>(m_PreDepthPipelines[static_cast<size_t>(submesh.GetVertexFormat())]);
+						if (formatPipeline->GetPipeline() != boundPipeline)
+						{
+							boundPipeline = formatPipeline->GetPipeline();
+							vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, boundPipeline);
+						}
+
+						// Bind vertex buffer, depth only needs positions
+						const auto vertexBuffer = std::static_pointer_cast<VulkanVertexBuffer>(submesh.GetPositionBuffer());
 						VkBuffer vb = { vertexBuffer->GetBuffer() };
 						constexpr VkDeviceSize offsets[] = { 0 };
 
@@ -669,15 +989,23 @@ namespace Eppo
 						// Draw call
 						glm::mat4 finalTransform = meshCmd->Transform * submesh.GetLocalTransform();
 
+						const VertexQuantization& quantization = submesh.GetVertexQuantization();
+						const uint32_t positionStride = formatPipeline->GetSpecification().Layout.GetStride();
+
 						for (const auto& p : submesh.GetPrimitives())
 						{
 							pcrBuffer.SetData(finalTransform);
 							pcrBuffer.SetData(i, 64);
+							pcrBuffer.SetData(glm::vec4(quantization.Offset, 0.0f), 80);
+							pcrBuffer.SetData(glm::vec4(quantization.Scale, 0.0f), 96);
 
-							vkCmdPushConstants(commandBuffer, pipeline->GetPipelineLayout(), VK_SHADER_STAGE_ALL_GRAPHICS, 0, pcrBuffer.Size(), pcrBuffer.Data());
+							vkCmdPushConstants(commandBuffer, formatPipeline->GetPipelineLayout(), VK_SHADER_STAGE_ALL_GRAPHICS, 0, pcrBuffer.Size(), pcrBuffer.Data());
+
+							const PrimitiveLod primitiveLod = p.GetLod(lod);
+							m_RenderStatistics.PreDepthVertexBytes += static_cast<uint64_t>(p.VertexCount) * positionStride;
 
 							m_RenderStatistics.DrawCalls++;
-							vkCmdDrawIndexed(commandBuffer, p.IndexCount, 1, p.FirstIndex, static_cast<int32_t>(p.FirstVertex), 0);
+							vkCmdDrawIndexed(commandBuffer, primitiveLod.IndexCount, 1, primitiveLod.FirstIndex, static_cast<int32_t>(p.FirstVertex), 0);
 						}
 					}
 				}
@@ -845,6 +1173,7 @@ namespace Eppo
 
 			// Bind pipeline
 			vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->GetPipeline());
+			VkPipeline boundPipeline = pipeline->GetPipeline();
 
 			// Set viewport and scissor
 			VkViewport viewport;
@@ -867,9 +1196,16 @@ namespace Eppo
 			vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->GetPipelineLayout(), 0, 3, descriptorSets.data(), 0, nullptr);
 		
 			// Render geometry
+			uint32_t submeshIndex = 0;
+
 			for (const auto& dc : m_DrawList[EntityType::Mesh])
 			{
 				const auto meshCmd = std::static_pointer_cast<MeshCommand>(dc);
+				if (!meshCmd->CameraVisible)
+				{
+					submeshIndex += static_cast<uint32_t>(meshCmd->Mesh->GetSubmeshes().size());
+					continue;
+				}
 
 				m_RenderStatistics.Meshes++;
 				m_RenderStatistics.MeshInstances++;
@@ -878,6 +1214,16 @@ namespace Eppo
 				{
 					m_RenderStatistics.Submeshes++;
 
+					const uint32_t lod = m_SubmeshLods[submeshIndex++];
+
+					// Bind the pipeline matching the vertex format, descriptor sets stay bound as the layouts are identical
+					const auto formatPipeline = std::static_pointer_cast<VulkanPipeline>(m_GeometryPipelines[static_cast<size_t>(submesh.GetVertexFormat())]);
+					if (formatPipeline->GetPipeline() != boundPipeline)
+					{
+						boundPipeline = formatPipeline->GetPipeline();
+						vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, boundPipeline);
+					}
+
 					// Bind vertex buffer
 					const auto vertexBuffer = std::static_pointer_cast<VulkanVertexBuffer>(submesh.GetVertexBuffer());
 					VkBuffer vb = { vertexBuffer->GetBuffer() };
@@ -892,6 +1238,10 @@ namespace Eppo
 					// Draw call
 					glm::mat4 finalTransform = meshCmd->Transform * submesh.GetLocalTransform();
 
+					const VertexQuantization& quantization = submesh.GetVertexQuantization();
+					const int32_t packedNormals = submesh.GetVertexFormat() != VertexFormat::Standard ? 1 : 0;
+					const uint32_t vertexStride = formatPipeline->GetSpecification().Layout.GetStride();
+
 					for (const auto& p : submesh.GetPrimitives())
 					{
 						const auto& shader = pipeline->GetSpecification().Shader;
@@ -903,11 +1253,18 @@ namespace Eppo
 						buffer.SetData(p.Material->DiffuseMapIndex, 80);
 						buffer.SetData(p.Material->NormalMapIndex, 84);
 						buffer.SetData(p.Material->RoughnessMetallicMapIndex, 88);
+						buffer.SetData(packedNormals, 92);
+						buffer.SetData(glm::vec4(quantization.Offset, 0.0f), 96);
+						buffer.SetData(glm::vec4(quantization.Scale, 0.0f), 112);
+
+						vkCmdPushConstants(commandBuffer, formatPipeline->GetPipelineLayout(), VK_SHADER_STAGE_ALL_GRAPHICS, 0, buffer.Size(), buffer.Data());
+
+						const PrimitiveLod primitiveLod = p.GetLod(lod);
+						m_RenderStatistics.LodTriangles[std::min(lod, p.GetLodCount() - 1)] += primitiveLod.IndexCount / 3;
+						m_RenderStatistics.GeometryVertexBytes += static_cast<uint64_t>(p.VertexCount) * vertexStride;
 
-						vkCmdPushConstants(commandBuffer, pipeline->GetPipelineLayout(), VK_SHADER_STAGE_ALL_GRAPHICS, 0, buffer.Size(), buffer.Data());
-						
 						m_RenderStatistics.DrawCalls++;
-						vkCmdDrawIndexed(commandBuffer, p.IndexCount, 1, p.FirstIndex, static_cast<int32_t>(p.FirstVertex), 0);
+						vkCmdDrawIndexed(commandBuffer, primitiveLod.IndexCount, 1, primitiveLod.FirstIndex, static_cast<int32_t>(p.FirstVertex), 0);
 					}
 				}
 			}
@@ -1011,7 +1368,13 @@ namespace Eppo
 
 		m_TimestampQueries.CompositeQuery = cmd->RT_BeginTimestampQuery();
 
-		renderer->SubmitCommand([this, cmd, pipeline, renderer]()
+		const bool upscale = m_UpscaleActive;
+		const glm::vec2 renderScale(
+			static_cast<float>(m_RenderWidth) / static_cast<float>(m_RenderSpecification.Width),
+			static_cast<float>(m_RenderHeight) / static_cast<float>(m_RenderSpecification.Height)
+		);
+
+		renderer->SubmitCommand([this, cmd, pipeline, renderer, upscale, renderScale]()
 		{
 			EPPO_PROFILE_FUNCTION("VulkanSceneRenderer::CompositePass");
 
@@ -1025,6 +1388,52 @@ namespace Eppo
 			if (m_RenderSpecification.DebugRendering)
 				m_DebugRenderer->StartDebugLabel(cmd, "CompositePass");
 
+			// Upscale the scaled part of the geometry output to the full resolution before the gui samples it
+			if (upscale)
+			{
+				const auto upscalePipeline = std::static_pointer_cast<VulkanPipeline>(m_UpscalePipeline);
+				const auto& spec = upscalePipeline->GetSpecification();
+
+				renderer->BeginRenderPass(cmd, upscalePipeline);
+
+				vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, upscalePipeline->GetPipeline());
+
+				// Set viewport and scissor
+				VkViewport viewport;
+				viewport.x = 0.0f;
+				viewport.y = 0.0f;
+				viewport.width = static_cast<float>(spec.Width);
+				viewport.height = static_cast<float>(spec.Height);
+				viewport.minDepth = 0.0f;
+				viewport.maxDepth = 1.0f;
+
+				vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+
+				VkRect2D scissor;
+				scissor.offset = { 0, 0 };
+				scissor.extent = { spec.Width, spec.Height };
+
+				vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+
+				// Bind descriptor sets
+				const uint32_t frameIndex = context->GetCurrentFrameIndex();
+				vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, upscalePipeline->GetPipelineLayout(), 0, 1, &m_CompositeDescriptorSets[frameIndex], 0, nullptr);
+
+				// Push constants
+				const auto& pcr = std::static_pointer_cast<VulkanShader>(spec.Shader)->GetPushConstantRanges();
+				ScopedBuffer buffer(pcr[0].size);
+				buffer.SetData(renderScale);
+				buffer.SetData(m_DynamicResolution.GetSpecification().Sharpness, 8);
+
+				vkCmdPushConstants(commandBuffer, upscalePipeline->GetPipelineLayout(), VK_SHADER_STAGE_ALL_GRAPHICS, 0, buffer.Size(), buffer.Data());
+
+				// Fullscreen triangle
+				m_RenderStatistics.DrawCalls++;
+				vkCmdDraw(commandBuffer, 3, 1, 0, 0);
+
+				renderer->EndRenderPass(cmd);
+			}
+
 			VulkanImage::TransitionImage(commandBuffer, swapchain->GetCurrentImage(), VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
 			renderer->BeginRenderPass(cmd, pipeline);
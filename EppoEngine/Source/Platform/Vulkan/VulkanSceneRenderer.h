@@ -5,6 +5,8 @@
 #include "Renderer/Mesh/Mesh.h"
 #include "Renderer/DrawCommand.h"
 #include "Renderer/DebugRenderer.h"
+#include "Renderer/DynamicResolution.h"
+#include "Renderer/GPUProfiler.h"
 #include "Renderer/Image.h"
 #include "Renderer/Pipeline.h"
 #include "Renderer/SceneRenderer.h"
@@ -28,13 +30,19 @@ namespace Eppo
 		
 		void SubmitDrawCommand(EntityType type, Ref<DrawCommand> drawCommand) override;
 		Ref<Image> GetFinalImage() override;
+		GPUProfiler& GetGPUProfiler() override { return m_GPUProfiler; }
 
 	private:
 		void Flush();
+		void UpdateGPUProfiler();
+		void UpdateRenderScale();
+		void SelectMeshLods();
 		void PrepareBuffers();
 		void PrepareImages() const;
 		void UpdateDescriptors();
 
+		static std::array<Ref<Pipeline>, VertexPacking::FormatCount> CreateVertexFormatVariants(const Ref<Pipeline>& pipeline, bool positionsOnly);
+
 		void GuiPass();
 		void PreDepthPass();
 		void EnvPass();
@@ -56,11 +64,17 @@ namespace Eppo
 		Ref<Pipeline> m_GeometryPipeline;
 		Ref<Pipeline> m_DebugLinePipeline;
 		Ref<Pipeline> m_CompositePipeline;
+		Ref<Pipeline> m_UpscalePipeline;
+
+		// Variants per vertex format, only differing in vertex input state, rendering uses the attachments of the main pipelines
+		std::array<Ref<Pipeline>, VertexPacking::FormatCount> m_PreDepthPipelines;
+		std::array<Ref<Pipeline>, VertexPacking::FormatCount> m_GeometryPipelines;
 
 		static constexpr uint32_t s_MaxLights = 8;
 
 		// Frame in flight --> Set
 		std::unordered_map<uint32_t, std::array<VkDescriptorSet, 4>> m_DescriptorSets;
+		std::array<VkDescriptorSet, VulkanConfig::MaxFramesInFlight> m_CompositeDescriptorSets;
 
 		// Set 0, Binding 0
 		struct EnvironmentData
@@ -99,6 +113,8 @@ namespace Eppo
 
 		// Draw commands
 		std::unordered_map<EntityType, std::vector<Ref<DrawCommand>>> m_DrawList;
+		// LOD per submesh of every mesh command, in draw order
+		std::vector<uint32_t> m_SubmeshLods;
 
 		// Buffers
 		Buffer m_PushConstantBuffer;
@@ -106,8 +122,17 @@ namespace Eppo
 		Ref<IndexBuffer> m_DebugLineIndexBuffer;
 		uint32_t m_DebugLineCount = 0;
 
+		// Dynamic resolution
+		DynamicResolution m_DynamicResolution;
+		uint64_t m_LastScaledFrameCount = 0;
+		uint32_t m_RenderWidth = 0;
+		uint32_t m_RenderHeight = 0;
+		bool m_UpscaleActive = false;
+
 		// Statistics
 		RenderStatistics m_RenderStatistics;
+		GPUProfiler m_GPUProfiler;
+		uint64_t m_LastResolvedFrameCount = 0;
 
 		struct TimestampQueries
 		{
@@ -1,8 +1,8 @@
 #include "pch.h"
 #include "VulkanShader.h"
 
+#include "Asset/DerivedDataCache.h"
 #include "Core/Filesystem.h"
-#include "Core/Hash.h"
 #include "Platform/Vulkan/DescriptorLayoutBuilder.h"
 #include "Platform/Vulkan/VulkanContext.h"
 #include "Renderer/ShaderIncluder.h"
@@ -14,6 +14,9 @@ namespace Eppo
 {
 	namespace Utils
 	{
+		// Bump when the compile options change, cached variants are compiled again
+		static constexpr uint32_t ShaderCompilerVersion = 1;
+
 		inline shaderc_shader_kind ShaderStageToShaderCKind(const ShaderStage stage)
 		{
 			switch (stage)
@@ -136,42 +139,20 @@ namespace Eppo
 		}
 
 		m_ShaderBytes[stage] = std::vector(result.cbegin(), result.cend());
-
-		// TODO:
-		// Write cache
-		const std::string cachePath = Utils::GetOrCreateCacheDirectory().string() + "/" + GetName() + "." + Utils::ShaderStageToString(stage);
-		Filesystem::WriteBytes(cachePath, m_ShaderBytes.at(stage));
-
-		// Write cache hash
-		const std::string cacheHashPath = cachePath + ".hash";
-		const uint64_t hash = Hash::GenerateFnv(source);
-		Filesystem::WriteText(cacheHashPath, std::to_string(hash));
 	}
 
 	void VulkanShader::CompileOrGetCache(const std::unordered_map<ShaderStage, std::string>& sources)
 	{
 		EPPO_PROFILE_FUNCTION("VulkanShader::CompileOrGetCache");
 
-		const std::filesystem::path cacheDir = Utils::GetOrCreateCacheDirectory();
-
 		for (const auto& [stage, source] : sources)
 		{
-			std::string cacheFile = cacheDir.string() + "/" + GetName() + "." + Utils::ShaderStageToString(stage);
-			std::string cacheHashFile = cacheFile + ".hash";
+			DerivedDataKey key("Shader", Utils::ShaderCompilerVersion);
+			key.Append(static_cast<uint32_t>(stage));
+			key.Append(source);
 
-			// Check if cache needs to be busted
-			bool cacheVerified = false;
-			if (Filesystem::Exists(cacheFile) && Filesystem::Exists(cacheHashFile))
-			{
-				std::string hash = std::to_string(Hash::GenerateFnv(source));
-				std::string cacheHash = Filesystem::ReadText(cacheHashFile);
-
-				// Check if cache needs to be busted
-				if (cacheHash == hash)
-					cacheVerified = true;
-			}
-
-			if (cacheVerified)
+			if (const std::filesystem::path cacheFile = DerivedDataCache::GetFilepath(key, ".spv");
+				Filesystem::Exists(cacheFile))
 			{
 				EPPO_INFO("Loading shader cache: {}.glsl (Stage: {})", GetName(), Utils::ShaderStageToString(stage));
 
@@ -187,9 +168,12 @@ namespace Eppo
 			}
 			else
 			{
-				EPPO_INFO("Triggering recompilation of shader due to hash mismatch: {}.glsl (Stage: {})", GetName(), Utils::ShaderStageToString(stage));
+				EPPO_INFO("Compiling shader without a cached variant: {}.glsl (Stage: {})", GetName(), Utils::ShaderStageToString(stage));
 
 				Compile(stage, source);
+
+				const std::vector<uint32_t>& shaderBytes = m_ShaderBytes.at(stage);
+				DerivedDataCache::Put(key, ".spv", shaderBytes.data(), shaderBytes.size() * sizeof(uint32_t));
 			}
 		}
 	}
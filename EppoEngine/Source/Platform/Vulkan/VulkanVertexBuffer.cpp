@@ -95,7 +95,7 @@ namespace Eppo
 		// Copy data from staging buffer to GPU local buffer
 		const auto context = VulkanContext::Get();
 		const auto logicalDevice = context->GetLogicalDevice();
-		const VkCommandBuffer commandBuffer = logicalDevice->GetCommandBuffer(true);
+		const VkCommandBuffer commandBuffer = logicalDevice->GetUploadCommandBuffer();
 
 		VkBufferCopy copyRegion;
 		copyRegion.srcOffset = 0;
@@ -103,10 +103,9 @@ namespace Eppo
 		copyRegion.size = buffer.Size;
 
 		vkCmdCopyBuffer(commandBuffer, stagingBuffer, m_Buffer, 1, &copyRegion);
-		logicalDevice->FlushCommandBuffer(commandBuffer);
+		logicalDevice->FlushUploadCommandBuffer(commandBuffer, stagingBuffer, stagingBufferAlloc);
 
-		// Clean up
-		VulkanAllocator::DestroyBuffer(stagingBuffer, stagingBufferAlloc);
+		// Clean up, the staging buffer holds its own copy
 		buffer.Release();
 	}
 }
@@ -13,6 +13,7 @@ namespace Eppo
 		~VulkanVertexBuffer() override;
 
 		void SetData(Buffer buffer) override;
+		[[nodiscard]] uint64_t GetMemoryUsage() const override { return VulkanAllocator::GetAllocationSize(m_Allocation); }
 		[[nodiscard]] VkBuffer GetBuffer() const { return m_Buffer; }
 
 	private:
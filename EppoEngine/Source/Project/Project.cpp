@@ -2,6 +2,7 @@
 #include "Project.h"
 
 #include "Asset/AssetManager.h"
+#include "Asset/AssetManagerRuntime.h"
 #include "Project/ProjectSerializer.h"
 #include "Scene/SceneSerializer.h"
 
@@ -70,6 +71,8 @@ namespace Eppo
 			const auto assetManager = CreateRef<AssetManagerEditor>();
 			s_ActiveProject->m_AssetManager = assetManager;
 			assetManager->DeserializeAssetRegistry();
+			assetManager->SetMemoryBudget(project->GetSpecification().AssetMemoryBudget);
+			assetManager->StartFileWatcher();
 
 			return s_ActiveProject;
 		}
@@ -77,6 +80,27 @@ namespace Eppo
 		return nullptr;
 	}
 
+	Ref<Project> Project::OpenPacked(const std::vector<std::filesystem::path>& packFilepaths)
+	{
+		EPPO_PROFILE_FUNCTION("Project::OpenPacked");
+
+		const auto assetManager = CreateRef<AssetManagerRuntime>();
+		for (const auto& filepath : packFilepaths)
+		{
+			if (!assetManager->MountPack(filepath))
+				return nullptr;
+		}
+
+		const auto project = CreateRef<Project>();
+		project->m_AssetManager = assetManager;
+		project->m_Specification.StartScene = assetManager->GetStartScene();
+		if (!packFilepaths.empty())
+			project->m_Specification.ProjectDirectory = packFilepaths.front().parent_path();
+
+		s_ActiveProject = project;
+		return s_ActiveProject;
+	}
+
 	bool Project::SaveActive()
 	{
 		EPPO_PROFILE_FUNCTION("Project::SaveActive");
@@ -9,6 +9,15 @@ namespace Eppo
 		std::string Name = "Untitled";
 
 		AssetHandle StartScene = 0;
+
+		// Bytes resident assets may use before unreferenced ones are evicted, zero is unlimited
+		uint64_t AssetMemoryBudget = 0;
+
+		// Simulation steps per second while playing, and the most steps a single frame may take to catch up
+		uint32_t SimulationTickRate = 60;
+		uint32_t MaxSimulationSteps = 8;
+		// Physics steps on a thread of its own, a step ahead of the scene
+		bool ThreadedPhysics = false;
 		std::filesystem::path ProjectDirectory;
 	};
 
@@ -18,6 +27,7 @@ namespace Eppo
 		ProjectSpecification& GetSpecification() { return m_Specification; }
 		[[nodiscard]] Ref<AssetManagerBase> GetAssetManager() const { return m_AssetManager; }
 		[[nodiscard]] Ref<AssetManagerEditor> GetAssetManagerEditor() const { return std::static_pointer_cast<AssetManagerEditor>(m_AssetManager); }
+		void SetAssetManager(const Ref<AssetManagerBase>& assetManager) { m_AssetManager = assetManager; }
 
 		static const std::filesystem::path& GetProjectDirectory();
 		static std::filesystem::path GetProjectsDirectory();
@@ -32,6 +42,8 @@ namespace Eppo
 		static Ref<Project> New();
 		static Ref<Project> New(const ProjectSpecification& specification);
 		static Ref<Project> Open(const std::filesystem::path& filepath);
+		// Shipping builds, everything comes from the packs without reading project or registry files
+		static Ref<Project> OpenPacked(const std::vector<std::filesystem::path>& packFilepaths);
 		static bool SaveActive();
 
 	private:
@@ -24,6 +24,10 @@ namespace Eppo
 		out << YAML::Key << "Name" << YAML::Value << spec.Name;
 		out << YAML::Key << "ProjectDirectory" << YAML::Value << spec.ProjectDirectory.string();
 		out << YAML::Key << "StartScene" << YAML::Value << spec.StartScene;
+		out << YAML::Key << "AssetMemoryBudget" << YAML::Value << spec.AssetMemoryBudget;
+		out << YAML::Key << "SimulationTickRate" << YAML::Value << spec.SimulationTickRate;
+		out << YAML::Key << "MaxSimulationSteps" << YAML::Value << spec.MaxSimulationSteps;
+		out << YAML::Key << "ThreadedPhysics" << YAML::Value << spec.ThreadedPhysics;
 		out << YAML::EndMap;
 
 		out << YAML::EndMap;
@@ -64,6 +68,18 @@ namespace Eppo
 		if (projectNode["StartScene"])
 			spec.StartScene = projectNode["StartScene"].as<uint64_t>();
 
+		if (projectNode["AssetMemoryBudget"])
+			spec.AssetMemoryBudget = projectNode["AssetMemoryBudget"].as<uint64_t>();
+
+		if (projectNode["SimulationTickRate"])
+			spec.SimulationTickRate = projectNode["SimulationTickRate"].as<uint32_t>();
+
+		if (projectNode["MaxSimulationSteps"])
+			spec.MaxSimulationSteps = projectNode["MaxSimulationSteps"].as<uint32_t>();
+
+		if (projectNode["ThreadedPhysics"])
+			spec.ThreadedPhysics = projectNode["ThreadedPhysics"].as<bool>();
+
 		return true;
 	}
 }
@@ -17,10 +17,15 @@ namespace Eppo
 	{
 		Ref<Mesh> Mesh;
 		glm::mat4 Transform;
+		// Meshes outside the camera view are only submitted to cast shadows
+		bool CameraVisible = true;
 	};
 
 	struct PointLightCommand : DrawCommand
 	{
+		// Far plane of the shadow maps, meshes further away cast no shadow
+		static constexpr float ShadowRange = 50.0f;
+
 		glm::vec4 Color;
 		glm::vec3 Position;
 	};
@@ -0,0 +1,71 @@
+#include "pch.h"
+#include "DynamicResolution.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Eppo
+{
+	DynamicResolution::DynamicResolution(const DynamicResolutionSpecification& specification)
+		: m_Specification(specification)
+	{
+		Reset();
+	}
+
+	float DynamicResolution::Update(const float gpuTime)
+	{
+		EPPO_PROFILE_FUNCTION("DynamicResolution::Update");
+
+		if (!m_Specification.Enabled)
+		{
+			m_Scale = 1.0f;
+			return m_Scale;
+		}
+
+		// No timing available yet
+		if (gpuTime <= 0.0f)
+			return m_Scale;
+
+		const float target = m_Specification.TargetFrameTime;
+		const float upperBound = target * (1.0f + m_Specification.Hysteresis);
+		const float lowerBound = target * (1.0f - m_Specification.Hysteresis);
+
+		if (gpuTime > upperBound)
+		{
+			m_OverBudgetFrames++;
+			m_UnderBudgetFrames = 0;
+		}
+		else if (gpuTime < lowerBound && m_Scale < m_Specification.MaxScale)
+		{
+			m_UnderBudgetFrames++;
+			m_OverBudgetFrames = 0;
+		}
+		else
+		{
+			m_OverBudgetFrames = 0;
+			m_UnderBudgetFrames = 0;
+		}
+
+		if (m_OverBudgetFrames < m_Specification.SettleFrames && m_UnderBudgetFrames < m_Specification.SettleFrames)
+			return m_Scale;
+
+		// GPU cost roughly follows the amount of pixels, which is the square of the scale
+		const float desiredScale = m_Scale * std::sqrt(target / gpuTime);
+		const float step = std::clamp(desiredScale - m_Scale, -m_Specification.MaxScaleStep, m_Specification.MaxScaleStep);
+
+		m_Scale = std::clamp(m_Scale + step, m_Specification.MinScale, m_Specification.MaxScale);
+
+		// Give the new scale time to show up in the timings before adjusting again
+		m_OverBudgetFrames = 0;
+		m_UnderBudgetFrames = 0;
+
+		return m_Scale;
+	}
+
+	void DynamicResolution::Reset()
+	{
+		m_Scale = m_Specification.Enabled ? m_Specification.MaxScale : 1.0f;
+		m_OverBudgetFrames = 0;
+		m_UnderBudgetFrames = 0;
+	}
+}
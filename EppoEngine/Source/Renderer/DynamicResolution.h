@@ -0,0 +1,48 @@
+#pragma once
+
+namespace Eppo
+{
+	struct DynamicResolutionSpecification
+	{
+		bool Enabled = false;
+
+		// GPU frame time in milliseconds the controller tries to hit
+		float TargetFrameTime = 16.6f;
+
+		float MinScale = 0.5f;
+		float MaxScale = 1.0f;
+
+		// Largest change in scale that is allowed in a single adjustment
+		float MaxScaleStep = 0.05f;
+
+		// Relative band around the target frame time in which the scale is left alone
+		float Hysteresis = 0.1f;
+
+		// Consecutive frames the GPU time has to be outside of the band before adjusting
+		uint32_t SettleFrames = 8;
+
+		// Strength of the sharpening applied after upscaling
+		float Sharpness = 0.2f;
+	};
+
+	class DynamicResolution
+	{
+	public:
+		explicit DynamicResolution(const DynamicResolutionSpecification& specification = DynamicResolutionSpecification());
+
+		float Update(float gpuTime);
+		void Reset();
+
+		[[nodiscard]] float GetScale() const { return m_Scale; }
+
+		[[nodiscard]] const DynamicResolutionSpecification& GetSpecification() const { return m_Specification; }
+		DynamicResolutionSpecification& GetSpecification() { return m_Specification; }
+
+	private:
+		DynamicResolutionSpecification m_Specification;
+
+		float m_Scale = 1.0f;
+		uint32_t m_OverBudgetFrames = 0;
+		uint32_t m_UnderBudgetFrames = 0;
+	};
+}
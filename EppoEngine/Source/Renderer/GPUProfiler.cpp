@@ -0,0 +1,198 @@
+#include "pch.h"
+#include "GPUProfiler.h"
+
+#include "Core/Filesystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace Eppo
+{
+	namespace Utils
+	{
+		// Nearest rank percentile on sorted samples
+		static float Percentile(const std::vector<float>& sortedSamples, const float percentile)
+		{
+			const auto rank = static_cast<size_t>(std::ceil(percentile / 100.0f * static_cast<float>(sortedSamples.size())));
+			return sortedSamples[std::clamp<size_t>(rank, 1, sortedSamples.size()) - 1];
+		}
+	}
+
+	GPUProfiler::GPUProfiler(const uint32_t historySize)
+	{
+		EPPO_ASSERT(historySize > 0)
+		m_History.resize(historySize);
+	}
+
+	void GPUProfiler::BeginFrame(const uint64_t frameNumber)
+	{
+		if (m_FrameCount > 0)
+			m_Head = (m_Head + 1) % static_cast<uint32_t>(m_History.size());
+
+		m_FrameCount = std::min(m_FrameCount + 1, static_cast<uint32_t>(m_History.size()));
+
+		FrameRecord& record = m_History[m_Head];
+		record.FrameNumber = frameNumber;
+		record.Timings.assign(m_TimingNames.size(), 0.0f);
+		record.Statistics = PipelineStatistics();
+	}
+
+	void GPUProfiler::AddTiming(const std::string& name, const float time)
+	{
+		EPPO_ASSERT(m_FrameCount > 0)
+
+		const uint32_t index = GetTimingIndex(name);
+
+		FrameRecord& record = m_History[m_Head];
+		if (record.Timings.size() <= index)
+			record.Timings.resize(index + 1, 0.0f);
+
+		record.Timings[index] = time;
+	}
+
+	void GPUProfiler::SetPipelineStatistics(const PipelineStatistics& statistics)
+	{
+		EPPO_ASSERT(m_FrameCount > 0)
+
+		m_History[m_Head].Statistics = statistics;
+	}
+
+	void GPUProfiler::Clear()
+	{
+		m_Head = 0;
+		m_FrameCount = 0;
+	}
+
+	TimingStatistics GPUProfiler::GetStatistics(const std::string& name) const
+	{
+		EPPO_PROFILE_FUNCTION("GPUProfiler::GetStatistics");
+
+		const auto it = std::find(m_TimingNames.begin(), m_TimingNames.end(), name);
+		if (it == m_TimingNames.end())
+			return {};
+
+		const auto index = static_cast<size_t>(std::distance(m_TimingNames.begin(), it));
+
+		std::vector<float> samples;
+		samples.reserve(m_FrameCount);
+
+		for (uint32_t i = 0; i < m_FrameCount; i++)
+		{
+			const auto& timings = GetFrame(i).Timings;
+			samples.push_back(index < timings.size() ? timings[index] : 0.0f);
+		}
+
+		return CalculateStatistics(std::move(samples));
+	}
+
+	void GPUProfiler::ExportCSV(const std::filesystem::path& filepath) const
+	{
+		EPPO_PROFILE_FUNCTION("GPUProfiler::ExportCSV");
+
+		std::stringstream ss;
+
+		ss << "Frame";
+		for (const auto& name : m_TimingNames)
+			ss << "," << name;
+		ss << ",InputAssemblyVertices,InputAssemblyPrimitives,VertexShaderInvocations,ClippingInvocations,ClippingPrimitives,FragmentShaderInvocations\n";
+
+		for (uint32_t i = 0; i < m_FrameCount; i++)
+		{
+			const FrameRecord& record = GetFrame(i);
+
+			ss << record.FrameNumber;
+			for (size_t j = 0; j < m_TimingNames.size(); j++)
+				ss << "," << (j < record.Timings.size() ? record.Timings[j] : 0.0f);
+
+			const auto& stats = record.Statistics;
+			ss << "," << stats.InputAssemblyVertices << "," << stats.InputAssemblyPrimitives << "," << stats.VertexShaderInvocations;
+			ss << "," << stats.ClippingInvocations << "," << stats.ClippingPrimitives << "," << stats.FragmentShaderInvocations << "\n";
+		}
+
+		Filesystem::WriteText(filepath, ss.str());
+	}
+
+	void GPUProfiler::ExportJSON(const std::filesystem::path& filepath) const
+	{
+		EPPO_PROFILE_FUNCTION("GPUProfiler::ExportJSON");
+
+		std::stringstream ss;
+		ss << "{\n";
+		ss << "\t\"frames\": " << m_FrameCount << ",\n";
+
+		// Summary
+		ss << "\t\"timings\": {";
+		for (size_t i = 0; i < m_TimingNames.size(); i++)
+		{
+			const TimingStatistics stats = GetStatistics(m_TimingNames[i]);
+
+			ss << (i == 0 ? "\n" : ",\n");
+			ss << "\t\t\"" << m_TimingNames[i] << "\": { ";
+			ss << "\"min\": " << stats.Min << ", \"avg\": " << stats.Average << ", \"p95\": " << stats.P95 << ", \"p99\": " << stats.P99 << ", \"max\": " << stats.Max;
+			ss << " }";
+		}
+		ss << "\n\t},\n";
+
+		// History
+		ss << "\t\"history\": [";
+		for (uint32_t i = 0; i < m_FrameCount; i++)
+		{
+			const FrameRecord& record = GetFrame(i);
+			const auto& stats = record.Statistics;
+
+			ss << (i == 0 ? "\n" : ",\n");
+			ss << "\t\t{ \"frame\": " << record.FrameNumber;
+
+			for (size_t j = 0; j < m_TimingNames.size(); j++)
+				ss << ", \"" << m_TimingNames[j] << "\": " << (j < record.Timings.size() ? record.Timings[j] : 0.0f);
+
+			ss << ", \"inputAssemblyVertices\": " << stats.InputAssemblyVertices;
+			ss << ", \"inputAssemblyPrimitives\": " << stats.InputAssemblyPrimitives;
+			ss << ", \"vertexShaderInvocations\": " << stats.VertexShaderInvocations;
+			ss << ", \"clippingInvocations\": " << stats.ClippingInvocations;
+			ss << ", \"clippingPrimitives\": " << stats.ClippingPrimitives;
+			ss << ", \"fragmentShaderInvocations\": " << stats.FragmentShaderInvocations;
+			ss << " }";
+		}
+		ss << "\n\t]\n";
+		ss << "}\n";
+
+		Filesystem::WriteText(filepath, ss.str());
+	}
+
+	TimingStatistics GPUProfiler::CalculateStatistics(std::vector<float> samples)
+	{
+		TimingStatistics stats;
+		if (samples.empty())
+			return stats;
+
+		std::sort(samples.begin(), samples.end());
+
+		stats.Min = samples.front();
+		stats.Max = samples.back();
+		stats.Average = std::accumulate(samples.begin(), samples.end(), 0.0f) / static_cast<float>(samples.size());
+		stats.P95 = Utils::Percentile(samples, 95.0f);
+		stats.P99 = Utils::Percentile(samples, 99.0f);
+		stats.SampleCount = static_cast<uint32_t>(samples.size());
+
+		return stats;
+	}
+
+	const GPUProfiler::FrameRecord& GPUProfiler::GetFrame(const uint32_t index) const
+	{
+		// Index 0 is the oldest frame in the history
+		const auto size = static_cast<uint32_t>(m_History.size());
+		return m_History[(m_Head + size - m_FrameCount + 1 + index) % size];
+	}
+
+	uint32_t GPUProfiler::GetTimingIndex(const std::string& name)
+	{
+		if (const auto it = std::find(m_TimingNames.begin(), m_TimingNames.end(), name);
+			it != m_TimingNames.end())
+			return static_cast<uint32_t>(std::distance(m_TimingNames.begin(), it));
+
+		m_TimingNames.push_back(name);
+		return static_cast<uint32_t>(m_TimingNames.size() - 1);
+	}
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <filesystem>
+
+namespace Eppo
+{
+	struct PipelineStatistics
+	{
+		uint64_t InputAssemblyVertices = 0;
+		uint64_t InputAssemblyPrimitives = 0;
+		uint64_t VertexShaderInvocations = 0;
+		uint64_t ClippingInvocations = 0;
+		uint64_t ClippingPrimitives = 0;
+		uint64_t FragmentShaderInvocations = 0;
+	};
+
+	struct TimingStatistics
+	{
+		float Min = 0.0f;
+		float Average = 0.0f;
+		float P95 = 0.0f;
+		float P99 = 0.0f;
+		float Max = 0.0f;
+		uint32_t SampleCount = 0;
+	};
+
+	// Keeps a history of resolved GPU timings (in ms) and pipeline statistics per frame
+	class GPUProfiler
+	{
+	public:
+		explicit GPUProfiler(uint32_t historySize = 512);
+
+		void BeginFrame(uint64_t frameNumber);
+		void AddTiming(const std::string& name, float time);
+		void SetPipelineStatistics(const PipelineStatistics& statistics);
+		void Clear();
+
+		[[nodiscard]] TimingStatistics GetStatistics(const std::string& name) const;
+		[[nodiscard]] const std::vector<std::string>& GetTimingNames() const { return m_TimingNames; }
+		[[nodiscard]] uint32_t GetFrameCount() const { return m_FrameCount; }
+
+		void ExportCSV(const std::filesystem::path& filepath) const;
+		void ExportJSON(const std::filesystem::path& filepath) const;
+
+		static TimingStatistics CalculateStatistics(std::vector<float> samples);
+
+	private:
+		struct FrameRecord
+		{
+			uint64_t FrameNumber = 0;
+			std::vector<float> Timings;
+			PipelineStatistics Statistics;
+		};
+
+		[[nodiscard]] const FrameRecord& GetFrame(uint32_t index) const;
+		[[nodiscard]] uint32_t GetTimingIndex(const std::string& name);
+
+	private:
+		std::vector<FrameRecord> m_History;
+		uint32_t m_Head = 0;
+		uint32_t m_FrameCount = 0;
+
+		std::vector<std::string> m_TimingNames;
+	};
+}
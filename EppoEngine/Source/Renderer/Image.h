@@ -49,6 +49,7 @@ namespace Eppo
 		[[nodiscard]] virtual const ImageSpecification& GetSpecification() const = 0;
 		[[nodiscard]] virtual uint32_t GetWidth() const = 0;
 		[[nodiscard]] virtual uint32_t GetHeight() const = 0;
+		[[nodiscard]] virtual uint64_t GetMemoryUsage() const = 0;
 
 		static Ref<Image> Create(const ImageSpecification& specification);
 	};
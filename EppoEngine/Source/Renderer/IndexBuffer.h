@@ -11,6 +11,7 @@ namespace Eppo
 
 		virtual void SetData(Buffer buffer) = 0;
 		[[nodiscard]] virtual uint32_t GetIndexCount() const = 0;
+		[[nodiscard]] virtual uint64_t GetMemoryUsage() const = 0;
 
 		static Ref<IndexBuffer> Create(uint32_t size);
 		static Ref<IndexBuffer> Create(const void* data, uint32_t size);
@@ -0,0 +1,19 @@
+#include "pch.h"
+#include "Material.h"
+
+#include "Asset/DerivedDataCache.h"
+#include "Core/WeakCache.h"
+
+namespace Eppo
+{
+	// Weak, so a material lives exactly as long as something uses it
+	static WeakCache<uint64_t, Material> s_Materials;
+
+	Ref<Material> Material::Share(const Material& material, const DerivedDataKey& key)
+	{
+		if (Ref<Material> shared = s_Materials.Find(key.GetValue()))
+			return shared;
+
+		return s_Materials.Insert(key.GetValue(), CreateRef<Material>(material));
+	}
+}
@@ -2,6 +2,8 @@
 
 namespace Eppo
 {
+	class DerivedDataKey;
+
 	struct Material
 	{
 		float Roughness = 0.0f;
@@ -12,5 +14,8 @@ namespace Eppo
 		int32_t DiffuseMapIndex = -1;
 		int32_t NormalMapIndex = -1;
 		int32_t RoughnessMetallicMapIndex = -1;
+
+		// Equal keys share one instance across meshes, the key has to cover the textures behind the map indices
+		static Ref<Material> Share(const Material& material, const DerivedDataKey& key);
 	};
 }
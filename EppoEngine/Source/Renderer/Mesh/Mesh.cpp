@@ -1,6 +1,11 @@
 #include "pch.h"
 #include "Mesh.h"
 
+#include "Core/ThreadPool.h"
+#include "Renderer/Mesh/MeshCooker.h"
+#include "Renderer/Mesh/MeshOptimizer.h"
+#include "Renderer/Mesh/MeshSimplifier.h"
+#include "Renderer/RendererContext.h"
 #include "Renderer/Vertex.h"
 
 #include <glm/gtc/type_ptr.hpp>
@@ -11,11 +16,284 @@
 
 namespace Eppo
 {
-	Mesh::Mesh(std::filesystem::path filepath)
-		: m_Filepath(std::move(filepath))
+	// Stands in for images that failed to decode, which keeps the image indices of the materials intact
+	static constexpr uint8_t s_PlaceholderPixel[4] = { 255, 255, 255, 255 };
+
+	namespace Utils
+	{
+		template<typename T>
+		static void WidenIndices(const T* indices, const size_t count, uint32_t* dst)
+		{
+			for (size_t i = 0; i < count; i++)
+				dst[i] = indices[i];
+		}
+
+		// Replaces the encoded image loaded as is with RGBA8 pixels
+		static void DecodeImage(tinygltf::Image& image, const uint32_t index)
+		{
+			EPPO_PROFILE_FUNCTION("Mesh::DecodeImage");
+
+			// glTF images start at the top left like Vulkan, flipping is only wanted for loose image files
+			stbi_set_flip_vertically_on_load_thread(0);
+
+			int width;
+			int height;
+			int channels;
+			stbi_uc* pixels = stbi_load_from_memory(image.image.data(), static_cast<int>(image.image.size()), &width, &height, &channels, 4);
+
+			if (!pixels)
+			{
+				EPPO_ERROR("Failed to decode image {} '{}': {}", index, image.name, stbi_failure_reason());
+				image.image.clear();
+				image.width = image.height = image.component = -1;
+				return;
+			}
+
+			image.width = width;
+			image.height = height;
+			image.component = 4;
+			image.bits = 8;
+			image.as_is = false;
+			image.image.assign(pixels, pixels + static_cast<size_t>(width) * height * 4);
+
+			stbi_image_free(pixels);
+		}
+	}
+
+	Mesh::Mesh(std::filesystem::path filepath, const VertexFormat vertexFormat, const bool upload)
+		: m_Filepath(std::move(filepath)), m_VertexFormat(vertexFormat), m_ImportData(CreateScope<MeshImportData>())
 	{
 		EPPO_PROFILE_FUNCTION("Mesh::Mesh");
 
+		// The source contents key the cooked mesh, so unchanged sources are never imported again
+		const MappedFile source(m_Filepath);
+		if (!source.IsValid())
+			EPPO_ERROR("Failed to open mesh file '{}'!", m_Filepath.string());
+		else
+		{
+			const DerivedDataKey key = MeshCooker::GetCacheKey(source.GetData(), source.GetSize(), m_VertexFormat);
+			m_Valid = LoadCooked(key, DerivedDataCache::Load) || LoadSource(source, key);
+		}
+
+		if (upload && m_Valid)
+			Upload();
+	}
+
+	Mesh::Mesh(const DerivedDataKey& key, const DerivedDataLoader& loader, const VertexFormat vertexFormat, const bool upload)
+		: m_VertexFormat(vertexFormat), m_ImportData(CreateScope<MeshImportData>())
+	{
+		EPPO_PROFILE_FUNCTION("Mesh::Mesh");
+
+		m_Valid = LoadCooked(key, loader);
+		if (!m_Valid)
+			EPPO_ERROR("Failed to load cooked mesh {}!", key.ToString());
+
+		if (upload && m_Valid)
+			Upload();
+	}
+
+	void Mesh::Upload()
+	{
+		EPPO_PROFILE_FUNCTION("Mesh::Upload");
+
+		EPPO_ASSERT(m_ImportData)
+		if (!m_ImportData)
+			return;
+
+		// All uploads of the mesh go out in one submission
+		RendererContext::Get()->BeginUploadBatch();
+
+		// Textures already resident through other meshes are used as they are
+		for (const auto& image : m_ImportData->Images)
+		{
+			const Ref<Texture> texture = image.Resident ? image.Resident : Texture::Create(DerivedDataKey(image.Key), image.Width, image.Height, image.Pixels);
+
+			m_Textures.emplace_back(texture);
+			m_Images.emplace_back(texture->GetImage());
+		}
+
+		ShareMaterials();
+
+		m_Submeshes.reserve(m_ImportData->Submeshes.size());
+		for (const auto& submesh : m_ImportData->Submeshes)
+			m_Submeshes.emplace_back(submesh.Data);
+
+		RendererContext::Get()->EndUploadBatch();
+
+		// Box around the bounding spheres, a mesh without geometry is a point
+		m_BoundingBox = AABB(glm::vec3(0.0f), glm::vec3(0.0f));
+		for (size_t i = 0; i < m_Submeshes.size(); i++)
+		{
+			const Submesh& submesh = m_Submeshes[i];
+			const glm::vec3 radius(submesh.GetBoundingRadius());
+			const AABB bounds = AABB(submesh.GetBoundingCenter() - radius, submesh.GetBoundingCenter() + radius).Transform(submesh.GetLocalTransform());
+
+			m_BoundingBox = i == 0 ? bounds : AABB::Union(m_BoundingBox, bounds);
+		}
+
+		// Uploads copy through staging buffers, so the CPU side data and mappings can go
+		m_ImportData.reset();
+	}
+
+	AssetMemoryUsage Mesh::GetMemoryUsage() const
+	{
+		AssetMemoryUsage usage;
+
+		for (const auto& submesh : m_Submeshes)
+		{
+			if (submesh.GetVertexBuffer())
+				usage.Gpu += submesh.GetVertexBuffer()->GetMemoryUsage();
+			if (submesh.GetPositionBuffer())
+				usage.Gpu += submesh.GetPositionBuffer()->GetMemoryUsage();
+			if (submesh.GetIndexBuffer())
+				usage.Gpu += submesh.GetIndexBuffer()->GetMemoryUsage();
+		}
+
+		// Textures are shared with other meshes and texture assets through their key. Only the ones this mesh
+		// alone holds are counted, evicting the mesh frees those. Shared ones count with whoever loaded them first.
+		std::unordered_map<const Texture*, long> holders;
+		for (const auto& texture : m_Textures)
+			holders[texture.get()]++;
+
+		for (const auto& texture : m_Textures)
+		{
+			const auto it = holders.find(texture.get());
+			if (it == holders.end())
+				continue;
+
+			if (texture.use_count() == it->second)
+				usage.Gpu += texture->GetImage()->GetMemoryUsage();
+
+			// Embedded images with equal contents list the same texture more than once
+			holders.erase(it);
+		}
+
+		// Only meshes that are not uploaded yet hold on to CPU side data
+		if (m_ImportData)
+		{
+			for (const auto& image : m_ImportData->Images)
+				usage.Cpu += image.Storage.size();
+
+			for (const auto& submesh : m_ImportData->Submeshes)
+				usage.Cpu += submesh.Vertices.size() + submesh.Positions.size() + submesh.Indices.size() * sizeof(uint32_t);
+
+			for (const auto& data : m_ImportData->CookedData)
+				usage.Cpu += data.Size;
+		}
+
+		return usage;
+	}
+
+	bool Mesh::LoadCooked(const DerivedDataKey& key, const DerivedDataLoader& loader)
+	{
+		EPPO_PROFILE_FUNCTION("Mesh::LoadCooked");
+
+		DerivedData cooked = loader(key, MeshCooker::MeshExtension);
+		if (!cooked.IsValid())
+			return false;
+
+		const CookedMeshHeader* header = MeshCooker::Validate(cooked.Data, cooked.Size, key, m_VertexFormat);
+		if (!header)
+		{
+			EPPO_WARN("Cooked mesh {} of '{}' is invalid", key.ToString(), m_Filepath.string());
+			return false;
+		}
+
+		const uint8_t* data = cooked.Data;
+		MeshImportData importData;
+
+		// Textures first, a missing one invalidates the whole cooked mesh
+		const auto* textures = reinterpret_cast<const CookedTexture*>(data + header->TextureOffset);
+		for (uint32_t i = 0; i < header->TextureCount; i++)
+		{
+			const DerivedDataKey textureKey(textures[i].Key);
+
+			ImportedImage& image = importData.Images.emplace_back();
+			image.Key = textureKey.GetValue();
+
+			// Resident through another mesh, the cooked texture is not read at all
+			if ((image.Resident = Texture::Find(textureKey)))
+				continue;
+
+			DerivedData texture = loader(textureKey, MeshCooker::TextureExtension);
+			const CookedTextureHeader* textureHeader = MeshCooker::ValidateTexture(texture.Data, texture.Size, textureKey);
+			if (!textureHeader)
+			{
+				EPPO_INFO("Cooked texture {} is missing or invalid", textureKey.ToString());
+				return false;
+			}
+
+			image.Width = textureHeader->Width;
+			image.Height = textureHeader->Height;
+			image.Pixels = texture.Data + textureHeader->Pixels.Offset;
+
+			importData.CookedData.emplace_back(std::move(texture));
+		}
+
+		const auto* materials = reinterpret_cast<const CookedMaterial*>(data + header->MaterialOffset);
+		for (uint32_t i = 0; i < header->MaterialCount; i++)
+		{
+			const auto material = CreateRef<Material>();
+			material->Roughness = materials[i].Roughness;
+			material->Metallic = materials[i].Metallic;
+			material->NormalMapIntensity = materials[i].NormalMapIntensity;
+			material->DiffuseColor = materials[i].DiffuseColor;
+			material->DiffuseMapIndex = materials[i].DiffuseMapIndex;
+			material->NormalMapIndex = materials[i].NormalMapIndex;
+			material->RoughnessMetallicMapIndex = materials[i].RoughnessMetallicMapIndex;
+
+			m_Materials.emplace_back(material);
+		}
+
+		// Blobs are uploaded from the mapping as is, no per-vertex work
+		const auto* submeshes = reinterpret_cast<const CookedSubmesh*>(data + header->SubmeshOffset);
+		const auto* primitives = reinterpret_cast<const CookedPrimitive*>(data + header->PrimitiveOffset);
+
+		importData.Submeshes.resize(header->SubmeshCount);
+
+		for (uint32_t i = 0; i < header->SubmeshCount; i++)
+		{
+			const CookedSubmesh& submesh = submeshes[i];
+
+			SubmeshData& submeshData = importData.Submeshes[i].Data;
+			submeshData.Name.assign(reinterpret_cast<const char*>(data + submesh.Name.Offset), submesh.Name.Size);
+			submeshData.Transform = submesh.Transform;
+			submeshData.Format = m_VertexFormat;
+			submeshData.Quantization = { submesh.QuantizationOffset, submesh.QuantizationScale };
+			submeshData.BoundingCenter = submesh.BoundingCenter;
+			submeshData.BoundingRadius = submesh.BoundingRadius;
+			submeshData.Vertices = { data + submesh.Vertices.Offset, static_cast<uint32_t>(submesh.Vertices.Size) };
+			submeshData.Positions = { data + submesh.Positions.Offset, static_cast<uint32_t>(submesh.Positions.Size) };
+			submeshData.Indices = { data + submesh.Indices.Offset, static_cast<uint32_t>(submesh.Indices.Size) };
+
+			for (uint32_t j = 0; j < submesh.PrimitiveCount; j++)
+			{
+				const CookedPrimitive& cookedPrimitive = primitives[submesh.FirstPrimitive + j];
+
+				Primitive& primitive = submeshData.Primitives.emplace_back();
+				primitive.FirstVertex = cookedPrimitive.FirstVertex;
+				primitive.FirstIndex = cookedPrimitive.FirstIndex;
+				primitive.VertexCount = cookedPrimitive.VertexCount;
+				primitive.IndexCount = cookedPrimitive.IndexCount;
+				primitive.MaterialIndex = cookedPrimitive.MaterialIndex;
+				primitive.Lods.assign(cookedPrimitive.Lods, cookedPrimitive.Lods + cookedPrimitive.LodCount);
+
+				if (primitive.MaterialIndex > -1 && static_cast<size_t>(primitive.MaterialIndex) < m_Materials.size())
+					primitive.Material = m_Materials[primitive.MaterialIndex];
+			}
+		}
+
+		importData.CookedData.emplace_back(std::move(cooked));
+		*m_ImportData = std::move(importData);
+
+		EPPO_TRACE("Loaded cooked mesh {} of '{}'", key.ToString(), m_Filepath.string());
+		return true;
+	}
+
+	bool Mesh::LoadSource(const MappedFile& source, const DerivedDataKey& key)
+	{
+		EPPO_PROFILE_FUNCTION("Mesh::LoadSource");
+
 		tinygltf::Model model;
 		std::string error;
 		std::string warning;
@@ -23,9 +301,13 @@ namespace Eppo
 		{
 			EPPO_PROFILE_FUNCTION("LoadGLB");
 
+			// Images are kept encoded here and decoded in parallel below
 			tinygltf::TinyGLTF loader;
-			const bool result = loader.LoadBinaryFromFile(&model, &error, &warning, m_Filepath.string());
-			
+			loader.SetImagesAsIs(true);
+
+			// Parsed from the mapping the cache key was hashed from, the file is read once
+			const bool result = loader.LoadBinaryFromMemory(&model, &error, &warning, source.GetData(), static_cast<uint32_t>(source.GetSize()), m_Filepath.parent_path().string());
+
 			if (!warning.empty())
 				EPPO_WARN(warning);
 			if (!error.empty())
@@ -34,54 +316,106 @@ namespace Eppo
 			if (!result)
 			{
 				EPPO_ERROR("Failed to parse mesh file '{}'!", m_Filepath.string());
-				return;
+				return false;
 			}
 		}
 
-		ProcessMaterials(model);
-		ProcessImages(model);
+		MeshCooker cooker(key, m_VertexFormat);
 
-		for (const auto& node : model.nodes)
-			ProcessNode(model, node);
-	}
+		// Materials are only read from here on
+		ProcessMaterials(model, cooker);
 
-	void Mesh::ProcessNode(const tinygltf::Model& model, const tinygltf::Node& node)
-	{
-		EPPO_PROFILE_FUNCTION("Mesh::ProcessNode");
+		std::vector<const tinygltf::Node*> meshNodes;
+		for (const auto& node : model.nodes)
+			CollectMeshNodes(model, node, meshNodes);
 
-		if (const int32_t meshIndex = node.mesh;
-			meshIndex > -1)
+		// Files cut short while being saved can still parse, but there is nothing to draw
+		if (meshNodes.empty())
 		{
-			// Get local mesh transform
-			auto localTransform = glm::mat4(1.0f);
+			EPPO_ERROR("Mesh file '{}' contains no meshes!", m_Filepath.string());
+			return false;
+		}
 
-			if (!node.translation.empty())
-			{
-				const glm::vec3 translation = glm::make_vec3(node.translation.data());
-				localTransform = glm::translate(localTransform, translation);
-			}
+		// Image decoding and submesh processing share the workers, uploads stay on this thread
+		std::vector<ImportedSubmesh> submeshes(meshNodes.size());
+		const uint32_t imageCount = static_cast<uint32_t>(model.images.size());
+		std::vector<DerivedDataKey> imageKeys(imageCount, DerivedDataKey(0));
+		std::vector<Ref<Texture>> residentTextures(imageCount);
 
-			if (!node.rotation.empty())
+		ThreadPool::Get().ParallelFor(imageCount + static_cast<uint32_t>(meshNodes.size()), [&](const uint32_t index)
+		{
+			if (index < imageCount)
 			{
-				const glm::quat rotation = glm::make_quat(node.rotation.data());
-				localTransform *= glm::mat4(rotation);
+				// Keyed by the encoded bytes, which are replaced by the decoded pixels
+				const tinygltf::Image& image = model.images[index];
+				const DerivedDataKey key = MeshCooker::GetTextureCacheKey(image.image.data(), image.image.size());
+				imageKeys[index] = key;
+
+				// Resident and cooked textures are neither decoded nor uploaded again
+				if (Ref<Texture> texture = Texture::Find(key); texture && DerivedDataCache::Contains(key, MeshCooker::TextureExtension))
+					residentTextures[index] = texture;
+				else
+					Utils::DecodeImage(model.images[index], index);
 			}
+			else
+				ProcessNode(model, *meshNodes[index - imageCount], submeshes[index - imageCount]);
+		});
 
-			if (!node.scale.empty())
-			{
-				const glm::vec3 scale = glm::make_vec3(node.scale.data());
-				localTransform = glm::scale(localTransform, scale);
-			}
+		ProcessImages(model, imageKeys, residentTextures, cooker);
 
-			auto [vertices, indices, primitives] = GetVertexData(model, model.meshes[meshIndex]);
-			m_Submeshes.emplace_back(node.name, vertices, indices, primitives, localTransform);
-		}
+		for (const auto& submesh : submeshes)
+			cooker.AddSubmesh(submesh.Data);
+
+		// Moving keeps the storage the blobs point into
+		m_ImportData->Submeshes = std::move(submeshes);
+
+		cooker.Write();
+		return true;
+	}
+
+	void Mesh::CollectMeshNodes(const tinygltf::Model& model, const tinygltf::Node& node, std::vector<const tinygltf::Node*>& meshNodes)
+	{
+		if (node.mesh > -1)
+			meshNodes.push_back(&node);
 
 		for (size_t i = 0; i < node.children.size(); i++)
-			ProcessNode(model, model.nodes[i]);
+			CollectMeshNodes(model, model.nodes[i], meshNodes);
+	}
+
+	void Mesh::ProcessNode(const tinygltf::Model& model, const tinygltf::Node& node, ImportedSubmesh& submesh) const
+	{
+		EPPO_PROFILE_FUNCTION("Mesh::ProcessNode");
+
+		// Get local mesh transform
+		auto localTransform = glm::mat4(1.0f);
+
+		if (!node.translation.empty())
+		{
+			const glm::vec3 translation = glm::make_vec3(node.translation.data());
+			localTransform = glm::translate(localTransform, translation);
+		}
+
+		if (!node.rotation.empty())
+		{
+			const glm::quat rotation = glm::make_quat(node.rotation.data());
+			localTransform *= glm::mat4(rotation);
+		}
+
+		if (!node.scale.empty())
+		{
+			const glm::vec3 scale = glm::make_vec3(node.scale.data());
+			localTransform = glm::scale(localTransform, scale);
+		}
+
+		MeshData meshData = GetVertexData(model, model.meshes[node.mesh]);
+		EPPO_TRACE("Submesh '{}': ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}", node.name,
+			meshData.CacheBefore.GetACMR(), meshData.CacheAfter.GetACMR(), meshData.CacheBefore.GetATVR(), meshData.CacheAfter.GetATVR());
+
+		submesh.Indices = std::move(meshData.Indices);
+		submesh.Data = Submesh::Pack(node.name, meshData.Vertices, submesh.Indices, meshData.Primitives, localTransform, m_VertexFormat, submesh.Vertices, submesh.Positions);
 	}
 
-	void Mesh::ProcessMaterials(const tinygltf::Model& model)
+	void Mesh::ProcessMaterials(const tinygltf::Model& model, MeshCooker& cooker)
 	{
 		EPPO_PROFILE_FUNCTION("Mesh::ProcessMaterials");
 
@@ -112,32 +446,76 @@ namespace Eppo
 				material->RoughnessMetallicMapIndex = model.textures[mat.pbrMetallicRoughness.metallicRoughnessTexture.index].source;
 
 			m_Materials[i] = material;
+			cooker.AddMaterial(*material);
 		}
 	}
 
-	void Mesh::ProcessImages(const tinygltf::Model& model)
+	void Mesh::ProcessImages(tinygltf::Model& model, const std::vector<DerivedDataKey>& imageKeys, const std::vector<Ref<Texture>>& residentTextures, MeshCooker& cooker) const
 	{
 		EPPO_PROFILE_FUNCTION("Mesh::ProcessImages");
 
-		for (const auto& image : model.images)
+		m_ImportData->Images.resize(model.images.size());
+
+		for (size_t i = 0; i < model.images.size(); i++)
 		{
-			ImageSpecification imageSpec;
-			imageSpec.Width = image.width;
-			imageSpec.Height = image.height;
-			imageSpec.Usage = ImageUsage::Texture;
+			tinygltf::Image& image = model.images[i];
+			ImportedImage& importedImage = m_ImportData->Images[i];
+			importedImage.Key = imageKeys[i].GetValue();
 
-			if (image.component == 4)
+			if (residentTextures[i])
 			{
-				imageSpec.Format = ImageFormat::RGBA8;
-
-				Ref<Image> dstImage = Image::Create(imageSpec);
-				dstImage->SetData((void*)image.image.data());
+				importedImage.Resident = residentTextures[i];
+				cooker.AddCachedTexture(imageKeys[i]);
+				continue;
+			}
 
-				m_Images.emplace_back(dstImage);
+			// Decoding always yields four channels, failed images are left empty
+			if (image.component == 4)
+			{
+				importedImage.Width = image.width;
+				importedImage.Height = image.height;
+				importedImage.Storage = std::move(image.image);
+				importedImage.Pixels = importedImage.Storage.data();
 			}
 			else
 			{
-				EPPO_ASSERT(false) // TODO: not supported yet
+				importedImage.Width = 1;
+				importedImage.Height = 1;
+				importedImage.Pixels = s_PlaceholderPixel;
+			}
+
+			cooker.AddTexture(imageKeys[i], importedImage.Width, importedImage.Height, ImageFormat::RGBA8, importedImage.Pixels, static_cast<uint64_t>(importedImage.Width) * importedImage.Height * 4);
+		}
+	}
+
+	void Mesh::ShareMaterials()
+	{
+		EPPO_PROFILE_FUNCTION("Mesh::ShareMaterials");
+
+		const auto& images = m_ImportData->Images;
+		const auto getImageKey = [&images](const int32_t index)
+		{
+			return index > -1 && static_cast<size_t>(index) < images.size() ? images[index].Key : 0;
+		};
+
+		for (auto& material : m_Materials)
+		{
+			// Map indices are local to the mesh, so the key covers both the indices and the textures behind them
+			DerivedDataKey key("Material", 1);
+			key.Append(material->Roughness).Append(material->Metallic).Append(material->NormalMapIntensity).Append(material->DiffuseColor);
+			key.Append(material->DiffuseMapIndex).Append(getImageKey(material->DiffuseMapIndex));
+			key.Append(material->NormalMapIndex).Append(getImageKey(material->NormalMapIndex));
+			key.Append(material->RoughnessMetallicMapIndex).Append(getImageKey(material->RoughnessMetallicMapIndex));
+
+			material = Material::Share(*material, key);
+		}
+
+		for (auto& submesh : m_ImportData->Submeshes)
+		{
+			for (auto& primitive : submesh.Data.Primitives)
+			{
+				if (primitive.MaterialIndex > -1 && static_cast<size_t>(primitive.MaterialIndex) < m_Materials.size())
+					primitive.Material = m_Materials[primitive.MaterialIndex];
 			}
 		}
 	}
@@ -146,89 +524,164 @@ namespace Eppo
 	{
 		EPPO_PROFILE_FUNCTION("Mesh::GetVertexData");
 
+		// Primitives are converted, optimized and simplified on their own, then appended in order
+		std::vector<MeshData> primitiveData(mesh.primitives.size());
+		ThreadPool::Get().ParallelFor(static_cast<uint32_t>(mesh.primitives.size()), [&](const uint32_t index)
+		{
+			primitiveData[index] = GetPrimitiveData(model, mesh.primitives[index]);
+		});
+
 		MeshData meshData;
 
-		for (const auto& primitive : mesh.primitives)
+		for (auto& data : primitiveData)
 		{
-			Primitive& p = meshData.Primitives.emplace_back();
-			p.FirstVertex = static_cast<uint32_t>(meshData.Vertices.size());
-			p.FirstIndex = static_cast<uint32_t>(meshData.Indices.size());
+			const auto firstVertex = static_cast<uint32_t>(meshData.Vertices.size());
+			const auto firstIndex = static_cast<uint32_t>(meshData.Indices.size());
 
-			uint32_t vertexCount = 0;
-			uint32_t indexCount = 0;
+			Primitive& p = meshData.Primitives.emplace_back(std::move(data.Primitives[0]));
+			p.FirstVertex += firstVertex;
+			p.FirstIndex += firstIndex;
 
-			const float* positionData = nullptr;
-			const float* normalData = nullptr;
-			const float* texCoordData = nullptr;
+			for (auto& lod : p.Lods)
+				lod.FirstIndex += firstIndex;
 
-			// Vertices
-			if (primitive.attributes.find("POSITION") != primitive.attributes.end())
-			{
-				const auto& accessor = model.accessors[primitive.attributes.find("POSITION")->second];
-				const auto& bufferView = model.bufferViews[accessor.bufferView];
-				positionData = reinterpret_cast<const float*>(&(model.buffers[bufferView.buffer].data[accessor.byteOffset + bufferView.byteOffset]));
-				vertexCount = static_cast<uint32_t>(accessor.count);
-			}
+			meshData.Vertices.insert(meshData.Vertices.end(), data.Vertices.begin(), data.Vertices.end());
+			meshData.Indices.insert(meshData.Indices.end(), data.Indices.begin(), data.Indices.end());
 
-			if (primitive.attributes.find("NORMAL") != primitive.attributes.end())
-			{
-				const auto& accessor = model.accessors[primitive.attributes.find("NORMAL")->second];
-				const auto& bufferView = model.bufferViews[accessor.bufferView];
-				normalData = reinterpret_cast<const float*>(&(model.buffers[bufferView.buffer].data[accessor.byteOffset + bufferView.byteOffset]));
-			}
+			meshData.CacheBefore += data.CacheBefore;
+			meshData.CacheAfter += data.CacheAfter;
+		}
 
-			if (primitive.attributes.find("TEXCOORD_0") != primitive.attributes.end())
-			{
-				const auto& accessor = model.accessors[primitive.attributes.find("TEXCOORD_0")->second];
-				const auto& bufferView = model.bufferViews[accessor.bufferView];
-				texCoordData = reinterpret_cast<const float*>(&(model.buffers[bufferView.buffer].data[accessor.byteOffset + bufferView.byteOffset]));
-			}
+		return meshData;
+	}
 
-			const size_t offset = meshData.Vertices.size();
-			meshData.Vertices.resize(offset + vertexCount);
+	MeshData Mesh::GetPrimitiveData(const tinygltf::Model& model, const tinygltf::Primitive& primitive) const
+	{
+		EPPO_PROFILE_FUNCTION("Mesh::GetPrimitiveData");
 
-			for (size_t i = 0; i < vertexCount; i++)
-			{
-				Vertex& vertex = meshData.Vertices[offset + i];
-				vertex.Position = glm::make_vec3(&positionData[i * 3]);
-				vertex.Normal = glm::make_vec3(&normalData[i * 3]);
-				vertex.TexCoord = glm::make_vec2(&texCoordData[i * 2]);
-			}
+		MeshData meshData;
+
+		Primitive& p = meshData.Primitives.emplace_back();
+
+		uint32_t vertexCount = 0;
+
+		const float* positionData = nullptr;
+		const float* normalData = nullptr;
+		const float* texCoordData = nullptr;
 
-			// Indices
-			const auto& accessor = model.accessors[primitive.indices];
+		// Vertices
+		if (primitive.attributes.find("POSITION") != primitive.attributes.end())
+		{
+			const auto& accessor = model.accessors[primitive.attributes.find("POSITION")->second];
 			const auto& bufferView = model.bufferViews[accessor.bufferView];
-			const auto& buffer = model.buffers[bufferView.buffer];
+			positionData = reinterpret_cast<const float*>(&(model.buffers[bufferView.buffer].data[accessor.byteOffset + bufferView.byteOffset]));
+			vertexCount = static_cast<uint32_t>(accessor.count);
+		}
 
-			meshData.Indices.reserve(accessor.count + meshData.Indices.size());
+		if (primitive.attributes.find("NORMAL") != primitive.attributes.end())
+		{
+			const auto& accessor = model.accessors[primitive.attributes.find("NORMAL")->second];
+			const auto& bufferView = model.bufferViews[accessor.bufferView];
+			normalData = reinterpret_cast<const float*>(&(model.buffers[bufferView.buffer].data[accessor.byteOffset + bufferView.byteOffset]));
+		}
 
-			if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT)
-			{
-				const auto* data = reinterpret_cast<const uint32_t*>(&buffer.data[bufferView.byteOffset + accessor.byteOffset]);
-				for (size_t i = 0; i < accessor.count; i++)
-					meshData.Indices.push_back(data[i]);
-			}
-			else if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT)
-			{
-				const auto* data = reinterpret_cast<const uint16_t*>(&buffer.data[bufferView.byteOffset + accessor.byteOffset]);
-				for (size_t i = 0; i < accessor.count; i++)
-					meshData.Indices.push_back(data[i]);
-			}
-			else if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE)
-			{
-				const auto* data = reinterpret_cast<const uint8_t*>(&buffer.data[bufferView.byteOffset + accessor.byteOffset]);
-				for (size_t i = 0; i < accessor.count; i++)
-					meshData.Indices.push_back(data[i]);
-			}
+		if (primitive.attributes.find("TEXCOORD_0") != primitive.attributes.end())
+		{
+			const auto& accessor = model.accessors[primitive.attributes.find("TEXCOORD_0")->second];
+			const auto& bufferView = model.bufferViews[accessor.bufferView];
+			texCoordData = reinterpret_cast<const float*>(&(model.buffers[bufferView.buffer].data[accessor.byteOffset + bufferView.byteOffset]));
+		}
 
-			p.VertexCount = vertexCount;
-			p.IndexCount = static_cast<uint32_t>(accessor.count);
+		meshData.Vertices.resize(vertexCount);
 
-			// Material
-			if (primitive.material != -1)
-				p.Material = m_Materials[primitive.material];
+		for (size_t i = 0; i < vertexCount; i++)
+		{
+			Vertex& vertex = meshData.Vertices[i];
+			vertex.Position = glm::make_vec3(&positionData[i * 3]);
+			vertex.Normal = glm::make_vec3(&normalData[i * 3]);
+			vertex.TexCoord = glm::make_vec2(&texCoordData[i * 2]);
 		}
 
+		// Indices
+		const auto& accessor = model.accessors[primitive.indices];
+		const auto& bufferView = model.bufferViews[accessor.bufferView];
+		const auto& buffer = model.buffers[bufferView.buffer];
+
+		// Widened to 32 bit indices
+		meshData.Indices.resize(accessor.count);
+		const uint8_t* indexData = &buffer.data[bufferView.byteOffset + accessor.byteOffset];
+
+		if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT)
+			std::memcpy(meshData.Indices.data(), indexData, accessor.count * sizeof(uint32_t));
+		else if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT)
+			Utils::WidenIndices(reinterpret_cast<const uint16_t*>(indexData), accessor.count, meshData.Indices.data());
+		else if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE)
+			Utils::WidenIndices(indexData, accessor.count, meshData.Indices.data());
+
+		p.VertexCount = vertexCount;
+		p.IndexCount = static_cast<uint32_t>(accessor.count);
+
+		OptimizePrimitive(meshData, p);
+		GenerateLods(meshData, p);
+
+		// Material
+		p.MaterialIndex = primitive.material;
+		if (primitive.material != -1)
+			p.Material = m_Materials[primitive.material];
+
 		return meshData;
 	}
+
+	void Mesh::OptimizePrimitive(MeshData& meshData, Primitive& primitive)
+	{
+		EPPO_PROFILE_FUNCTION("Mesh::OptimizePrimitive");
+
+		uint32_t* indices = &meshData.Indices[primitive.FirstIndex];
+		Vertex* vertices = &meshData.Vertices[primitive.FirstVertex];
+
+		meshData.CacheBefore += MeshOptimizer::AnalyzeVertexCache(indices, primitive.IndexCount, primitive.VertexCount);
+
+		MeshOptimizer::OptimizeVertexCache(indices, primitive.IndexCount, primitive.VertexCount);
+		MeshOptimizer::OptimizeOverdraw(indices, primitive.IndexCount, vertices, primitive.VertexCount);
+
+		// Primitive vertices are last in the buffer, so unused ones can simply be cut off
+		primitive.VertexCount = static_cast<uint32_t>(MeshOptimizer::OptimizeVertexFetch(vertices, primitive.VertexCount, indices, primitive.IndexCount));
+		meshData.Vertices.resize(primitive.FirstVertex + primitive.VertexCount);
+
+		meshData.CacheAfter += MeshOptimizer::AnalyzeVertexCache(indices, primitive.IndexCount, primitive.VertexCount);
+	}
+
+	void Mesh::GenerateLods(MeshData& meshData, Primitive& primitive)
+	{
+		EPPO_PROFILE_FUNCTION("Mesh::GenerateLods");
+
+		// Every LOD is simplified from the full detail indices, each with half the triangles of the previous one
+		const std::vector<uint32_t> sourceIndices(meshData.Indices.begin() + primitive.FirstIndex, meshData.Indices.begin() + primitive.FirstIndex + primitive.IndexCount);
+		const Vertex* vertices = &meshData.Vertices[primitive.FirstVertex];
+
+		size_t previousIndexCount = sourceIndices.size();
+
+		for (uint32_t lod = 1; lod < Primitive::MaxLods; lod++)
+		{
+			MeshSimplifierSpecification spec;
+			spec.TargetIndexCount = previousIndexCount / 6 * 3;
+
+			float error = 0.0f;
+			std::vector<uint32_t> indices = MeshSimplifier::Simplify(vertices, primitive.VertexCount, sourceIndices.data(), sourceIndices.size(), spec, &error);
+
+			// Stop when the simplifier cannot meaningfully reduce the mesh anymore
+			if (indices.empty() || indices.size() > previousIndexCount * 3 / 4)
+				break;
+
+			MeshOptimizer::OptimizeVertexCache(indices.data(), indices.size(), primitive.VertexCount);
+
+			PrimitiveLod& primitiveLod = primitive.Lods.emplace_back();
+			primitiveLod.FirstIndex = static_cast<uint32_t>(meshData.Indices.size());
+			primitiveLod.IndexCount = static_cast<uint32_t>(indices.size());
+			primitiveLod.Error = error;
+
+			meshData.Indices.insert(meshData.Indices.end(), indices.begin(), indices.end());
+			previousIndexCount = indices.size();
+		}
+	}
 }
@@ -1,9 +1,14 @@
 #pragma once
 
 #include "Asset/Asset.h"
+#include "Asset/DerivedDataCache.h"
+#include "Core/Geometry.h"
+#include "Platform/MappedFile.h"
+#include "Renderer/Mesh/MeshOptimizer.h"
 #include "Renderer/Mesh/Submesh.h"
 #include "Renderer/Mesh/Material.h"
 #include "Renderer/Image.h"
+#include "Renderer/Texture.h"
 #include "Renderer/Vertex.h"
 
 namespace tinygltf
@@ -11,26 +16,83 @@ namespace tinygltf
 	class Model;
 	class Node;
 	struct Mesh;
+	struct Primitive;
 }
 
 namespace Eppo
 {
+	class MeshCooker;
+
 	struct MeshData
 	{
 		std::vector<Vertex> Vertices;
 		std::vector<uint32_t> Indices;
 		std::vector<Primitive> Primitives;
+
+		// Post-transform cache behaviour of the full detail primitives, before and after optimization
+		VertexCacheStatistics CacheBefore;
+		VertexCacheStatistics CacheAfter;
+	};
+
+	// Packed submesh of the import, the data blobs point into the storage
+	struct ImportedSubmesh
+	{
+		SubmeshData Data;
+
+		std::vector<uint8_t> Vertices;
+		std::vector<uint8_t> Positions;
+		std::vector<uint32_t> Indices;
+	};
+
+	// Decoded RGBA8 image of the import, the pixels point into the storage or a mapped cooked texture
+	struct ImportedImage
+	{
+		// Derived data key of the texture
+		uint64_t Key = 0;
+		// Set when the texture is resident already, then there are no pixels
+		Ref<Texture> Resident;
+
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		const uint8_t* Pixels = nullptr;
+
+		std::vector<uint8_t> Storage;
+	};
+
+	// CPU side results of loading, kept until the GPU resources are created
+	struct MeshImportData
+	{
+		std::vector<ImportedImage> Images;
+		std::vector<ImportedSubmesh> Submeshes;
+
+		// Cooked data the images and submeshes point into
+		std::vector<DerivedData> CookedData;
 	};
 
 	class Mesh : public Asset
 	{
 	public:
-		explicit Mesh(std::filesystem::path filepath);
+		// Loading is safe on any thread, without upload the GPU resources are created later by Upload
+		explicit Mesh(std::filesystem::path filepath, VertexFormat vertexFormat = VertexFormat::Standard, bool upload = true);
+		// Cooked data only, as shipped in asset packs where there is no source to import
+		Mesh(const DerivedDataKey& key, const DerivedDataLoader& loader, VertexFormat vertexFormat = VertexFormat::Standard, bool upload = true);
 		~Mesh() override = default;
 
+		// False when neither cooked data nor the source could be loaded, such a mesh is never uploaded
+		[[nodiscard]] bool IsValid() const { return m_Valid; }
+
+		// Creates the GPU resources and releases the CPU side data, main thread only
+		void Upload();
+		[[nodiscard]] bool IsUploaded() const { return !m_ImportData; }
+
+		[[nodiscard]] AssetMemoryUsage GetMemoryUsage() const override;
+
 		[[nodiscard]] const std::vector<Submesh>& GetSubmeshes() const  { return m_Submeshes; }
 		[[nodiscard]] const std::vector<Ref<Image>>& GetImages() const { return m_Images; }
 		[[nodiscard]] const std::vector<Ref<Material>>& GetMaterials() const { return m_Materials; }
+		[[nodiscard]] VertexFormat GetVertexFormat() const { return m_VertexFormat; }
+		// Bounds of all submeshes in the space of the mesh, known once uploaded
+		[[nodiscard]] const AABB& GetBoundingBox() const { return m_BoundingBox; }
 
 		Ref<Image> GetImage(const uint32_t materialIndex) { return m_Images[materialIndex]; }
 
@@ -38,17 +100,33 @@ namespace Eppo
 		static AssetType GetStaticType() { return AssetType::Mesh; }
 
 	private:
-		void ProcessNode(const tinygltf::Model& model, const tinygltf::Node& node);
-		void ProcessMaterials(const tinygltf::Model& model);
-		void ProcessImages(const tinygltf::Model& model);
+		// Reads the mesh straight from the cooked data, fails when the loader has no valid entry for the key
+		bool LoadCooked(const DerivedDataKey& key, const DerivedDataLoader& loader);
+		bool LoadSource(const MappedFile& source, const DerivedDataKey& key);
+
+		static void CollectMeshNodes(const tinygltf::Model& model, const tinygltf::Node& node, std::vector<const tinygltf::Node*>& meshNodes);
+		void ProcessNode(const tinygltf::Model& model, const tinygltf::Node& node, ImportedSubmesh& submesh) const;
+		void ProcessMaterials(const tinygltf::Model& model, MeshCooker& cooker);
+		void ProcessImages(tinygltf::Model& model, const std::vector<DerivedDataKey>& imageKeys, const std::vector<Ref<Texture>>& residentTextures, MeshCooker& cooker) const;
+		// Replaces the materials by instances shared with equal materials of other meshes
+		void ShareMaterials();
 
 		[[nodiscard]] MeshData GetVertexData(const tinygltf::Model& model, const tinygltf::Mesh& mesh) const;
+		[[nodiscard]] MeshData GetPrimitiveData(const tinygltf::Model& model, const tinygltf::Primitive& primitive) const;
+		static void OptimizePrimitive(MeshData& meshData, Primitive& primitive);
+		static void GenerateLods(MeshData& meshData, Primitive& primitive);
 
 	private:
 		std::filesystem::path m_Filepath;
+		VertexFormat m_VertexFormat;
+		bool m_Valid = false;
 
 		std::vector<Submesh> m_Submeshes;
+		std::vector<Ref<Texture>> m_Textures;
 		std::vector<Ref<Image>> m_Images;
 		std::vector<Ref<Material>> m_Materials;
+		AABB m_BoundingBox;
+
+		Scope<MeshImportData> m_ImportData;
 	};
 }
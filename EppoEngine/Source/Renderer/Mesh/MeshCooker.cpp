@@ -0,0 +1,287 @@
+#include "pch.h"
+#include "MeshCooker.h"
+
+namespace Eppo
+{
+	namespace Utils
+	{
+		// Blobs are aligned so vertex data can be read in place
+		static constexpr uint64_t CookedAlignment = 16;
+
+		static uint64_t AlignCooked(const uint64_t offset)
+		{
+			return (offset + CookedAlignment - 1) & ~(CookedAlignment - 1);
+		}
+
+		template<typename T>
+		static void AppendTable(std::vector<uint8_t>& file, const std::vector<T>& table, uint64_t& offset)
+		{
+			file.resize(AlignCooked(file.size()), 0);
+			offset = file.size();
+
+			const auto* data = reinterpret_cast<const uint8_t*>(table.data());
+			file.insert(file.end(), data, data + table.size() * sizeof(T));
+		}
+
+		static bool IsInFile(const uint64_t fileSize, const uint64_t offset, const uint64_t size)
+		{
+			return offset <= fileSize && size <= fileSize - offset;
+		}
+
+		static bool IsInRange(const uint64_t count, const uint32_t first, const uint32_t rangeCount)
+		{
+			return static_cast<uint64_t>(first) + rangeCount <= count;
+		}
+
+		// Vertex and index ranges of the primitives have to stay within the blobs of their submesh
+		static bool ArePrimitivesValid(const CookedSubmesh& submesh, const CookedPrimitive* primitives, const uint32_t vertexStride, const uint32_t positionStride)
+		{
+			if (submesh.Vertices.Size % vertexStride != 0 || submesh.Indices.Size % sizeof(uint32_t) != 0)
+				return false;
+
+			const uint64_t vertexCount = submesh.Vertices.Size / vertexStride;
+			const uint64_t indexCount = submesh.Indices.Size / sizeof(uint32_t);
+			if (submesh.Positions.Size != vertexCount * positionStride)
+				return false;
+
+			for (uint32_t i = 0; i < submesh.PrimitiveCount; i++)
+			{
+				const CookedPrimitive& primitive = primitives[submesh.FirstPrimitive + i];
+
+				if (!IsInRange(vertexCount, primitive.FirstVertex, primitive.VertexCount) || !IsInRange(indexCount, primitive.FirstIndex, primitive.IndexCount))
+					return false;
+
+				if (primitive.LodCount > Primitive::MaxLods - 1)
+					return false;
+
+				for (uint32_t lod = 0; lod < primitive.LodCount; lod++)
+				{
+					if (!IsInRange(indexCount, primitive.Lods[lod].FirstIndex, primitive.Lods[lod].IndexCount))
+						return false;
+				}
+			}
+
+			return true;
+		}
+	}
+
+	static_assert(std::is_trivially_copyable_v<CookedMeshHeader> && std::is_trivially_copyable_v<CookedSubmesh> && std::is_trivially_copyable_v<CookedPrimitive>);
+	static_assert(std::is_trivially_copyable_v<CookedMaterial> && std::is_trivially_copyable_v<CookedTexture> && std::is_trivially_copyable_v<CookedTextureHeader>);
+
+	MeshCooker::MeshCooker(const DerivedDataKey& key, const VertexFormat vertexFormat)
+		: m_Key(key), m_VertexFormat(vertexFormat)
+	{}
+
+	void MeshCooker::AddSubmesh(const SubmeshData& submesh)
+	{
+		CookedSubmesh& cooked = m_Submeshes.emplace_back();
+		cooked.Name = AddBlob(submesh.Name.data(), submesh.Name.size());
+		cooked.Transform = submesh.Transform;
+		cooked.QuantizationOffset = submesh.Quantization.Offset;
+		cooked.QuantizationScale = submesh.Quantization.Scale;
+		cooked.BoundingCenter = submesh.BoundingCenter;
+		cooked.BoundingRadius = submesh.BoundingRadius;
+		cooked.FirstPrimitive = static_cast<uint32_t>(m_Primitives.size());
+		cooked.PrimitiveCount = static_cast<uint32_t>(submesh.Primitives.size());
+		cooked.Vertices = AddBlob(submesh.Vertices.Data, submesh.Vertices.Size);
+		cooked.Positions = AddBlob(submesh.Positions.Data, submesh.Positions.Size);
+		cooked.Indices = AddBlob(submesh.Indices.Data, submesh.Indices.Size);
+
+		for (const auto& primitive : submesh.Primitives)
+		{
+			CookedPrimitive& cookedPrimitive = m_Primitives.emplace_back();
+			cookedPrimitive.FirstVertex = primitive.FirstVertex;
+			cookedPrimitive.FirstIndex = primitive.FirstIndex;
+			cookedPrimitive.VertexCount = primitive.VertexCount;
+			cookedPrimitive.IndexCount = primitive.IndexCount;
+			cookedPrimitive.MaterialIndex = primitive.MaterialIndex;
+			cookedPrimitive.LodCount = static_cast<uint32_t>(std::min<size_t>(primitive.Lods.size(), Primitive::MaxLods - 1));
+
+			for (uint32_t i = 0; i < cookedPrimitive.LodCount; i++)
+				cookedPrimitive.Lods[i] = primitive.Lods[i];
+		}
+	}
+
+	void MeshCooker::AddMaterial(const Material& material)
+	{
+		CookedMaterial& cooked = m_Materials.emplace_back();
+		cooked.Roughness = material.Roughness;
+		cooked.Metallic = material.Metallic;
+		cooked.NormalMapIntensity = material.NormalMapIntensity;
+		cooked.DiffuseColor = material.DiffuseColor;
+		cooked.DiffuseMapIndex = material.DiffuseMapIndex;
+		cooked.NormalMapIndex = material.NormalMapIndex;
+		cooked.RoughnessMetallicMapIndex = material.RoughnessMetallicMapIndex;
+	}
+
+	void MeshCooker::AddTexture(const DerivedDataKey& key, const uint32_t width, const uint32_t height, const ImageFormat format, const void* pixels, const uint64_t size)
+	{
+		EPPO_PROFILE_FUNCTION("MeshCooker::AddTexture");
+
+		AddCachedTexture(key);
+		WriteTexture(key, width, height, format, pixels, size);
+	}
+
+	void MeshCooker::AddCachedTexture(const DerivedDataKey& key)
+	{
+		m_Textures.emplace_back().Key = key.GetValue();
+	}
+
+	bool MeshCooker::WriteTexture(const DerivedDataKey& key, const uint32_t width, const uint32_t height, const ImageFormat format, const void* pixels, const uint64_t size)
+	{
+		EPPO_PROFILE_FUNCTION("MeshCooker::WriteTexture");
+
+		// Textures shared between meshes are cooked once
+		if (DerivedDataCache::Contains(key, TextureExtension))
+			return true;
+
+		CookedTextureHeader header;
+		header.Key = key.GetValue();
+		header.Width = width;
+		header.Height = height;
+		header.Format = static_cast<uint32_t>(format);
+		header.Pixels = { Utils::AlignCooked(sizeof(CookedTextureHeader)), size };
+
+		std::vector<uint8_t> file(header.Pixels.Offset + size, 0);
+		std::memcpy(file.data(), &header, sizeof(header));
+		std::memcpy(file.data() + header.Pixels.Offset, pixels, size);
+
+		if (!DerivedDataCache::Put(key, TextureExtension, file.data(), file.size()))
+		{
+			EPPO_WARN("Failed to write cooked texture {}", key.ToString());
+			return false;
+		}
+
+		return true;
+	}
+
+	bool MeshCooker::Write() const
+	{
+		EPPO_PROFILE_FUNCTION("MeshCooker::Write");
+
+		CookedMeshHeader header;
+		header.VertexFormat = static_cast<uint32_t>(m_VertexFormat);
+		header.SubmeshCount = static_cast<uint32_t>(m_Submeshes.size());
+		header.PrimitiveCount = static_cast<uint32_t>(m_Primitives.size());
+		header.MaterialCount = static_cast<uint32_t>(m_Materials.size());
+		header.TextureCount = static_cast<uint32_t>(m_Textures.size());
+		header.Key = m_Key.GetValue();
+
+		std::vector<uint8_t> file(Utils::AlignCooked(sizeof(CookedMeshHeader)), 0);
+		file.insert(file.end(), m_Blobs.begin(), m_Blobs.end());
+
+		Utils::AppendTable(file, m_Submeshes, header.SubmeshOffset);
+		Utils::AppendTable(file, m_Primitives, header.PrimitiveOffset);
+		Utils::AppendTable(file, m_Materials, header.MaterialOffset);
+		Utils::AppendTable(file, m_Textures, header.TextureOffset);
+
+		std::memcpy(file.data(), &header, sizeof(header));
+
+		if (!DerivedDataCache::Put(m_Key, MeshExtension, file.data(), file.size()))
+		{
+			EPPO_WARN("Failed to write cooked mesh {}", m_Key.ToString());
+			return false;
+		}
+
+		EPPO_INFO("Cooked mesh {} ({} bytes)", m_Key.ToString(), file.size());
+		return true;
+	}
+
+	DerivedDataKey MeshCooker::GetCacheKey(const void* source, const uint64_t size, const VertexFormat vertexFormat)
+	{
+		EPPO_PROFILE_FUNCTION("MeshCooker::GetCacheKey");
+
+		DerivedDataKey key("Mesh", ImporterVersion);
+		key.Append(CookedMeshHeader::CurrentVersion);
+		key.Append(static_cast<uint32_t>(vertexFormat));
+		key.Append(source, size);
+
+		return key;
+	}
+
+	DerivedDataKey MeshCooker::GetTextureCacheKey(const void* encodedImage, const uint64_t size)
+	{
+		DerivedDataKey key("Texture", TextureImporterVersion);
+		key.Append(CookedTextureHeader::CurrentVersion);
+		key.Append(encodedImage, size);
+
+		return key;
+	}
+
+	const CookedMeshHeader* MeshCooker::Validate(const uint8_t* data, const uint64_t size, const DerivedDataKey& key, const VertexFormat vertexFormat)
+	{
+		if (!data || size < sizeof(CookedMeshHeader))
+			return nullptr;
+
+		const auto* header = reinterpret_cast<const CookedMeshHeader*>(data);
+		if (header->Magic != CookedMeshHeader::MagicValue || header->Version != CookedMeshHeader::CurrentVersion || header->VertexFormat != static_cast<uint32_t>(vertexFormat))
+			return nullptr;
+
+		// Guards against entries copied into the wrong place in a shared cache
+		if (header->Key != key.GetValue())
+			return nullptr;
+
+		const bool tablesInFile = Utils::IsInFile(size, header->SubmeshOffset, header->SubmeshCount * sizeof(CookedSubmesh))
+			&& Utils::IsInFile(size, header->PrimitiveOffset, header->PrimitiveCount * sizeof(CookedPrimitive))
+			&& Utils::IsInFile(size, header->MaterialOffset, header->MaterialCount * sizeof(CookedMaterial))
+			&& Utils::IsInFile(size, header->TextureOffset, header->TextureCount * sizeof(CookedTexture));
+
+		if (!tablesInFile)
+			return nullptr;
+
+		const uint32_t vertexStride = VertexPacking::GetLayout(vertexFormat).GetStride();
+		const uint32_t positionStride = VertexPacking::GetPositionLayout(vertexFormat).GetStride();
+
+		const auto* submeshes = reinterpret_cast<const CookedSubmesh*>(data + header->SubmeshOffset);
+		const auto* primitives = reinterpret_cast<const CookedPrimitive*>(data + header->PrimitiveOffset);
+		for (uint32_t i = 0; i < header->SubmeshCount; i++)
+		{
+			const CookedSubmesh& submesh = submeshes[i];
+
+			const bool blobsInFile = Utils::IsInFile(size, submesh.Name.Offset, submesh.Name.Size)
+				&& Utils::IsInFile(size, submesh.Vertices.Offset, submesh.Vertices.Size)
+				&& Utils::IsInFile(size, submesh.Positions.Offset, submesh.Positions.Size)
+				&& Utils::IsInFile(size, submesh.Indices.Offset, submesh.Indices.Size)
+				&& Utils::IsInRange(header->PrimitiveCount, submesh.FirstPrimitive, submesh.PrimitiveCount);
+
+			// Ranges past the blobs would be read past the mapping here and drawn past the buffers on the GPU
+			if (!blobsInFile || !Utils::ArePrimitivesValid(submesh, primitives, vertexStride, positionStride))
+				return nullptr;
+		}
+
+		return header;
+	}
+
+	const CookedTextureHeader* MeshCooker::ValidateTexture(const uint8_t* data, const uint64_t size, const DerivedDataKey& key)
+	{
+		if (!data || size < sizeof(CookedTextureHeader))
+			return nullptr;
+
+		const auto* header = reinterpret_cast<const CookedTextureHeader*>(data);
+		if (header->Magic != CookedTextureHeader::MagicValue || header->Version != CookedTextureHeader::CurrentVersion || header->Key != key.GetValue())
+			return nullptr;
+
+		if (!Utils::IsInFile(size, header->Pixels.Offset, header->Pixels.Size))
+			return nullptr;
+
+		// Only RGBA8 textures are cooked, the upload reads four bytes per pixel
+		if (header->Format != static_cast<uint32_t>(ImageFormat::RGBA8) || header->Pixels.Size < static_cast<uint64_t>(header->Width) * header->Height * 4)
+			return nullptr;
+
+		return header;
+	}
+
+	CookedRange MeshCooker::AddBlob(const void* data, const uint64_t size)
+	{
+		m_Blobs.resize(Utils::AlignCooked(m_Blobs.size()), 0);
+
+		CookedRange range;
+		range.Offset = Utils::AlignCooked(sizeof(CookedMeshHeader)) + m_Blobs.size();
+		range.Size = size;
+
+		const auto* bytes = static_cast<const uint8_t*>(data);
+		m_Blobs.insert(m_Blobs.end(), bytes, bytes + size);
+
+		return range;
+	}
+}
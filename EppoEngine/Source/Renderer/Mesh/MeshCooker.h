@@ -0,0 +1,156 @@
+#pragma once
+
+#include "Asset/DerivedDataCache.h"
+#include "Renderer/Mesh/Material.h"
+#include "Renderer/Mesh/Submesh.h"
+#include "Renderer/Image.h"
+
+namespace Eppo
+{
+	// Layout of cooked .epmesh files, all offsets are in bytes from the start of the file
+	struct CookedMeshHeader
+	{
+		static constexpr uint32_t MagicValue = 0x48534D45; // "EMSH"
+		// Bump when the layout changes, it is part of the cache key
+		static constexpr uint32_t CurrentVersion = 2;
+
+		uint32_t Magic = MagicValue;
+		uint32_t Version = CurrentVersion;
+		uint32_t VertexFormat = 0;
+		uint32_t Reserved = 0;
+
+		// Derived data cache key the file was written for
+		uint64_t Key = 0;
+
+		uint32_t SubmeshCount = 0;
+		uint32_t PrimitiveCount = 0;
+		uint32_t MaterialCount = 0;
+		uint32_t TextureCount = 0;
+
+		uint64_t SubmeshOffset = 0;
+		uint64_t PrimitiveOffset = 0;
+		uint64_t MaterialOffset = 0;
+		uint64_t TextureOffset = 0;
+	};
+
+	struct CookedRange
+	{
+		uint64_t Offset = 0;
+		uint64_t Size = 0;
+	};
+
+	struct CookedSubmesh
+	{
+		CookedRange Name;
+		glm::mat4 Transform;
+
+		glm::vec3 QuantizationOffset;
+		glm::vec3 QuantizationScale;
+		glm::vec3 BoundingCenter;
+		float BoundingRadius;
+
+		uint32_t FirstPrimitive;
+		uint32_t PrimitiveCount;
+
+		// Blobs in the vertex format of the header, ready for upload
+		CookedRange Vertices;
+		CookedRange Positions;
+		CookedRange Indices;
+	};
+
+	struct CookedPrimitive
+	{
+		uint32_t FirstVertex;
+		uint32_t FirstIndex;
+		uint32_t VertexCount;
+		uint32_t IndexCount;
+		int32_t MaterialIndex;
+
+		uint32_t LodCount;
+		PrimitiveLod Lods[Primitive::MaxLods - 1];
+	};
+
+	struct CookedMaterial
+	{
+		float Roughness;
+		float Metallic;
+		float NormalMapIntensity;
+		glm::vec4 DiffuseColor;
+
+		int32_t DiffuseMapIndex;
+		int32_t NormalMapIndex;
+		int32_t RoughnessMetallicMapIndex;
+	};
+
+	struct CookedTexture
+	{
+		// Derived data cache key of the .eptex file
+		uint64_t Key;
+	};
+
+	// Layout of cooked .eptex files, decoded pixels ready for upload
+	struct CookedTextureHeader
+	{
+		static constexpr uint32_t MagicValue = 0x58455445; // "ETEX"
+		static constexpr uint32_t CurrentVersion = 2;
+
+		uint32_t Magic = MagicValue;
+		uint32_t Version = CurrentVersion;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		uint32_t Format = 0;
+		uint32_t Reserved = 0;
+
+		uint64_t Key = 0;
+		CookedRange Pixels;
+	};
+
+	// Collects imported mesh data and writes it as a cooked mesh to the derived data cache
+	class MeshCooker
+	{
+	public:
+		// Bump when the import processing changes, meshes and textures are cooked again
+		static constexpr uint32_t ImporterVersion = 1;
+		static constexpr uint32_t TextureImporterVersion = 1;
+
+		static constexpr std::string_view MeshExtension = ".epmesh";
+		static constexpr std::string_view TextureExtension = ".eptex";
+
+		MeshCooker(const DerivedDataKey& key, VertexFormat vertexFormat);
+
+		void AddSubmesh(const SubmeshData& submesh);
+		void AddMaterial(const Material& material);
+		// Writes the pixels to their own cooked texture right away, unless the cache has it already
+		void AddTexture(const DerivedDataKey& key, uint32_t width, uint32_t height, ImageFormat format, const void* pixels, uint64_t size);
+		// References a texture the cache has already
+		void AddCachedTexture(const DerivedDataKey& key);
+
+		static bool WriteTexture(const DerivedDataKey& key, uint32_t width, uint32_t height, ImageFormat format, const void* pixels, uint64_t size);
+
+		bool Write() const;
+
+		// Keys depend on the source contents only, never on paths or timestamps
+		static DerivedDataKey GetCacheKey(const void* source, uint64_t size, VertexFormat vertexFormat);
+		static DerivedDataKey GetTextureCacheKey(const void* encodedImage, uint64_t size);
+
+		// Returns the header when the data is a cooked mesh of the current version for this key and vertex format,
+		// with every table, blob and primitive range inside the data
+		static const CookedMeshHeader* Validate(const uint8_t* data, uint64_t size, const DerivedDataKey& key, VertexFormat vertexFormat);
+		static const CookedTextureHeader* ValidateTexture(const uint8_t* data, uint64_t size, const DerivedDataKey& key);
+
+	private:
+		CookedRange AddBlob(const void* data, uint64_t size);
+
+	private:
+		DerivedDataKey m_Key;
+		VertexFormat m_VertexFormat;
+
+		// Everything between the header and the tables, offsets are final as the header size is fixed
+		std::vector<uint8_t> m_Blobs;
+
+		std::vector<CookedSubmesh> m_Submeshes;
+		std::vector<CookedPrimitive> m_Primitives;
+		std::vector<CookedMaterial> m_Materials;
+		std::vector<CookedTexture> m_Textures;
+	};
+}
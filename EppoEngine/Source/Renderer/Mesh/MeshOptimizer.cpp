@@ -0,0 +1,321 @@
+#include "pch.h"
+#include "MeshOptimizer.h"
+
+#include <algorithm>
+
+namespace Eppo
+{
+	namespace Utils
+	{
+		// Per vertex list of the triangles using it, stored as offsets into a single array
+		struct TriangleAdjacency
+		{
+			std::vector<uint32_t> Counts;
+			std::vector<uint32_t> Offsets;
+			std::vector<uint32_t> Triangles;
+		};
+
+		static TriangleAdjacency BuildTriangleAdjacency(const uint32_t* indices, const size_t indexCount, const size_t vertexCount)
+		{
+			TriangleAdjacency adjacency;
+			adjacency.Counts.resize(vertexCount, 0);
+			adjacency.Offsets.resize(vertexCount, 0);
+			adjacency.Triangles.resize(indexCount);
+
+			for (size_t i = 0; i < indexCount; i++)
+				adjacency.Counts[indices[i]]++;
+
+			uint32_t offset = 0;
+			for (size_t v = 0; v < vertexCount; v++)
+			{
+				adjacency.Offsets[v] = offset;
+				offset += adjacency.Counts[v];
+			}
+
+			std::vector<uint32_t> fill = adjacency.Offsets;
+			for (size_t i = 0; i < indexCount; i++)
+				adjacency.Triangles[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+
+			return adjacency;
+		}
+
+		// FIFO cache simulation, returns the amount of misses per triangle
+		class VertexCache
+		{
+		public:
+			VertexCache(const size_t vertexCount, const uint32_t cacheSize)
+				: m_Timestamps(vertexCount, 0), m_CacheSize(cacheSize), m_Time(cacheSize + 1)
+			{}
+
+			uint32_t Process(const uint32_t* triangle)
+			{
+				uint32_t misses = 0;
+
+				for (uint32_t c = 0; c < 3; c++)
+				{
+					if (m_Time - m_Timestamps[triangle[c]] > m_CacheSize)
+					{
+						m_Timestamps[triangle[c]] = m_Time++;
+						misses++;
+					}
+				}
+
+				return misses;
+			}
+
+		private:
+			std::vector<uint32_t> m_Timestamps;
+			uint32_t m_CacheSize;
+			uint32_t m_Time;
+		};
+	}
+
+	VertexCacheStatistics MeshOptimizer::AnalyzeVertexCache(const uint32_t* indices, const size_t indexCount, const size_t vertexCount, const uint32_t cacheSize)
+	{
+		EPPO_PROFILE_FUNCTION("MeshOptimizer::AnalyzeVertexCache");
+
+		EPPO_ASSERT(indexCount % 3 == 0)
+
+		VertexCacheStatistics statistics;
+		statistics.Triangles = static_cast<uint32_t>(indexCount / 3);
+
+		std::vector<bool> used(vertexCount, false);
+		for (size_t i = 0; i < indexCount; i++)
+		{
+			if (!used[indices[i]])
+			{
+				used[indices[i]] = true;
+				statistics.Vertices++;
+			}
+		}
+
+		Utils::VertexCache cache(vertexCount, cacheSize);
+		for (size_t i = 0; i < indexCount; i += 3)
+			statistics.Misses += cache.Process(&indices[i]);
+
+		return statistics;
+	}
+
+	void MeshOptimizer::OptimizeVertexCache(uint32_t* indices, const size_t indexCount, const size_t vertexCount, const uint32_t cacheSize)
+	{
+		EPPO_PROFILE_FUNCTION("MeshOptimizer::OptimizeVertexCache");
+
+		EPPO_ASSERT(indexCount % 3 == 0)
+
+		if (indexCount == 0)
+			return;
+
+		// Tipsify, Sander et al. 2007: fan around the last vertex and pick the next one that is still likely in the cache
+		const Utils::TriangleAdjacency adjacency = Utils::BuildTriangleAdjacency(indices, indexCount, vertexCount);
+
+		std::vector<uint32_t> liveTriangles = adjacency.Counts;
+		std::vector<uint32_t> timestamps(vertexCount, 0);
+		std::vector<bool> emitted(indexCount / 3, false);
+		std::vector<uint32_t> deadEnds;
+		std::vector<uint32_t> candidates;
+
+		std::vector<uint32_t> result;
+		result.reserve(indexCount);
+
+		uint32_t time = cacheSize + 1;
+		size_t cursor = 0;
+		int64_t fanningVertex = 0;
+
+		while (fanningVertex >= 0)
+		{
+			candidates.clear();
+
+			const auto v = static_cast<uint32_t>(fanningVertex);
+			for (uint32_t i = 0; i < adjacency.Counts[v]; i++)
+			{
+				const uint32_t triangle = adjacency.Triangles[adjacency.Offsets[v] + i];
+				if (emitted[triangle])
+					continue;
+
+				for (uint32_t c = 0; c < 3; c++)
+				{
+					const uint32_t corner = indices[triangle * 3 + c];
+
+					result.emplace_back(corner);
+					deadEnds.emplace_back(corner);
+					candidates.emplace_back(corner);
+					liveTriangles[corner]--;
+
+					if (time - timestamps[corner] > cacheSize)
+						timestamps[corner] = time++;
+				}
+
+				emitted[triangle] = true;
+			}
+
+			// Prefer candidates that stay in the cache after their remaining triangles are emitted
+			fanningVertex = -1;
+			int64_t bestPriority = -1;
+
+			for (const uint32_t candidate : candidates)
+			{
+				if (liveTriangles[candidate] == 0)
+					continue;
+
+				int64_t priority = 0;
+				if (time - timestamps[candidate] + 2 * liveTriangles[candidate] <= cacheSize)
+					priority = time - timestamps[candidate];
+
+				if (priority > bestPriority)
+				{
+					bestPriority = priority;
+					fanningVertex = candidate;
+				}
+			}
+
+			if (fanningVertex >= 0)
+				continue;
+
+			// Dead end, go back to recently used vertices first and then continue in input order
+			while (!deadEnds.empty())
+			{
+				const uint32_t vertex = deadEnds.back();
+				deadEnds.pop_back();
+
+				if (liveTriangles[vertex] > 0)
+				{
+					fanningVertex = vertex;
+					break;
+				}
+			}
+
+			while (fanningVertex < 0 && cursor < vertexCount)
+			{
+				if (liveTriangles[cursor] > 0)
+					fanningVertex = static_cast<int64_t>(cursor);
+
+				cursor++;
+			}
+		}
+
+		EPPO_ASSERT(result.size() == indexCount)
+		std::copy(result.begin(), result.end(), indices);
+	}
+
+	void MeshOptimizer::OptimizeOverdraw(uint32_t* indices, const size_t indexCount, const Vertex* vertices, const size_t vertexCount, const float threshold, const uint32_t cacheSize)
+	{
+		EPPO_PROFILE_FUNCTION("MeshOptimizer::OptimizeOverdraw");
+
+		EPPO_ASSERT(indexCount % 3 == 0)
+
+		const size_t triangleCount = indexCount / 3;
+		if (triangleCount == 0)
+			return;
+
+		// Clusters start where the cache gets fully flushed, reordering them only costs misses on the boundaries
+		std::vector<size_t> clusterStarts;
+		{
+			Utils::VertexCache cache(vertexCount, cacheSize);
+
+			for (size_t t = 0; t < triangleCount; t++)
+			{
+				if (cache.Process(&indices[t * 3]) == 3 && (clusterStarts.empty() || t - clusterStarts.back() >= 8))
+					clusterStarts.emplace_back(t);
+			}
+
+			if (clusterStarts.empty() || clusterStarts.front() != 0)
+				clusterStarts.insert(clusterStarts.begin(), 0);
+		}
+
+		if (clusterStarts.size() < 2)
+			return;
+
+		// Center of the bounds of everything that is referenced
+		glm::vec3 min = vertices[indices[0]].Position;
+		glm::vec3 max = min;
+
+		for (size_t i = 0; i < indexCount; i++)
+		{
+			min = glm::min(min, vertices[indices[i]].Position);
+			max = glm::max(max, vertices[indices[i]].Position);
+		}
+
+		const glm::vec3 center = (min + max) * 0.5f;
+
+		// Clusters facing away from the center are likely in front of the others
+		struct Cluster
+		{
+			size_t FirstTriangle;
+			size_t TriangleCount;
+			float SortKey;
+		};
+
+		std::vector<Cluster> clusters(clusterStarts.size());
+
+		for (size_t i = 0; i < clusterStarts.size(); i++)
+		{
+			Cluster& cluster = clusters[i];
+			cluster.FirstTriangle = clusterStarts[i];
+			cluster.TriangleCount = (i + 1 < clusterStarts.size() ? clusterStarts[i + 1] : triangleCount) - cluster.FirstTriangle;
+
+			glm::vec3 centroid(0.0f);
+			glm::vec3 normal(0.0f);
+			float area = 0.0f;
+
+			for (size_t t = cluster.FirstTriangle; t < cluster.FirstTriangle + cluster.TriangleCount; t++)
+			{
+				const glm::vec3& p0 = vertices[indices[t * 3 + 0]].Position;
+				const glm::vec3& p1 = vertices[indices[t * 3 + 1]].Position;
+				const glm::vec3& p2 = vertices[indices[t * 3 + 2]].Position;
+
+				const glm::vec3 triangleNormal = glm::cross(p1 - p0, p2 - p0);
+				const float triangleArea = glm::length(triangleNormal);
+
+				centroid += (p0 + p1 + p2) * (triangleArea / 3.0f);
+				normal += triangleNormal;
+				area += triangleArea;
+			}
+
+			if (area > 0.0f)
+				centroid /= area;
+
+			const float normalLength = glm::length(normal);
+			cluster.SortKey = normalLength > 0.0f ? glm::dot(centroid - center, normal / normalLength) : 0.0f;
+		}
+
+		std::stable_sort(clusters.begin(), clusters.end(), [](const Cluster& a, const Cluster& b) { return a.SortKey > b.SortKey; });
+
+		std::vector<uint32_t> result;
+		result.reserve(indexCount);
+
+		for (const Cluster& cluster : clusters)
+			result.insert(result.end(), indices + cluster.FirstTriangle * 3, indices + (cluster.FirstTriangle + cluster.TriangleCount) * 3);
+
+		// Keep the vertex cache order when sorting costs too much
+		const float before = AnalyzeVertexCache(indices, indexCount, vertexCount, cacheSize).GetACMR();
+		const float after = AnalyzeVertexCache(result.data(), result.size(), vertexCount, cacheSize).GetACMR();
+
+		if (after <= before * threshold)
+			std::copy(result.begin(), result.end(), indices);
+	}
+
+	size_t MeshOptimizer::OptimizeVertexFetch(Vertex* vertices, const size_t vertexCount, uint32_t* indices, const size_t indexCount)
+	{
+		EPPO_PROFILE_FUNCTION("MeshOptimizer::OptimizeVertexFetch");
+
+		std::vector<uint32_t> remap(vertexCount, UINT32_MAX);
+		std::vector<Vertex> result;
+		result.reserve(vertexCount);
+
+		for (size_t i = 0; i < indexCount; i++)
+		{
+			uint32_t& index = remap[indices[i]];
+
+			if (index == UINT32_MAX)
+			{
+				index = static_cast<uint32_t>(result.size());
+				result.emplace_back(vertices[indices[i]]);
+			}
+
+			indices[i] = index;
+		}
+
+		std::copy(result.begin(), result.end(), vertices);
+		return result.size();
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Renderer/Vertex.h"
+
+namespace Eppo
+{
+	// Result of simulating a FIFO post-transform vertex cache
+	struct VertexCacheStatistics
+	{
+		uint32_t Triangles = 0;
+		uint32_t Vertices = 0;
+		uint32_t Misses = 0;
+
+		// Average cache miss ratio, transformed vertices per triangle (0.5 - 3.0)
+		[[nodiscard]] float GetACMR() const { return Triangles > 0 ? static_cast<float>(Misses) / static_cast<float>(Triangles) : 0.0f; }
+		// Average transform to vertex ratio, transformed vertices per unique vertex (1.0 is optimal)
+		[[nodiscard]] float GetATVR() const { return Vertices > 0 ? static_cast<float>(Misses) / static_cast<float>(Vertices) : 0.0f; }
+
+		VertexCacheStatistics& operator+=(const VertexCacheStatistics& other)
+		{
+			Triangles += other.Triangles;
+			Vertices += other.Vertices;
+			Misses += other.Misses;
+			return *this;
+		}
+	};
+
+	// Reorders triangle lists and vertices in place, all functions keep the triangles themselves intact
+	class MeshOptimizer
+	{
+	public:
+		static constexpr uint32_t CacheSize = 16;
+
+		static VertexCacheStatistics AnalyzeVertexCache(const uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize = CacheSize);
+
+		// Tipsify triangle order for the post-transform vertex cache
+		static void OptimizeVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize = CacheSize);
+		// Sorts clusters of a vertex cache optimized list so outward facing clusters are drawn first
+		// Reverts when the cache miss ratio grows by more than the threshold
+		static void OptimizeOverdraw(uint32_t* indices, size_t indexCount, const Vertex* vertices, size_t vertexCount, float threshold = 1.05f, uint32_t cacheSize = CacheSize);
+		// Orders vertices by first use and drops unused ones, returns the new vertex count
+		static size_t OptimizeVertexFetch(Vertex* vertices, size_t vertexCount, uint32_t* indices, size_t indexCount);
+	};
+}
@@ -0,0 +1,446 @@
+#include "pch.h"
+#include "MeshSimplifier.h"
+
+#include <algorithm>
+
+namespace Eppo
+{
+	namespace Utils
+	{
+		// Sum of squared distances to planes, weighted by the area of the triangles they came from
+		struct Quadric
+		{
+			double A00 = 0.0, A01 = 0.0, A02 = 0.0, A03 = 0.0;
+			double A11 = 0.0, A12 = 0.0, A13 = 0.0;
+			double A22 = 0.0, A23 = 0.0;
+			double A33 = 0.0;
+			double Weight = 0.0;
+
+			void AddPlane(const glm::vec3& normal, const float distance, const float weight)
+			{
+				const double a = normal.x;
+				const double b = normal.y;
+				const double c = normal.z;
+				const double d = distance;
+
+				A00 += weight * a * a; A01 += weight * a * b; A02 += weight * a * c; A03 += weight * a * d;
+				A11 += weight * b * b; A12 += weight * b * c; A13 += weight * b * d;
+				A22 += weight * c * c; A23 += weight * c * d;
+				A33 += weight * d * d;
+				Weight += weight;
+			}
+
+			void Add(const Quadric& other)
+			{
+				A00 += other.A00; A01 += other.A01; A02 += other.A02; A03 += other.A03;
+				A11 += other.A11; A12 += other.A12; A13 += other.A13;
+				A22 += other.A22; A23 += other.A23;
+				A33 += other.A33;
+				Weight += other.Weight;
+			}
+
+			// Average squared distance from a point to the accumulated planes
+			[[nodiscard]] double Evaluate(const glm::vec3& point) const
+			{
+				if (Weight <= 0.0)
+					return 0.0;
+
+				const double x = point.x;
+				const double y = point.y;
+				const double z = point.z;
+
+				const double error =
+					A00 * x * x + 2.0 * A01 * x * y + 2.0 * A02 * x * z + 2.0 * A03 * x +
+					A11 * y * y + 2.0 * A12 * y * z + 2.0 * A13 * y +
+					A22 * z * z + 2.0 * A23 * z +
+					A33;
+
+				return std::max(error, 0.0) / Weight;
+			}
+		};
+
+		struct Collapse
+		{
+			float Cost;
+			uint32_t From;
+			uint32_t To;
+			uint32_t FromVersion;
+			uint32_t ToVersion;
+
+			bool operator>(const Collapse& other) const { return Cost > other.Cost; }
+		};
+
+		struct PositionHash
+		{
+			size_t operator()(const glm::vec3& position) const
+			{
+				// Adding zero turns -0.0 into 0.0 so equal positions hash the same
+				const float values[3] = { position.x + 0.0f, position.y + 0.0f, position.z + 0.0f };
+
+				uint32_t bits[3];
+				memcpy(bits, values, sizeof(bits));
+
+				return (bits[0] * 73856093u) ^ (bits[1] * 19349663u) ^ (bits[2] * 83492791u);
+			}
+		};
+
+		static uint64_t GetEdgeKey(uint32_t a, uint32_t b)
+		{
+			if (a > b)
+				std::swap(a, b);
+
+			return (static_cast<uint64_t>(a) << 32) | b;
+		}
+	}
+
+	std::vector<uint32_t> MeshSimplifier::Simplify(const Vertex* vertices, const size_t vertexCount, const uint32_t* indices, const size_t indexCount,
+		const MeshSimplifierSpecification& specification, float* resultError)
+	{
+		EPPO_PROFILE_FUNCTION("MeshSimplifier::Simplify");
+
+		EPPO_ASSERT(indexCount % 3 == 0)
+
+		if (resultError)
+			*resultError = 0.0f;
+
+		std::vector<uint32_t> triangles(indices, indices + indexCount);
+		if (indexCount <= specification.TargetIndexCount)
+			return triangles;
+
+		// Weld vertices sharing a position so attribute seams do not split the topology
+		std::vector<uint32_t> remap(vertexCount, UINT32_MAX);
+		std::vector<uint32_t> wedgeCount(vertexCount, 0);
+
+		{
+			std::unordered_map<glm::vec3, uint32_t, Utils::PositionHash> positions;
+
+			for (size_t i = 0; i < indexCount; i++)
+			{
+				const uint32_t index = indices[i];
+				EPPO_ASSERT(index < vertexCount)
+
+				if (remap[index] != UINT32_MAX)
+					continue;
+
+				const auto it = positions.try_emplace(vertices[index].Position, index).first;
+				remap[index] = it->second;
+				wedgeCount[it->second]++;
+			}
+		}
+
+		// Build quadrics, adjacency and edge usage on the welded vertices
+		const size_t triangleCount = indexCount / 3;
+		size_t remainingTriangles = 0;
+
+		std::vector<bool> triangleRemoved(triangleCount, false);
+		std::vector<Utils::Quadric> quadrics(vertexCount);
+		std::vector<std::vector<uint32_t>> vertexTriangles(vertexCount);
+		std::unordered_map<uint64_t, uint32_t> edgeUsage;
+
+		for (size_t t = 0; t < triangleCount; t++)
+		{
+			const uint32_t v0 = remap[triangles[t * 3 + 0]];
+			const uint32_t v1 = remap[triangles[t * 3 + 1]];
+			const uint32_t v2 = remap[triangles[t * 3 + 2]];
+
+			if (v0 == v1 || v1 == v2 || v0 == v2)
+			{
+				triangleRemoved[t] = true;
+				continue;
+			}
+
+			remainingTriangles++;
+
+			const glm::vec3& p0 = vertices[v0].Position;
+			glm::vec3 normal = glm::cross(vertices[v1].Position - p0, vertices[v2].Position - p0);
+
+			if (const float length = glm::length(normal);
+				length > 0.0f)
+			{
+				normal /= length;
+
+				for (const uint32_t v : { v0, v1, v2 })
+					quadrics[v].AddPlane(normal, -glm::dot(normal, p0), length * 0.5f);
+			}
+
+			for (const uint32_t v : { v0, v1, v2 })
+				vertexTriangles[v].emplace_back(static_cast<uint32_t>(t));
+
+			edgeUsage[Utils::GetEdgeKey(v0, v1)]++;
+			edgeUsage[Utils::GetEdgeKey(v1, v2)]++;
+			edgeUsage[Utils::GetEdgeKey(v2, v0)]++;
+		}
+
+		// Border vertices only slide along the border, seam and non-manifold vertices stay in place
+		enum class VertexKind : uint8_t { Manifold, Border, Locked };
+
+		std::vector<VertexKind> kinds(vertexCount, VertexKind::Manifold);
+		std::vector<uint32_t> borderEdgeCount(vertexCount, 0);
+
+		for (const auto& [key, count] : edgeUsage)
+		{
+			const auto a = static_cast<uint32_t>(key >> 32);
+			const auto b = static_cast<uint32_t>(key & UINT32_MAX);
+
+			if (count == 1)
+			{
+				borderEdgeCount[a]++;
+				borderEdgeCount[b]++;
+			}
+			else if (count > 2)
+			{
+				kinds[a] = VertexKind::Locked;
+				kinds[b] = VertexKind::Locked;
+			}
+		}
+
+		for (size_t v = 0; v < vertexCount; v++)
+		{
+			if (wedgeCount[v] > 1 || (borderEdgeCount[v] != 0 && borderEdgeCount[v] != 2))
+				kinds[v] = VertexKind::Locked;
+			else if (borderEdgeCount[v] == 2 && kinds[v] != VertexKind::Locked)
+				kinds[v] = VertexKind::Border;
+		}
+
+		// Planes perpendicular to border edges keep the outline in place
+		for (size_t t = 0; t < triangleCount; t++)
+		{
+			if (triangleRemoved[t])
+				continue;
+
+			const glm::vec3& p0 = vertices[remap[triangles[t * 3 + 0]]].Position;
+			const glm::vec3 normal = glm::cross(vertices[remap[triangles[t * 3 + 1]]].Position - p0, vertices[remap[triangles[t * 3 + 2]]].Position - p0);
+
+			for (uint32_t c = 0; c < 3; c++)
+			{
+				const uint32_t a = remap[triangles[t * 3 + c]];
+				const uint32_t b = remap[triangles[t * 3 + (c + 1) % 3]];
+
+				if (edgeUsage[Utils::GetEdgeKey(a, b)] != 1)
+					continue;
+
+				const glm::vec3 edge = vertices[b].Position - vertices[a].Position;
+				glm::vec3 planeNormal = glm::cross(edge, normal);
+
+				if (const float length = glm::length(planeNormal);
+					length > 0.0f)
+				{
+					planeNormal /= length;
+
+					const float weight = glm::dot(edge, edge);
+					quadrics[a].AddPlane(planeNormal, -glm::dot(planeNormal, vertices[a].Position), weight);
+					quadrics[b].AddPlane(planeNormal, -glm::dot(planeNormal, vertices[a].Position), weight);
+				}
+			}
+		}
+
+		// Cost of moving welded vertex 'from' onto 'to', fails when it would flip a triangle or when the corner to use is ambiguous
+		auto evaluate = [&](const uint32_t from, const uint32_t to, float& cost, float& positionError, uint32_t& wedge) -> bool
+		{
+			if (kinds[from] == VertexKind::Locked)
+				return false;
+
+			wedge = UINT32_MAX;
+			uint32_t sharedTriangles = 0;
+
+			for (const uint32_t t : vertexTriangles[from])
+			{
+				if (triangleRemoved[t])
+					continue;
+
+				const uint32_t* corners = &triangles[t * 3];
+				uint32_t fromCorner = 0;
+				bool hasTo = false;
+
+				for (uint32_t c = 0; c < 3; c++)
+				{
+					const uint32_t v = remap[corners[c]];
+					if (v == from)
+						fromCorner = c;
+					else if (v == to)
+					{
+						hasTo = true;
+
+						if (wedge == UINT32_MAX)
+							wedge = corners[c];
+						else if (wedge != corners[c])
+							return false;
+					}
+				}
+
+				// Triangles on the edge disappear
+				if (hasTo)
+				{
+					sharedTriangles++;
+					continue;
+				}
+
+				glm::vec3 p[3] = { vertices[corners[0]].Position, vertices[corners[1]].Position, vertices[corners[2]].Position };
+				const glm::vec3 before = glm::cross(p[1] - p[0], p[2] - p[0]);
+				p[fromCorner] = vertices[to].Position;
+				const glm::vec3 after = glm::cross(p[1] - p[0], p[2] - p[0]);
+
+				if (glm::dot(before, before) > 0.0f && glm::dot(before, after) <= 0.0f)
+					return false;
+			}
+
+			// No longer connected
+			if (wedge == UINT32_MAX)
+				return false;
+
+			if (kinds[from] == VertexKind::Border && sharedTriangles != 1)
+				return false;
+
+			Utils::Quadric quadric = quadrics[from];
+			quadric.Add(quadrics[to]);
+			positionError = static_cast<float>(quadric.Evaluate(vertices[to].Position));
+
+			// Attribute differences are scaled by the edge length so they are comparable to the position error
+			const Vertex& fromVertex = vertices[from];
+			const Vertex& toVertex = vertices[wedge];
+
+			const glm::vec3 edge = toVertex.Position - fromVertex.Position;
+			const glm::vec3 normalDelta = toVertex.Normal - fromVertex.Normal;
+			const glm::vec2 texCoordDelta = toVertex.TexCoord - fromVertex.TexCoord;
+
+			const float attributeError = specification.NormalWeight * glm::dot(normalDelta, normalDelta) + specification.TexCoordWeight * glm::dot(texCoordDelta, texCoordDelta);
+			cost = positionError + glm::dot(edge, edge) * attributeError;
+
+			return true;
+		};
+
+		std::vector<uint32_t> versions(vertexCount, 0);
+		std::priority_queue<Utils::Collapse, std::vector<Utils::Collapse>, std::greater<>> queue;
+
+		auto push = [&](const uint32_t from, const uint32_t to)
+		{
+			float cost;
+			float positionError;
+			uint32_t wedge;
+
+			if (evaluate(from, to, cost, positionError, wedge))
+				queue.push({ cost, from, to, versions[from], versions[to] });
+		};
+
+		for (size_t t = 0; t < triangleCount; t++)
+		{
+			if (triangleRemoved[t])
+				continue;
+
+			for (uint32_t c = 0; c < 3; c++)
+			{
+				const uint32_t a = remap[triangles[t * 3 + c]];
+				const uint32_t b = remap[triangles[t * 3 + (c + 1) % 3]];
+
+				push(a, b);
+				push(b, a);
+			}
+		}
+
+		// Collapse the cheapest edges until the target is reached
+		const size_t targetTriangles = specification.TargetIndexCount / 3;
+		const float maxError = specification.MaxError < std::sqrt(FLT_MAX) ? specification.MaxError * specification.MaxError : FLT_MAX;
+		float error = 0.0f;
+
+		std::vector<bool> collapsed(vertexCount, false);
+		std::vector<uint32_t> neighbours;
+
+		while (remainingTriangles > targetTriangles && !queue.empty())
+		{
+			const Utils::Collapse collapse = queue.top();
+			queue.pop();
+
+			const uint32_t from = collapse.From;
+			const uint32_t to = collapse.To;
+
+			// Stale entry, the neighbourhood changed since it was pushed
+			if (collapsed[from] || collapsed[to] || versions[from] != collapse.FromVersion || versions[to] != collapse.ToVersion)
+				continue;
+
+			float cost;
+			float positionError;
+			uint32_t wedge;
+
+			if (!evaluate(from, to, cost, positionError, wedge) || positionError > maxError)
+				continue;
+
+			for (const uint32_t t : vertexTriangles[from])
+			{
+				if (triangleRemoved[t])
+					continue;
+
+				uint32_t* corners = &triangles[t * 3];
+
+				if (remap[corners[0]] == to || remap[corners[1]] == to || remap[corners[2]] == to)
+				{
+					triangleRemoved[t] = true;
+					remainingTriangles--;
+					continue;
+				}
+
+				for (uint32_t c = 0; c < 3; c++)
+				{
+					if (remap[corners[c]] == from)
+						corners[c] = wedge;
+				}
+
+				vertexTriangles[to].emplace_back(t);
+			}
+
+			quadrics[to].Add(quadrics[from]);
+			collapsed[from] = true;
+			vertexTriangles[from].clear();
+			error = std::max(error, positionError);
+
+			auto& toTriangles = vertexTriangles[to];
+			toTriangles.erase(std::remove_if(toTriangles.begin(), toTriangles.end(), [&](const uint32_t t) { return triangleRemoved[t]; }), toTriangles.end());
+
+			// Every collapse touching the ring around 'to' has to be reevaluated
+			neighbours.clear();
+			for (const uint32_t t : toTriangles)
+			{
+				for (uint32_t c = 0; c < 3; c++)
+					neighbours.emplace_back(remap[triangles[t * 3 + c]]);
+			}
+
+			std::sort(neighbours.begin(), neighbours.end());
+			neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+
+			for (const uint32_t v : neighbours)
+				versions[v]++;
+
+			for (const uint32_t v : neighbours)
+			{
+				for (const uint32_t t : vertexTriangles[v])
+				{
+					if (triangleRemoved[t])
+						continue;
+
+					for (uint32_t c = 0; c < 3; c++)
+					{
+						if (const uint32_t u = remap[triangles[t * 3 + c]];
+							u != v)
+						{
+							push(v, u);
+							push(u, v);
+						}
+					}
+				}
+			}
+		}
+
+		std::vector<uint32_t> result;
+		result.reserve(remainingTriangles * 3);
+
+		for (size_t t = 0; t < triangleCount; t++)
+		{
+			if (!triangleRemoved[t])
+				result.insert(result.end(), triangles.begin() + t * 3, triangles.begin() + t * 3 + 3);
+		}
+
+		if (resultError)
+			*resultError = std::sqrt(error);
+
+		return result;
+	}
+}
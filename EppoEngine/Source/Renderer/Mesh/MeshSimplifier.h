@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Renderer/Vertex.h"
+
+#include <cfloat>
+
+namespace Eppo
+{
+	struct MeshSimplifierSpecification
+	{
+		// Amount of indices to reduce to, the result is larger when MaxError is reached first
+		size_t TargetIndexCount = 0;
+		// Maximum allowed error in object space units
+		float MaxError = FLT_MAX;
+
+		// Weights of normal and texture coordinate differences relative to the position error
+		float NormalWeight = 0.5f;
+		float TexCoordWeight = 1.0f;
+	};
+
+	// Simplifies triangle lists with quadric edge collapses, the result indexes into the original vertices
+	class MeshSimplifier
+	{
+	public:
+		static std::vector<uint32_t> Simplify(const Vertex* vertices, size_t vertexCount, const uint32_t* indices, size_t indexCount,
+			const MeshSimplifierSpecification& specification, float* resultError = nullptr);
+	};
+}
@@ -5,10 +5,70 @@
 
 namespace Eppo
 {
-	Submesh::Submesh(std::string name, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, const std::vector<Primitive>& primitives, const glm::mat4& transform)
-		: m_Primitives(primitives), m_Name(std::move(name)), m_LocalTransform(transform)
+	Submesh::Submesh(const SubmeshData& data)
+		: m_VertexFormat(data.Format), m_VertexQuantization(data.Quantization), m_Primitives(data.Primitives), m_BoundingCenter(data.BoundingCenter), m_BoundingRadius(data.BoundingRadius),
+		m_Name(data.Name), m_LocalTransform(data.Transform)
 	{
-		m_VertexBuffer = VertexBuffer::Create(vertices.data(), vertices.size() * sizeof(Vertex));
-		m_IndexBuffer = IndexBuffer::Create(indices.data(), indices.size() * sizeof(uint32_t));
+		m_VertexBuffer = VertexBuffer::Create(data.Vertices.Data, data.Vertices.Size);
+		m_PositionBuffer = VertexBuffer::Create(data.Positions.Data, data.Positions.Size);
+		m_IndexBuffer = IndexBuffer::Create(data.Indices.Data, data.Indices.Size);
+
+		uint32_t lodCount = 1;
+		for (const auto& primitive : m_Primitives)
+			lodCount = std::max(lodCount, primitive.GetLodCount());
+
+		m_LodErrors.resize(lodCount, 0.0f);
+
+		for (uint32_t lod = 1; lod < lodCount; lod++)
+		{
+			for (const auto& primitive : m_Primitives)
+				m_LodErrors[lod] = std::max(m_LodErrors[lod], primitive.GetLod(lod).Error);
+
+			if (m_BoundingRadius > 0.0f)
+				m_LodErrors[lod] /= m_BoundingRadius;
+		}
+	}
+
+	SubmeshData Submesh::Pack(std::string name, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, const std::vector<Primitive>& primitives, const glm::mat4& transform,
+		const VertexFormat vertexFormat, std::vector<uint8_t>& vertexStorage, std::vector<uint8_t>& positionStorage)
+	{
+		EPPO_PROFILE_FUNCTION("Submesh::Pack");
+
+		SubmeshData data;
+		data.Name = std::move(name);
+		data.Transform = transform;
+		data.Primitives = primitives;
+		data.Format = vertexFormat;
+
+		glm::vec3 min(0.0f);
+		glm::vec3 max(0.0f);
+
+		// Bounding sphere around the center of the bounding box
+		if (!vertices.empty())
+		{
+			min = vertices[0].Position;
+			max = vertices[0].Position;
+
+			for (const auto& vertex : vertices)
+			{
+				min = glm::min(min, vertex.Position);
+				max = glm::max(max, vertex.Position);
+			}
+
+			data.BoundingCenter = (min + max) * 0.5f;
+
+			for (const auto& vertex : vertices)
+				data.BoundingRadius = std::max(data.BoundingRadius, glm::distance(data.BoundingCenter, vertex.Position));
+		}
+
+		// Quantized positions use the bounding box of the submesh
+		data.Quantization = VertexPacking::GetQuantization(vertexFormat, min, max);
+		VertexPacking::Pack(vertices.data(), vertices.size(), vertexFormat, data.Quantization, vertexStorage, positionStorage);
+
+		data.Vertices = { vertexStorage.data(), static_cast<uint32_t>(vertexStorage.size()) };
+		data.Positions = { positionStorage.data(), static_cast<uint32_t>(positionStorage.size()) };
+		data.Indices = { indices.data(), static_cast<uint32_t>(indices.size() * sizeof(uint32_t)) };
+
+		return data;
 	}
 }
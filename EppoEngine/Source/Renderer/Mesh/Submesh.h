@@ -1,40 +1,114 @@
 #pragma once
 
 #include "Renderer/Mesh/Material.h"
+#include "Renderer/Mesh/VertexPacking.h"
 #include "Renderer/IndexBuffer.h"
 #include "Renderer/Vertex.h"
 #include "Renderer/VertexBuffer.h"
 
 namespace Eppo
 {
+	struct PrimitiveLod
+	{
+		uint32_t FirstIndex = 0;
+		uint32_t IndexCount = 0;
+
+		// Simplification error in object space units
+		float Error = 0.0f;
+	};
+
 	struct Primitive
 	{
+		static constexpr uint32_t MaxLods = 5;
+
 		uint32_t FirstVertex = 0;
 		uint32_t FirstIndex = 0;
 		uint32_t VertexCount = 0;
 		uint32_t IndexCount = 0;
 
+		// Simplified index ranges in the same index buffer, LOD 0 is the range above
+		std::vector<PrimitiveLod> Lods;
+
+		int32_t MaterialIndex = -1;
 		Ref<Material> Material = nullptr;
+
+		[[nodiscard]] uint32_t GetLodCount() const { return static_cast<uint32_t>(Lods.size()) + 1; }
+		[[nodiscard]] PrimitiveLod GetLod(const uint32_t lod) const
+		{
+			if (lod == 0 || Lods.empty())
+				return { FirstIndex, IndexCount, 0.0f };
+
+			return Lods[std::min(lod, static_cast<uint32_t>(Lods.size())) - 1];
+		}
+	};
+
+	// Non-owning view of GPU ready bytes
+	struct SubmeshBlob
+	{
+		const void* Data = nullptr;
+		uint32_t Size = 0;
+	};
+
+	// Everything needed to create a submesh, packed at import or read straight from a cooked mesh
+	struct SubmeshData
+	{
+		std::string Name;
+		glm::mat4 Transform = glm::mat4(1.0f);
+		std::vector<Primitive> Primitives;
+
+		VertexFormat Format = VertexFormat::Standard;
+		VertexQuantization Quantization;
+		glm::vec3 BoundingCenter = glm::vec3(0.0f);
+		float BoundingRadius = 0.0f;
+
+		// Only have to stay alive while the submesh is created
+		SubmeshBlob Vertices;
+		SubmeshBlob Positions;
+		SubmeshBlob Indices;
 	};
 
 	class Submesh
 	{
 	public:
-		Submesh(std::string name, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, const std::vector<Primitive>& primitives, const glm::mat4& transform);
+		explicit Submesh(const SubmeshData& data);
+
+		// Computes the bounds and packs the vertices into the storage, which the returned blobs point to
+		static SubmeshData Pack(std::string name, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, const std::vector<Primitive>& primitives, const glm::mat4& transform,
+			VertexFormat vertexFormat, std::vector<uint8_t>& vertexStorage, std::vector<uint8_t>& positionStorage);
 
 		[[nodiscard]] Ref<VertexBuffer> GetVertexBuffer() const { return m_VertexBuffer; }
+		// Positions only, in the position format of the vertex format
+		[[nodiscard]] Ref<VertexBuffer> GetPositionBuffer() const { return m_PositionBuffer; }
 		[[nodiscard]] Ref<IndexBuffer> GetIndexBuffer() const { return m_IndexBuffer; }
 
 		[[nodiscard]] const std::vector<Primitive>& GetPrimitives() const { return m_Primitives; }
 
+		[[nodiscard]] VertexFormat GetVertexFormat() const { return m_VertexFormat; }
+		[[nodiscard]] const VertexQuantization& GetVertexQuantization() const { return m_VertexQuantization; }
+
 		[[nodiscard]] const std::string& GetName() const { return m_Name; }
 		[[nodiscard]] const glm::mat4& GetLocalTransform() const { return m_LocalTransform; }
 
+		// Bounding sphere in the local space of the submesh
+		[[nodiscard]] const glm::vec3& GetBoundingCenter() const { return m_BoundingCenter; }
+		[[nodiscard]] float GetBoundingRadius() const { return m_BoundingRadius; }
+
+		[[nodiscard]] uint32_t GetLodCount() const { return static_cast<uint32_t>(m_LodErrors.size()); }
+		// Largest error of all primitives at this LOD, relative to the bounding radius
+		[[nodiscard]] float GetLodError(const uint32_t lod) const { return m_LodErrors[lod]; }
+
 	private:
 		Ref<VertexBuffer> m_VertexBuffer;
+		Ref<VertexBuffer> m_PositionBuffer;
 		Ref<IndexBuffer> m_IndexBuffer;
+		VertexFormat m_VertexFormat;
+		VertexQuantization m_VertexQuantization;
 		std::vector<Primitive> m_Primitives;
 
+		glm::vec3 m_BoundingCenter = glm::vec3(0.0f);
+		float m_BoundingRadius = 0.0f;
+		std::vector<float> m_LodErrors;
+
 		std::string m_Name;
 		glm::mat4 m_LocalTransform;
 	};
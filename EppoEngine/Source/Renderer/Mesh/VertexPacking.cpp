@@ -0,0 +1,161 @@
+#include "pch.h"
+#include "VertexPacking.h"
+
+#include <glm/gtc/packing.hpp>
+
+namespace Eppo
+{
+	namespace Utils
+	{
+		static float SignNotZero(const float value)
+		{
+			return value >= 0.0f ? 1.0f : -1.0f;
+		}
+
+		static void PackNormalAndTexCoord(const Vertex& vertex, int16_t* normal, uint16_t* texCoord)
+		{
+			const glm::vec2 encoded = VertexPacking::EncodeOctahedral(vertex.Normal);
+			normal[0] = static_cast<int16_t>(glm::packSnorm1x16(encoded.x));
+			normal[1] = static_cast<int16_t>(glm::packSnorm1x16(encoded.y));
+
+			texCoord[0] = glm::packHalf1x16(vertex.TexCoord.x);
+			texCoord[1] = glm::packHalf1x16(vertex.TexCoord.y);
+		}
+
+		static void QuantizePosition(const glm::vec3& position, const VertexQuantization& quantization, uint16_t* quantized)
+		{
+			const glm::vec3 normalized = (position - quantization.Offset) / quantization.Scale;
+
+			quantized[0] = glm::packUnorm1x16(normalized.x);
+			quantized[1] = glm::packUnorm1x16(normalized.y);
+			quantized[2] = glm::packUnorm1x16(normalized.z);
+			quantized[3] = 0;
+		}
+	}
+
+	VertexBufferLayout VertexPacking::GetLayout(const VertexFormat format)
+	{
+		switch (format)
+		{
+			case VertexFormat::Standard:
+				return {
+					{ ShaderDataType::Float3, "inPosition" },
+					{ ShaderDataType::Float3, "inNormal" },
+					{ ShaderDataType::Float2, "inTexCoord" }
+				};
+			case VertexFormat::Packed:
+				return {
+					{ ShaderDataType::Float3, "inPosition" },
+					{ ShaderDataType::Short2, "inNormal", true },
+					{ ShaderDataType::Half2, "inTexCoord" }
+				};
+			case VertexFormat::PackedQuantized:
+				return {
+					{ ShaderDataType::UShort4, "inPosition", true },
+					{ ShaderDataType::Short2, "inNormal", true },
+					{ ShaderDataType::Half2, "inTexCoord" }
+				};
+		}
+
+		EPPO_ASSERT(false)
+		return {};
+	}
+
+	VertexBufferLayout VertexPacking::GetPositionLayout(const VertexFormat format)
+	{
+		if (format == VertexFormat::PackedQuantized)
+			return { { ShaderDataType::UShort4, "inPosition", true } };
+
+		return { { ShaderDataType::Float3, "inPosition" } };
+	}
+
+	VertexQuantization VertexPacking::GetQuantization(const VertexFormat format, const glm::vec3& min, const glm::vec3& max)
+	{
+		VertexQuantization quantization;
+
+		if (format == VertexFormat::PackedQuantized)
+		{
+			quantization.Offset = min;
+			// Flat axes still need a non-zero scale to divide by
+			quantization.Scale = glm::max(max - min, glm::vec3(std::numeric_limits<float>::epsilon()));
+		}
+
+		return quantization;
+	}
+
+	void VertexPacking::Pack(const Vertex* vertices, const size_t vertexCount, const VertexFormat format, const VertexQuantization& quantization, std::vector<uint8_t>& vertexData, std::vector<uint8_t>& positionData)
+	{
+		EPPO_PROFILE_FUNCTION("VertexPacking::Pack");
+
+		vertexData.resize(vertexCount * GetLayout(format).GetStride());
+		positionData.resize(vertexCount * GetPositionLayout(format).GetStride());
+
+		switch (format)
+		{
+			case VertexFormat::Standard:
+			{
+				std::memcpy(vertexData.data(), vertices, vertexCount * sizeof(Vertex));
+
+				auto* positions = reinterpret_cast<glm::vec3*>(positionData.data());
+				for (size_t i = 0; i < vertexCount; i++)
+					positions[i] = vertices[i].Position;
+
+				break;
+			}
+			case VertexFormat::Packed:
+			{
+				auto* packed = reinterpret_cast<PackedVertex*>(vertexData.data());
+				auto* positions = reinterpret_cast<glm::vec3*>(positionData.data());
+
+				for (size_t i = 0; i < vertexCount; i++)
+				{
+					packed[i].Position = vertices[i].Position;
+					Utils::PackNormalAndTexCoord(vertices[i], packed[i].Normal, packed[i].TexCoord);
+
+					positions[i] = vertices[i].Position;
+				}
+
+				break;
+			}
+			case VertexFormat::PackedQuantized:
+			{
+				auto* packed = reinterpret_cast<QuantizedVertex*>(vertexData.data());
+				auto* positions = reinterpret_cast<uint16_t*>(positionData.data());
+
+				for (size_t i = 0; i < vertexCount; i++)
+				{
+					Utils::QuantizePosition(vertices[i].Position, quantization, packed[i].Position);
+					Utils::PackNormalAndTexCoord(vertices[i], packed[i].Normal, packed[i].TexCoord);
+
+					std::memcpy(&positions[i * 4], packed[i].Position, sizeof(packed[i].Position));
+				}
+
+				break;
+			}
+		}
+	}
+
+	glm::vec2 VertexPacking::EncodeOctahedral(const glm::vec3& normal)
+	{
+		const float sum = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+		if (sum <= 0.0f)
+			return glm::vec2(0.0f);
+
+		const glm::vec3 n = normal / sum;
+		if (n.z >= 0.0f)
+			return glm::vec2(n.x, n.y);
+
+		return glm::vec2((1.0f - std::abs(n.y)) * Utils::SignNotZero(n.x), (1.0f - std::abs(n.x)) * Utils::SignNotZero(n.y));
+	}
+
+	glm::vec3 VertexPacking::DecodeOctahedral(const glm::vec2& encoded)
+	{
+		glm::vec3 n(encoded.x, encoded.y, 1.0f - std::abs(encoded.x) - std::abs(encoded.y));
+
+		const float t = std::max(-n.z, 0.0f);
+		n.x += n.x >= 0.0f ? -t : t;
+		n.y += n.y >= 0.0f ? -t : t;
+
+		return glm::normalize(n);
+	}
+}
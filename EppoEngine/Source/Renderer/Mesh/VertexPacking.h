@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Renderer/Vertex.h"
+#include "Renderer/VertexBufferLayout.h"
+
+namespace Eppo
+{
+	// Maps quantized positions back to object space: position = Offset + unorm * Scale
+	struct VertexQuantization
+	{
+		glm::vec3 Offset = glm::vec3(0.0f);
+		glm::vec3 Scale = glm::vec3(1.0f);
+	};
+
+	class VertexPacking
+	{
+	public:
+		static constexpr uint32_t FormatCount = 3;
+
+		// Layout of the interleaved stream used by the geometry pass
+		static VertexBufferLayout GetLayout(VertexFormat format);
+		// Layout of the position-only stream used by the depth passes
+		static VertexBufferLayout GetPositionLayout(VertexFormat format);
+
+		// Quantization of the given bounds, identity for unquantized formats
+		static VertexQuantization GetQuantization(VertexFormat format, const glm::vec3& min, const glm::vec3& max);
+
+		// Writes both the interleaved stream and the position-only stream
+		static void Pack(const Vertex* vertices, size_t vertexCount, VertexFormat format, const VertexQuantization& quantization, std::vector<uint8_t>& vertexData, std::vector<uint8_t>& positionData);
+
+		// Maps a unit vector to the [-1, 1] square by folding the lower octahedron hemisphere over the upper one
+		static glm::vec2 EncodeOctahedral(const glm::vec3& normal);
+		static glm::vec3 DecodeOctahedral(const glm::vec2& encoded);
+	};
+}
@@ -24,6 +24,13 @@ namespace Eppo
 		virtual void PresentFrame() = 0;
 		virtual void WaitIdle() = 0;
 
+		// Resource uploads in between are recorded together and submitted once at the end
+		virtual void BeginUploadBatch() = 0;
+		virtual void EndUploadBatch() = 0;
+
+		// Runs fn once the frames in flight are done, or at shutdown when freeOnShutdown is set
+		virtual void SubmitResourceFree(const std::function<void()>& fn, bool freeOnShutdown = true) = 0;
+
 		[[nodiscard]] virtual Ref<Renderer> GetRenderer() const = 0;
 
 		virtual GLFWwindow* GetWindowHandle() = 0;
@@ -2,6 +2,8 @@
 
 #include "Renderer/Camera/EditorCamera.h"
 #include "Renderer/Mesh/Mesh.h"
+#include "Renderer/DynamicResolution.h"
+#include "Renderer/GPUProfiler.h"
 #include "Renderer/Image.h"
 #include "Renderer/DrawCommand.h"
 
@@ -13,6 +15,16 @@ namespace Eppo
 	class Scene;
 	using EntityHandle = entt::entity;
 
+	struct MeshLodSpecification
+	{
+		bool Enabled = true;
+
+		// Largest allowed simplification error in pixels before a more detailed LOD is used
+		float ErrorThreshold = 1.0f;
+		// Shadow maps use this many LODs coarser than the camera
+		uint32_t ShadowLodBias = 1;
+	};
+
 	// TODO: Move to renderer
 	struct RenderSpecification
 	{
@@ -20,6 +32,10 @@ namespace Eppo
 		uint32_t Height = 0;
 
 		bool DebugRendering = false;
+
+		// Renders the geometry and skybox passes at a scaled resolution and upscales in the composite pass
+		DynamicResolutionSpecification DynamicResolution;
+		MeshLodSpecification MeshLod;
 	};
 
 	struct RenderStatistics
@@ -28,6 +44,13 @@ namespace Eppo
 		uint32_t Meshes = 0;
 		uint32_t Submeshes = 0;
 		uint32_t MeshInstances = 0;
+
+		// Triangles drawn by the geometry pass per LOD
+		std::array<uint32_t, Primitive::MaxLods> LodTriangles{};
+
+		// Vertex buffer bytes referenced by the draws of a pass, an upper bound for its vertex fetch traffic
+		uint64_t PreDepthVertexBytes = 0;
+		uint64_t GeometryVertexBytes = 0;
 	};
 
 	class SceneRenderer
@@ -44,6 +67,7 @@ namespace Eppo
 
 		virtual void SubmitDrawCommand(EntityType type, Ref<DrawCommand> drawCommand) = 0;
 		virtual Ref<Image> GetFinalImage() = 0;
+		virtual GPUProfiler& GetGPUProfiler() = 0;
 
 		static Ref<SceneRenderer> Create(Ref<Scene> scene, const RenderSpecification& renderSpec);
 	};
@@ -1,7 +1,6 @@
 #include "pch.h"
 #include "Shader.h"
 
-#include "Core/Filesystem.h"
 #include "Platform/Vulkan/VulkanShader.h"
 #include "Renderer/RendererContext.h"
 
@@ -9,14 +8,6 @@ namespace Eppo
 {
 	namespace Utils
 	{
-		std::filesystem::path GetOrCreateCacheDirectory()
-		{
-			if (!Filesystem::Exists("Resources/Shaders/Cache"))
-				std::filesystem::create_directories("Resources/Shaders/Cache");
-
-			return "Resources/Shaders/Cache";
-		}
-
 		std::string ShaderStageToString(const ShaderStage stage)
 		{
 			switch (stage)
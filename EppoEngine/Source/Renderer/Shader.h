@@ -56,7 +56,6 @@ namespace Eppo
 
 	namespace Utils
 	{
-		std::filesystem::path GetOrCreateCacheDirectory();
 		std::string ShaderStageToString(ShaderStage stage);
 		ShaderStage StringToShaderStage(std::string_view stage);
 	}
@@ -0,0 +1,101 @@
+#include "pch.h"
+#include "Texture.h"
+
+#include "Core/WeakCache.h"
+#include "Platform/MappedFile.h"
+#include "Renderer/Mesh/MeshCooker.h"
+
+#include <stb_image.h>
+
+namespace Eppo
+{
+	// Weak, so a texture lives exactly as long as something uses it
+	static WeakCache<uint64_t, Texture> s_Textures;
+
+	Texture::Texture(const DerivedDataKey& key, Ref<Image> image)
+		: m_Key(key), m_Image(std::move(image))
+	{}
+
+	Ref<Texture> Texture::Find(const DerivedDataKey& key)
+	{
+		return s_Textures.Find(key.GetValue());
+	}
+
+	Ref<Texture> Texture::Create(const DerivedDataKey& key, const uint32_t width, const uint32_t height, const void* pixels)
+	{
+		EPPO_PROFILE_FUNCTION("Texture::Create");
+
+		if (Ref<Texture> texture = Find(key))
+			return texture;
+
+		ImageSpecification imageSpec;
+		imageSpec.Width = width;
+		imageSpec.Height = height;
+		imageSpec.Format = ImageFormat::RGBA8;
+		imageSpec.Usage = ImageUsage::Texture;
+
+		const Ref<Image> image = Image::Create(imageSpec);
+		image->SetData(const_cast<void*>(pixels));
+
+		return s_Textures.Insert(key.GetValue(), CreateRef<Texture>(key, image));
+	}
+
+	bool Texture::Cook(const DerivedDataKey& key, const void* encodedImage, const uint64_t size)
+	{
+		EPPO_PROFILE_FUNCTION("Texture::Cook");
+
+		// Same orientation as images embedded in meshes, so equal contents stay interchangeable
+		stbi_set_flip_vertically_on_load_thread(0);
+
+		int width;
+		int height;
+		int channels;
+		stbi_uc* pixels = stbi_load_from_memory(static_cast<const stbi_uc*>(encodedImage), static_cast<int>(size), &width, &height, &channels, 4);
+		if (!pixels)
+		{
+			EPPO_ERROR("Failed to decode texture {}: {}", key.ToString(), stbi_failure_reason());
+			return false;
+		}
+
+		const bool written = MeshCooker::WriteTexture(key, width, height, ImageFormat::RGBA8, pixels, static_cast<uint64_t>(width) * height * 4);
+		stbi_image_free(pixels);
+
+		return written;
+	}
+
+	Ref<Texture> Texture::Load(const DerivedDataKey& key, const DerivedDataLoader& loader)
+	{
+		EPPO_PROFILE_FUNCTION("Texture::Load");
+
+		if (Ref<Texture> texture = Find(key))
+			return texture;
+
+		const DerivedData data = loader(key, MeshCooker::TextureExtension);
+		const CookedTextureHeader* header = MeshCooker::ValidateTexture(data.Data, data.Size, key);
+		if (!header)
+			return nullptr;
+
+		return Create(key, header->Width, header->Height, data.Data + header->Pixels.Offset);
+	}
+
+	Ref<Texture> Texture::Import(const std::filesystem::path& filepath)
+	{
+		EPPO_PROFILE_FUNCTION("Texture::Import");
+
+		const MappedFile source(filepath);
+		if (!source.IsValid())
+		{
+			EPPO_ERROR("Failed to open texture file '{}'!", filepath.string());
+			return nullptr;
+		}
+
+		const DerivedDataKey key = MeshCooker::GetTextureCacheKey(source.GetData(), source.GetSize());
+		if (Ref<Texture> texture = Find(key))
+			return texture;
+
+		if (!DerivedDataCache::Contains(key, MeshCooker::TextureExtension) && !Cook(key, source.GetData(), source.GetSize()))
+			return nullptr;
+
+		return Load(key, DerivedDataCache::Load);
+	}
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Asset/Asset.h"
+#include "Asset/DerivedDataCache.h"
+#include "Renderer/Image.h"
+
+namespace Eppo
+{
+	// Image asset keyed by the encoded source contents. Equal contents resolve to one resident
+	// texture, whether they come from an image file or are embedded in any number of meshes.
+	class Texture : public Asset
+	{
+	public:
+		Texture(const DerivedDataKey& key, Ref<Image> image);
+		~Texture() override = default;
+
+		// The resident texture for the key, safe on any thread
+		static Ref<Texture> Find(const DerivedDataKey& key);
+		// Uploads RGBA8 pixels, unless a texture with the key is resident already. Main thread only
+		static Ref<Texture> Create(const DerivedDataKey& key, uint32_t width, uint32_t height, const void* pixels);
+
+		// Decodes an encoded image into the derived data cache
+		static bool Cook(const DerivedDataKey& key, const void* encodedImage, uint64_t size);
+		// Reads the cooked texture through the loader, main thread only
+		static Ref<Texture> Load(const DerivedDataKey& key, const DerivedDataLoader& loader);
+		// Image files such as .png and .jpg, cooked on first import. Main thread only
+		static Ref<Texture> Import(const std::filesystem::path& filepath);
+
+		[[nodiscard]] const DerivedDataKey& GetKey() const { return m_Key; }
+		[[nodiscard]] const Ref<Image>& GetImage() const { return m_Image; }
+
+		[[nodiscard]] AssetMemoryUsage GetMemoryUsage() const override { return { 0, m_Image->GetMemoryUsage() }; }
+
+		// Asset
+		static AssetType GetStaticType() { return AssetType::Texture; }
+
+	private:
+		DerivedDataKey m_Key;
+		Ref<Image> m_Image;
+	};
+}
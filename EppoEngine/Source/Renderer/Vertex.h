@@ -4,6 +4,16 @@
 
 namespace Eppo
 {
+	enum class VertexFormat : uint8_t
+	{
+		// Full precision Vertex, 32 bytes
+		Standard,
+		// PackedVertex, 20 bytes
+		Packed,
+		// QuantizedVertex, 16 bytes
+		PackedQuantized
+	};
+
 	struct Vertex
 	{
 		glm::vec3 Position	= glm::vec3(0.0f);
@@ -16,6 +26,26 @@ namespace Eppo
 		{}
 	};
 
+	// Octahedral encoded normal in 2x snorm16 and half float texture coordinates
+	struct PackedVertex
+	{
+		glm::vec3 Position = glm::vec3(0.0f);
+		int16_t Normal[2] = { 0, 0 };
+		uint16_t TexCoord[2] = { 0, 0 };
+	};
+
+	// PackedVertex with the position in unorm16 relative to the submesh bounds, the fourth component is padding
+	struct QuantizedVertex
+	{
+		uint16_t Position[4] = { 0, 0, 0, 0 };
+		int16_t Normal[2] = { 0, 0 };
+		uint16_t TexCoord[2] = { 0, 0 };
+	};
+
+	static_assert(sizeof(Vertex) == 32);
+	static_assert(sizeof(PackedVertex) == 20);
+	static_assert(sizeof(QuantizedVertex) == 16);
+
 	struct LineVertex
 	{
 		glm::vec3 Position	= glm::vec3(0.0f);
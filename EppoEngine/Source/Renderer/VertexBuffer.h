@@ -11,6 +11,7 @@ namespace Eppo
 		virtual ~VertexBuffer() = default;
 
 		virtual void SetData(Buffer buffer) = 0;
+		[[nodiscard]] virtual uint64_t GetMemoryUsage() const = 0;
 
 		static Ref<VertexBuffer> Create(uint32_t size);
 		static Ref<VertexBuffer> Create(const void* data, uint32_t size);
@@ -22,13 +22,16 @@ namespace Eppo
 				case ShaderDataType::Int3:			return 4 * 3;
 				case ShaderDataType::Int4:			return 4 * 4;
 				case ShaderDataType::Bool:			return 1;
+				case ShaderDataType::Half2:			return 2 * 2;
+				case ShaderDataType::Short2:		return 2 * 2;
+				case ShaderDataType::UShort4:		return 2 * 4;
 			}
 
 			EPPO_ASSERT(false);
 			return 0;
 		}
 
-		VkFormat ShaderDataTypeToVkFormat(const ShaderDataType type)
+		VkFormat ShaderDataTypeToVkFormat(const ShaderDataType type, const bool normalized)
 		{
 			switch (type)
 			{
@@ -43,6 +46,9 @@ namespace Eppo
 				case ShaderDataType::Int3:      return VK_FORMAT_R32G32B32_SINT;
 				case ShaderDataType::Int4:      return VK_FORMAT_R32G32B32A32_SINT;
 				case ShaderDataType::Bool:      return VK_FORMAT_R8_UINT;
+				case ShaderDataType::Half2:     return VK_FORMAT_R16G16_SFLOAT;
+				case ShaderDataType::Short2:    return normalized ? VK_FORMAT_R16G16_SNORM : VK_FORMAT_R16G16_SINT;
+				case ShaderDataType::UShort4:   return normalized ? VK_FORMAT_R16G16B16A16_UNORM : VK_FORMAT_R16G16B16A16_UINT;
 			}
 
 			EPPO_ASSERT(false);
@@ -56,6 +62,23 @@ namespace Eppo
 		CalculateOffsetsAndStride();
 	}
 
+	bool VertexBufferLayout::operator==(const VertexBufferLayout& other) const
+	{
+		if (m_Stride != other.m_Stride || m_Elements.size() != other.m_Elements.size())
+			return false;
+
+		for (size_t i = 0; i < m_Elements.size(); i++)
+		{
+			const BufferElement& lhs = m_Elements[i];
+			const BufferElement& rhs = other.m_Elements[i];
+
+			if (lhs.Type != rhs.Type || lhs.Offset != rhs.Offset || lhs.Normalized != rhs.Normalized)
+				return false;
+		}
+
+		return true;
+	}
+
 	void VertexBufferLayout::CalculateOffsetsAndStride()
 	{
 		size_t offset = 0;
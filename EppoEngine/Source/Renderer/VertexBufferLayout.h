@@ -6,13 +6,15 @@ namespace Eppo
 {
 	enum class ShaderDataType : uint8_t
 	{
-		None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool
+		None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool,
+		// 16-bit types for packed vertices, normalized elements are read as floats in [0, 1] or [-1, 1]
+		Half2, Short2, UShort4
 	};
 
 	namespace Utils
 	{
 		uint32_t ShaderDataTypeSize(ShaderDataType type);
-		VkFormat ShaderDataTypeToVkFormat(ShaderDataType type);
+		VkFormat ShaderDataTypeToVkFormat(ShaderDataType type, bool normalized = false);
 	}
 
 	struct BufferElement
@@ -43,6 +45,9 @@ namespace Eppo
 				case ShaderDataType::Int3:			return 3;
 				case ShaderDataType::Int4:			return 4;
 				case ShaderDataType::Bool:			return 1;
+				case ShaderDataType::Half2:			return 2;
+				case ShaderDataType::Short2:		return 2;
+				case ShaderDataType::UShort4:		return 4;
 			}
 
 			EPPO_ASSERT(false)
@@ -59,6 +64,10 @@ namespace Eppo
 		uint32_t GetStride() const { return m_Stride; }
 		const std::vector<BufferElement>& GetElements() const { return m_Elements; }
 
+		// Equal when they give the same vertex input state, element names do not matter
+		bool operator==(const VertexBufferLayout& other) const;
+		bool operator!=(const VertexBufferLayout& other) const { return !(*this == other); }
+
 		std::vector<BufferElement>::iterator begin() { return m_Elements.begin(); }
 		std::vector<BufferElement>::iterator end() { return m_Elements.end(); }
 		std::vector<BufferElement>::const_iterator begin() const { return m_Elements.begin(); }
@@ -4,6 +4,7 @@
 #include "Core/UUID.h"
 #include "Physics/RigidBody.h"
 #include "Renderer/Camera/SceneCamera.h"
+#include "Scene/SpatialIndex.h"
 
 #include <glm/glm.hpp>
 #define GLM_FORCE_DEPTH_ZERO_TO_ONE
@@ -19,6 +20,9 @@ namespace Eppo
 		UUID ID;
 
 		IDComponent() = default;
+		explicit IDComponent(const UUID id)
+			: ID(id)
+		{}
 	};
 
 	struct TagComponent
@@ -111,4 +115,23 @@ namespace Eppo
 
 		PointLightComponent() = default;
 	};
+
+	// Transform as of the previous simulation step, rendering blends it with the current one.
+	// Only exists while the scene runs and is never copied or serialized.
+	struct InterpolationComponent
+	{
+		TransformComponent Previous;
+	};
+
+	// Entry of a mesh entity in the spatial index of its scene, kept up to date by the scene and never copied or serialized
+	struct SpatialComponent
+	{
+		SpatialProxy Proxy = NullSpatialProxy;
+		AssetHandle MeshHandle = 0;
+		// The loaded mesh the bounds come from, a reload under the same handle is a different instance
+		std::weak_ptr<Asset> MeshInstance;
+		AABB LocalBounds;
+		// The transform the bounds in the index were computed for
+		TransformComponent Transform;
+	};
 }
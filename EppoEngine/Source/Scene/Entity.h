@@ -65,6 +65,7 @@ namespace Eppo
 		}
 		
 		const std::string& GetName() { return GetComponent<TagComponent>().Tag; }
+		void SetName(std::string name) { m_Scene->SetEntityName(*this, std::move(name)); }
 		const UUID& GetUUID() { return GetComponent<IDComponent>().ID; }
 
 	private:
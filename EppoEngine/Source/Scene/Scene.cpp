@@ -2,40 +2,42 @@
 #include "Scene.h"
 
 #include "Asset/AssetManager.h"
+#include "Core/Hash.h"
 #include "Renderer/Renderer.h"
 #include "Renderer/SceneRenderer.h"
 #include "Scene/Entity.h"
 #include "Scripting/ScriptEngine.h"
 
-#include <bullet/btBulletDynamicsCommon.h>
-
 namespace Eppo
 {
-	static auto* s_collisionConfig = new btDefaultCollisionConfiguration();
-	static auto* s_collisionDispatcher = new btCollisionDispatcher(s_collisionConfig);
-	static btBroadphaseInterface* s_broadPhaseInterface = new btDbvtBroadphase();
-	static auto* s_Solver = new btSequentialImpulseConstraintSolver();
-
 	namespace Utils
 	{
-		static glm::vec3 BulletToGlm(const btVector3& v)
+		static uint64_t HashName(const std::string_view name)
 		{
-			return { v.getX(), v.getY(), v.getZ() };
+			return Hash::GenerateXXH64(name.data(), name.size());
 		}
 
-		static glm::quat BulletToGlm(const btQuaternion& q)
+		// Rotations are blended as quaternions, so they take the short way around
+		static glm::mat4 InterpolateTransform(const TransformComponent& previous, const TransformComponent& current, const float alpha)
 		{
-			return { q.getW(), q.getX(), q.getY(), q.getZ() };
+			return glm::translate(glm::mat4(1.0f), glm::mix(previous.Translation, current.Translation, alpha))
+				* glm::toMat4(glm::slerp(glm::quat(previous.Rotation), glm::quat(current.Rotation), alpha))
+				* glm::scale(glm::mat4(1.0f), glm::mix(previous.Scale, current.Scale, alpha));
 		}
 
-		static btVector3 GlmToBullet(const glm::vec3& v)
+		static bool IsSameTransform(const TransformComponent& a, const TransformComponent& b)
 		{
-			return { v.x, v.y, v.z };
+			return a.Translation == b.Translation && a.Rotation == b.Rotation && a.Scale == b.Scale;
 		}
 
-		static btQuaternion GlmToBullet(const glm::quat& q)
+		// Meshes that are not resident keep their bounds, a different version only shows up once loaded
+		static bool IsMeshReplaced(const SpatialComponent& spatial)
 		{
-			return { q.x, q.y, q.z, q.w };
+			if (!AssetManager::IsAssetLoaded(spatial.MeshHandle))
+				return false;
+
+			const Ref<Asset> mesh = AssetManager::GetAssetAsync<Asset>(spatial.MeshHandle);
+			return mesh && (mesh.owner_before(spatial.MeshInstance) || spatial.MeshInstance.owner_before(mesh));
 		}
 	}
 
@@ -55,36 +57,11 @@ namespace Eppo
 	{
 		EPPO_PROFILE_FUNCTION("Scene::OnUpdateRuntime");
 
-		// Scripts
+		const uint32_t steps = m_FixedTimestep.Advance(timestep);
+		for (uint32_t i = 0; i < steps; i++)
 		{
-			const auto view = m_Registry.view<ScriptComponent>();
-			for (const auto e : view)
-			{
-				const Entity entity(e, this);
-				ScriptEngine::OnUpdateEntity(entity, timestep);
-			}
-		}
-
-		// Physics
-		m_PhysicsWorld->stepSimulation(timestep, 10);
-
-		const auto view = m_Registry.view<RigidBodyComponent>();
-		for (const auto e : view)
-		{
-			Entity entity(e, this);
-			auto& transform = entity.GetComponent<TransformComponent>();
-			const auto& rigidbody = entity.GetComponent<RigidBodyComponent>();
-
-			btRigidBody* body = rigidbody.RuntimeBody.GetBody();
-			btTransform trans;
-
-			if (body && body->getMotionState())
-				body->getMotionState()->getWorldTransform(trans);
-
-			const auto& position = trans.getOrigin();
-			transform.Translation = Utils::BulletToGlm(position);
-
-			trans.getRotation().getEulerZYX(transform.Rotation.z, transform.Rotation.y, transform.Rotation.x);
+			StoreInterpolationStates();
+			m_SystemScheduler.Run(static_cast<float>(m_FixedTimestep.GetStep()));
 		}
 	}
 
@@ -94,7 +71,7 @@ namespace Eppo
 
 		sceneRenderer->BeginScene(editorCamera);
 
-		RenderScene(sceneRenderer);
+		RenderScene(sceneRenderer, Frustum(editorCamera.GetViewProjectionMatrix()));
 
 		sceneRenderer->EndScene();
 	}
@@ -112,7 +89,7 @@ namespace Eppo
 			{
 				auto [transform, camera] = view.get<TransformComponent, CameraComponent>(e);
 				sceneCamera = &camera.Camera;
-				cameraTransform = transform.GetTransform();
+				cameraTransform = GetRenderTransform(e, transform);
 
 				break;
 			}
@@ -122,8 +99,8 @@ namespace Eppo
 		{
 			sceneRenderer->BeginScene(*sceneCamera, cameraTransform);
 
-			RenderScene(sceneRenderer);
-			
+			RenderScene(sceneRenderer, Frustum(sceneCamera->GetProjectionMatrix() * glm::inverse(cameraTransform)));
+
 			sceneRenderer->EndScene();
 		}
 	}
@@ -134,8 +111,17 @@ namespace Eppo
 
 		m_IsRunning = true;
 
+		m_FixedTimestep.Reset();
+
 		OnPhysicsStart();
 		ScriptEngine::OnRuntimeStart();
+		RegisterSystems();
+
+		// Entities moved by the simulation are drawn blended between its steps
+		for (const auto e : m_Registry.view<RigidBodyComponent, TransformComponent>())
+			m_Registry.emplace_or_replace<InterpolationComponent>(e, m_Registry.get<TransformComponent>(e));
+		for (const auto e : m_Registry.view<ScriptComponent, TransformComponent>())
+			m_Registry.emplace_or_replace<InterpolationComponent>(e, m_Registry.get<TransformComponent>(e));
 
 		const auto view = m_Registry.view<ScriptComponent>();
 		for (const auto e : view)
@@ -151,6 +137,8 @@ namespace Eppo
 
 		m_IsRunning = false;
 
+		m_SystemScheduler.Clear();
+		m_Registry.clear<InterpolationComponent>();
 		OnPhysicsStop();
 		ScriptEngine::OnRuntimeStop();
 	}
@@ -165,25 +153,27 @@ namespace Eppo
 		auto& srcRegistry = scene->m_Registry;
 		auto& dstRegistry = newScene->m_Registry;
 
-		// Every entity in the scene has an ID component
-		std::unordered_map<UUID, entt::entity> entityMap;
-		const auto idView = srcRegistry.view<IDComponent>();
-
-		for (const auto entity : idView)
+		// Every entity in the scene has an ID component, the copies get the same handles
+		for (const auto entity : srcRegistry.view<IDComponent>())
 		{
-			auto uuid = srcRegistry.get<IDComponent>(entity).ID;
-			const auto& name = srcRegistry.get<TagComponent>(entity).Tag;
-			Entity newEntity = newScene->CreateEntityWithUUID(uuid, name);
-			entityMap[uuid] = static_cast<EntityHandle>(newEntity);
+			[[maybe_unused]] const entt::entity newEntity = dstRegistry.create(entity);
+			EPPO_ASSERT(newEntity == entity)
 		}
 
-		CopyComponent<TransformComponent>(srcRegistry, dstRegistry, entityMap);
-		CopyComponent<SpriteComponent>(srcRegistry, dstRegistry, entityMap);
-		CopyComponent<MeshComponent>(srcRegistry, dstRegistry, entityMap);
-		CopyComponent<DirectionalLightComponent>(srcRegistry, dstRegistry, entityMap);
-		CopyComponent<ScriptComponent>(srcRegistry, dstRegistry, entityMap);
-		CopyComponent<RigidBodyComponent>(srcRegistry, dstRegistry, entityMap);
-		CopyComponent<CameraComponent>(srcRegistry, dstRegistry, entityMap);
+		// So the UUID and name lookups stay valid as they are
+		newScene->m_EntityMap = scene->m_EntityMap;
+		newScene->m_NameIndex = scene->m_NameIndex;
+
+		CopyStorage<IDComponent>(srcRegistry, dstRegistry);
+		CopyStorage<TagComponent>(srcRegistry, dstRegistry);
+		CopyStorage<TransformComponent>(srcRegistry, dstRegistry);
+		CopyStorage<SpriteComponent>(srcRegistry, dstRegistry);
+		CopyStorage<MeshComponent>(srcRegistry, dstRegistry);
+		CopyStorage<DirectionalLightComponent>(srcRegistry, dstRegistry);
+		CopyStorage<ScriptComponent>(srcRegistry, dstRegistry);
+		CopyStorage<RigidBodyComponent>(srcRegistry, dstRegistry);
+		CopyStorage<CameraComponent>(srcRegistry, dstRegistry);
+		CopyStorage<PointLightComponent>(srcRegistry, dstRegistry);
 
 		return newScene;
 	}
@@ -198,18 +188,15 @@ namespace Eppo
 	}
 
 	template<typename T>
-	void Scene::CopyComponent(entt::registry& srcRegistry, entt::registry& dstRegistry, const std::unordered_map<UUID, entt::entity>& entityMap)
+	void Scene::CopyStorage(entt::registry& srcRegistry, entt::registry& dstRegistry)
 	{
-		EPPO_PROFILE_FUNCTION("Scene::CopyComponent");
+		EPPO_PROFILE_FUNCTION("Scene::CopyStorage");
 
-		auto view = srcRegistry.view<T>();
+		// Entities and components of a storage iterate in the same order, one bulk insert copies all of them
+		auto& storage = srcRegistry.storage<T>();
+		const entt::sparse_set& entities = storage;
 
-		for (auto srcEntity : view)
-		{
-			entt::entity dstEntity = entityMap.at(srcRegistry.get<IDComponent>(srcEntity).ID);
-			auto& srcComponent = srcRegistry.get<T>(srcEntity);
-			dstRegistry.emplace_or_replace<T>(dstEntity, srcComponent);
-		}
+		dstRegistry.insert<T>(entities.begin(), entities.end(), storage.begin());
 	}
 
 	Entity Scene::CreateEntity(const std::string& name)
@@ -232,6 +219,7 @@ namespace Eppo
 		tag.Tag = name.empty() ? "Entity" : name;
 
 		m_EntityMap[uuid] = static_cast<EntityHandle>(entity);
+		AddToNameIndex(static_cast<EntityHandle>(entity), tag.Tag);
 
 		return entity;
 	}
@@ -258,6 +246,16 @@ namespace Eppo
 	{
 		EPPO_PROFILE_FUNCTION("Scene::DestroyEntity");
 
+		if (const auto* spatial = m_Registry.try_get<SpatialComponent>(static_cast<EntityHandle>(entity)))
+			m_SpatialIndex.Remove(spatial->Proxy);
+
+		if (const auto* rigidbody = m_Registry.try_get<RigidBodyComponent>(static_cast<EntityHandle>(entity));
+			rigidbody && m_PhysicsWorld && rigidbody->RuntimeBody.GetBody())
+		{
+			m_PhysicsWorld->RemoveBody(rigidbody->RuntimeBody.GetBody());
+		}
+
+		RemoveFromNameIndex(static_cast<EntityHandle>(entity), entity.GetName());
 		m_EntityMap.erase(entity.GetUUID());
 		m_Registry.destroy(static_cast<EntityHandle>(entity));
 	}
@@ -279,112 +277,314 @@ namespace Eppo
 	{
 		EPPO_PROFILE_FUNCTION("Scene::FindEntityByName");
 
-		const auto view = m_Registry.view<TagComponent>();
-		for (auto e : view)
+		// Other names may share the hash, so the name itself is compared as well
+		if (const auto it = m_NameIndex.find(Utils::HashName(name));
+			it != m_NameIndex.end())
 		{
-			const auto& tc = view.get<TagComponent>(e);
-			if (tc.Tag == name)
-				return { e, this };
+			for (const auto e : it->second)
+			{
+				if (m_Registry.get<TagComponent>(e).Tag == name)
+					return { e, this };
+			}
 		}
 
 		return {};
 	}
 
-	void Scene::OnPhysicsStart()
+	std::vector<Entity> Scene::FindEntitiesByName(const std::string_view name)
 	{
-		EPPO_PROFILE_FUNCTION("Scene::OnPhysicsStart");
+		EPPO_PROFILE_FUNCTION("Scene::FindEntitiesByName");
 
-		m_PhysicsWorld = new btDiscreteDynamicsWorld(s_collisionDispatcher, s_broadPhaseInterface, s_Solver, s_collisionConfig);
-		m_PhysicsWorld->setGravity(btVector3(0.0f, -9.81f, 0.0f));
+		std::vector<Entity> entities;
 
-		const auto view = m_Registry.view<RigidBodyComponent>();
-		for (const auto e : view)
+		if (const auto it = m_NameIndex.find(Utils::HashName(name));
+			it != m_NameIndex.end())
 		{
-			Entity entity(e, this);
-			const auto& transform = entity.GetComponent<TransformComponent>();
-			auto& rigidbody = entity.GetComponent<RigidBodyComponent>();
+			for (const auto e : it->second)
+			{
+				if (m_Registry.get<TagComponent>(e).Tag == name)
+					entities.emplace_back(e, this);
+			}
+		}
 
-			btCollisionShape* shape = new btBoxShape(btVector3(transform.Scale.x, transform.Scale.y, transform.Scale.z));
+		return entities;
+	}
 
-			btTransform bTransform;
-			bTransform.setIdentity();
-			bTransform.setOrigin(btVector3(transform.Translation.x, transform.Translation.y, transform.Translation.z));
-			bTransform.setRotation(Utils::GlmToBullet(glm::quat(transform.Rotation)));
+	void Scene::SetEntityName(Entity entity, std::string name)
+	{
+		EPPO_PROFILE_FUNCTION("Scene::SetEntityName");
 
-			const bool isDynamic = rigidbody.Type == RigidBodyComponent::BodyType::Dynamic;
-			btScalar mass(0.0f);
-			if (isDynamic)
-				mass = rigidbody.Mass;
+		const auto handle = static_cast<EntityHandle>(entity);
+		auto& tag = m_Registry.get<TagComponent>(handle);
+		if (tag.Tag == name)
+			return;
 
-			auto localInertia(btVector3(0.0f, 0.0f, 0.0f));
-			if (isDynamic)
-				shape->calculateLocalInertia(mass, localInertia);
+		RemoveFromNameIndex(handle, tag.Tag);
+		tag.Tag = std::move(name);
+		AddToNameIndex(handle, tag.Tag);
+	}
 
-			auto* motionState = new btDefaultMotionState(bTransform);
-			btRigidBody::btRigidBodyConstructionInfo rbInfo(mass, motionState, shape, localInertia);
-			auto* body = new btRigidBody(rbInfo);
+	void Scene::AddToNameIndex(const entt::entity entity, const std::string_view name)
+	{
+		m_NameIndex[Utils::HashName(name)].emplace_back(entity);
+	}
 
-			m_PhysicsWorld->addRigidBody(body);
-			rigidbody.RuntimeBody = RigidBody(body);
+	void Scene::RemoveFromNameIndex(const entt::entity entity, const std::string_view name)
+	{
+		const auto it = m_NameIndex.find(Utils::HashName(name));
+		if (it == m_NameIndex.end())
+			return;
+
+		// Order within a name does not matter, the last entity takes the place of the removed one
+		auto& entities = it->second;
+		if (const auto e = std::find(entities.begin(), entities.end(), entity);
+			e != entities.end())
+		{
+			*e = entities.back();
+			entities.pop_back();
 		}
+
+		if (entities.empty())
+			m_NameIndex.erase(it);
 	}
 
-	void Scene::OnPhysicsStop()
+	void Scene::ReplaceEntities(entt::registry&& registry, std::unordered_map<UUID, entt::entity>&& entityMap)
 	{
-		EPPO_PROFILE_FUNCTION("Scene::OnPhysicsStop");
+		EPPO_PROFILE_FUNCTION("Scene::ReplaceEntities");
+
+		const bool physicsRunning = m_PhysicsWorld != nullptr;
+		if (physicsRunning)
+			OnPhysicsStop();
+
+		m_Registry = std::move(registry);
+		m_EntityMap = std::move(entityMap);
+
+		// The proxies belong to the old entities, the next update builds the index anew
+		m_SpatialIndex.Clear();
+		m_VisibleEntities.clear();
+		m_ShadowCasters.clear();
+		m_LightQueryResults.clear();
+		m_Registry.clear<SpatialComponent>();
 
-		for (int i = m_PhysicsWorld->getNumCollisionObjects() - 1; i >= 0; i--)
+		m_NameIndex.clear();
+		const auto view = m_Registry.view<TagComponent>();
+		for (const auto e : view)
+			AddToNameIndex(e, view.get<TagComponent>(e).Tag);
+
+		if (physicsRunning)
+			OnPhysicsStart();
+	}
+
+	void Scene::UpdateSpatialIndex()
+	{
+		EPPO_PROFILE_FUNCTION("Scene::UpdateSpatialIndex");
+
+		// Entities that lost their mesh leave the index
 		{
-			btCollisionObject* obj = m_PhysicsWorld->getCollisionObjectArray()[i];
-			btRigidBody* body = btRigidBody::upcast(obj);
+			std::vector<entt::entity> removed;
 
-			if (body && body->getMotionState())
-				delete body->getMotionState();
+			const auto view = m_Registry.view<SpatialComponent>();
+			for (const auto e : view)
+			{
+				if (!m_Registry.all_of<MeshComponent, TransformComponent>(e))
+					removed.emplace_back(e);
+			}
 
-			if (body && body->getCollisionShape())
-				delete body->getCollisionShape();
+			for (const auto e : removed)
+			{
+				m_SpatialIndex.Remove(m_Registry.get<SpatialComponent>(e).Proxy);
+				m_Registry.remove<SpatialComponent>(e);
+			}
+		}
+
+		std::vector<entt::entity> inserted;
+		std::vector<AABB> insertedBounds;
+
+		// Meshes reloaded under the same handle have new bounds, they are only looked for once assets changed
+		const uint64_t loadGeneration = AssetManager::GetLoadGeneration();
+		const bool assetsChanged = loadGeneration != m_SpatialLoadGeneration;
+		m_SpatialLoadGeneration = loadGeneration;
+
+		const auto view = m_Registry.view<MeshComponent, TransformComponent>();
+		for (const auto e : view)
+		{
+			auto [meshC, transform] = view.get<MeshComponent, TransformComponent>(e);
+			auto* spatial = m_Registry.try_get<SpatialComponent>(e);
+
+			// Only moved entities touch the index, and most of them stay inside their leaf
+			if (spatial && spatial->MeshHandle == meshC.MeshHandle && !(assetsChanged && Utils::IsMeshReplaced(*spatial)))
+			{
+				if (!Utils::IsSameTransform(spatial->Transform, transform))
+				{
+					spatial->Transform = transform;
+					m_SpatialIndex.Update(spatial->Proxy, spatial->LocalBounds.Transform(transform.GetTransform()));
+				}
+
+				continue;
+			}
+
+			// New or replaced meshes have bounds once they are resident
+			const Ref<Mesh> mesh = meshC.MeshHandle ? AssetManager::GetAssetAsync<Mesh>(meshC.MeshHandle) : nullptr;
+			if (!mesh)
+			{
+				if (spatial)
+				{
+					m_SpatialIndex.Remove(spatial->Proxy);
+					m_Registry.remove<SpatialComponent>(e);
+				}
+
+				continue;
+			}
 
-			m_PhysicsWorld->removeCollisionObject(obj);
-			delete obj;
+			const AABB bounds = mesh->GetBoundingBox().Transform(transform.GetTransform());
+			if (!spatial)
+			{
+				spatial = &m_Registry.emplace<SpatialComponent>(e);
+				inserted.emplace_back(e);
+				insertedBounds.emplace_back(bounds);
+			}
+			else
+			{
+				m_SpatialIndex.Update(spatial->Proxy, bounds);
+			}
+
+			spatial->MeshHandle = meshC.MeshHandle;
+			spatial->MeshInstance = mesh;
+			spatial->LocalBounds = mesh->GetBoundingBox();
+			spatial->Transform = transform;
 		}
 
-		const auto view = m_Registry.view<RigidBodyComponent>();
+		// Filling an empty index, such as for a copied scene, is faster as one build
+		if (m_SpatialIndex.GetProxyCount() == 0)
+		{
+			std::vector<SpatialProxy> proxies;
+			m_SpatialIndex.Build(inserted, insertedBounds, proxies);
+
+			for (size_t i = 0; i < inserted.size(); i++)
+				m_Registry.get<SpatialComponent>(inserted[i]).Proxy = proxies[i];
+		}
+		else
+		{
+			for (size_t i = 0; i < inserted.size(); i++)
+				m_Registry.get<SpatialComponent>(inserted[i]).Proxy = m_SpatialIndex.Insert(inserted[i], insertedBounds[i]);
+		}
+	}
+
+	Entity Scene::Raycast(const Ray& ray, const float maxDistance)
+	{
+		EPPO_PROFILE_FUNCTION("Scene::Raycast");
+
+		std::vector<RaycastHit> hits;
+		m_SpatialIndex.Raycast(ray, maxDistance, hits);
+
+		if (hits.empty())
+			return {};
+
+		return { hits.front().Entity, this };
+	}
+
+	void Scene::OnPhysicsStart()
+	{
+		EPPO_PROFILE_FUNCTION("Scene::OnPhysicsStart");
+
+		m_PhysicsWorld = CreateScope<PhysicsWorld>(m_ThreadedPhysics);
+
+		const auto view = m_Registry.view<RigidBodyComponent, TransformComponent>();
 		for (const auto e : view)
 		{
-			Entity entity(e, this);
-			auto& rigidbody = entity.GetComponent<RigidBodyComponent>();
+			auto [rigidbody, transform] = view.get<RigidBodyComponent, TransformComponent>(e);
+
+			const bool isDynamic = rigidbody.Type == RigidBodyComponent::BodyType::Dynamic;
+			btRigidBody* body = m_PhysicsWorld->AddBody(e, transform.Translation, glm::quat(transform.Rotation), transform.Scale, isDynamic ? rigidbody.Mass : 0.0f);
+
+			rigidbody.RuntimeBody = RigidBody(m_PhysicsWorld.get(), body);
+		}
+	}
+
+	void Scene::OnPhysicsStop()
+	{
+		EPPO_PROFILE_FUNCTION("Scene::OnPhysicsStop");
 
+		const auto view = m_Registry.view<RigidBodyComponent>();
+		for (const auto e : view)
+		{
+			auto& rigidbody = view.get<RigidBodyComponent>(e);
 			rigidbody.RuntimeBody.ClearBody();
 		}
 
-		delete m_PhysicsWorld;
-		m_PhysicsWorld = nullptr;
+		m_PhysicsWorld.reset();
 	}
 
-	void Scene::RenderScene(const Ref<SceneRenderer>& sceneRenderer)
+	void Scene::SyncPhysicsTransforms()
 	{
-		EPPO_PROFILE_FUNCTION("Scene::RenderScene");
+		EPPO_PROFILE_FUNCTION("Scene::SyncPhysicsTransforms");
 
+		// Only bodies Bullet moved in the last step, sleeping and static ones keep their transforms as they are.
+		// Every pose belongs to another entity, so chunks of them are written concurrently.
+		auto& storage = m_Registry.storage<TransformComponent>();
+		SystemScheduler::ParallelEach(m_PhysicsWorld->GetMovedBodies(), [&storage](const PhysicsPose& pose)
 		{
-			const auto view = m_Registry.view<MeshComponent, TransformComponent>();
+			auto& transform = storage.get(pose.Entity);
+			transform.Translation = pose.Translation;
+			transform.Rotation = pose.Rotation;
+		});
+	}
 
-			for (const EntityHandle entity : view)
+	void Scene::RegisterSystems()
+	{
+		EPPO_PROFILE_FUNCTION("Scene::RegisterSystems");
+
+		m_SystemScheduler.Clear();
+
+		// Scripts may touch any component and call into Mono, which stays on the main thread
+		m_SystemScheduler.AddSystem("Scripts", SystemAccess().Exclusive().MainThread(), [this](const float timestep)
+		{
+			const auto view = m_Registry.view<ScriptComponent>();
+			for (const auto e : view)
 			{
-				if (auto [meshC, transform] = view.get<MeshComponent, TransformComponent>(entity);
-					meshC.MeshHandle)
-				{
-					if (const Ref<Mesh> mesh = AssetManager::GetAsset<Mesh>(meshC.MeshHandle))
-					{
-						Ref<MeshCommand> meshCommand = CreateRef<MeshCommand>();
-						meshCommand->Handle = entity;
-						meshCommand->Mesh = mesh;
-						meshCommand->Transform = transform.GetTransform();
-
-						sceneRenderer->SubmitDrawCommand(EntityType::Mesh, meshCommand);
-					}
-				}
+				const Entity entity(e, this);
+				ScriptEngine::OnUpdateEntity(entity, timestep);
 			}
+		});
+
+		m_SystemScheduler.AddSystem("Physics", SystemAccess().Write<RigidBodyComponent>(), [this](const float timestep)
+		{
+			m_PhysicsWorld->Step(timestep);
+		});
+
+		m_SystemScheduler.AddSystem("PhysicsTransformSync", SystemAccess().Read<RigidBodyComponent>().Write<TransformComponent>(), [this](const float)
+		{
+			SyncPhysicsTransforms();
+		});
+	}
+
+	void Scene::StoreInterpolationStates()
+	{
+		EPPO_PROFILE_FUNCTION("Scene::StoreInterpolationStates");
+
+		const auto view = m_Registry.view<InterpolationComponent, TransformComponent>();
+		for (const auto e : view)
+		{
+			auto [interpolation, transform] = view.get<InterpolationComponent, TransformComponent>(e);
+			interpolation.Previous = transform;
 		}
+	}
+
+	glm::mat4 Scene::GetRenderTransform(const entt::entity entity, const TransformComponent& transform)
+	{
+		if (const auto* interpolation = m_Registry.try_get<InterpolationComponent>(entity))
+			return Utils::InterpolateTransform(interpolation->Previous, transform, m_FixedTimestep.GetAlpha());
+
+		return transform.GetTransform();
+	}
+
+	void Scene::RenderScene(const Ref<SceneRenderer>& sceneRenderer, const Frustum& frustum)
+	{
+		EPPO_PROFILE_FUNCTION("Scene::RenderScene");
+
+		UpdateSpatialIndex();
+
+		std::vector<Sphere> lightRanges;
 
 		{
 			const auto view = m_Registry.view<PointLightComponent, TransformComponent>();
@@ -395,11 +595,53 @@ namespace Eppo
 				
 				Ref<PointLightCommand> pointLightCommand = CreateRef<PointLightCommand>();
 				pointLightCommand->Handle = entity;
-				pointLightCommand->Position = transform.Translation;
+				pointLightCommand->Position = glm::vec3(GetRenderTransform(entity, transform)[3]);
 				pointLightCommand->Color = pl.Color;
 
 				sceneRenderer->SubmitDrawCommand(EntityType::PointLight, pointLightCommand);
+
+				lightRanges.emplace_back(pointLightCommand->Position, PointLightCommand::ShadowRange);
 			}
 		}
+
+		// Meshes in view, and the ones out of view but in range of a light to cast its shadows
+		m_VisibleEntities.clear();
+		m_SpatialIndex.Query(frustum, m_VisibleEntities);
+		std::sort(m_VisibleEntities.begin(), m_VisibleEntities.end());
+
+		m_ShadowCasters.clear();
+		m_SpatialIndex.QueryBatch(lightRanges, m_LightQueryResults);
+		for (const auto& results : m_LightQueryResults)
+			m_ShadowCasters.insert(m_ShadowCasters.end(), results.begin(), results.end());
+
+		std::sort(m_ShadowCasters.begin(), m_ShadowCasters.end());
+		m_ShadowCasters.erase(std::unique(m_ShadowCasters.begin(), m_ShadowCasters.end()), m_ShadowCasters.end());
+		m_ShadowCasters.erase(std::remove_if(m_ShadowCasters.begin(), m_ShadowCasters.end(), [this](const entt::entity e)
+		{
+			return std::binary_search(m_VisibleEntities.begin(), m_VisibleEntities.end(), e);
+		}), m_ShadowCasters.end());
+
+		const auto submitMesh = [this, &sceneRenderer](const EntityHandle entity, const bool cameraVisible)
+		{
+			auto [meshC, transform] = m_Registry.get<MeshComponent, TransformComponent>(entity);
+
+			// Meshes evicted since they were indexed are skipped until resident again
+			if (const Ref<Mesh> mesh = AssetManager::GetAssetAsync<Mesh>(meshC.MeshHandle))
+			{
+				Ref<MeshCommand> meshCommand = CreateRef<MeshCommand>();
+				meshCommand->Handle = entity;
+				meshCommand->Mesh = mesh;
+				meshCommand->Transform = GetRenderTransform(entity, transform);
+				meshCommand->CameraVisible = cameraVisible;
+
+				sceneRenderer->SubmitDrawCommand(EntityType::Mesh, meshCommand);
+			}
+		};
+
+		for (const EntityHandle entity : m_VisibleEntities)
+			submitMesh(entity, true);
+
+		for (const EntityHandle entity : m_ShadowCasters)
+			submitMesh(entity, false);
 	}
 }
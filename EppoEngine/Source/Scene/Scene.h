@@ -1,17 +1,20 @@
 #pragma once
 
 #include "Asset/Asset.h"
+#include "Core/FixedTimestep.h"
 #include "Core/UUID.h"
+#include "Physics/PhysicsWorld.h"
 #include "Renderer/Camera/EditorCamera.h"
+#include "Scene/SpatialIndex.h"
+#include "Scene/SystemScheduler.h"
 
 #include <entt/entt.hpp>
 
-class btDiscreteDynamicsWorld;
-
 namespace Eppo
 {
 	class Entity;
 	class SceneRenderer;
+	struct TransformComponent;
 
 	class Scene : public Asset
 	{
@@ -21,6 +24,7 @@ namespace Eppo
 
 		void SetViewportSize(uint32_t width, uint32_t height);
 
+		// Advances the simulation in fixed steps by the time of the frame, whatever is left is blended over when rendering
 		void OnUpdateRuntime(float timestep);
 
 		void OnRenderEditor(const Ref<SceneRenderer>& sceneRenderer, const EditorCamera& editorCamera);
@@ -29,13 +33,14 @@ namespace Eppo
 		void OnRuntimeStart();
 		void OnRuntimeStop();
 
+		// Snapshot of the scene, entities keep their handles so component storages are copied as a whole
 		static Ref<Scene> Copy(const Ref<Scene>& scene);
 
 		template<typename T>
 		static void TryCopyComponent(Entity srcEntity, Entity dstEntity);
 
 		template<typename T>
-		static void CopyComponent(entt::registry& srcRegistry, entt::registry& dstRegistry, const std::unordered_map<UUID, entt::entity>& entityMap);
+		static void CopyStorage(entt::registry& srcRegistry, entt::registry& dstRegistry);
 
 		Entity CreateEntity(const std::string& name = std::string());
 		Entity CreateEntityWithUUID(UUID uuid, const std::string& name);
@@ -43,21 +48,63 @@ namespace Eppo
 		void DestroyEntity(Entity entity);
 
 		Entity FindEntityByUUID(UUID uuid);
+		// Any of the entities with the name when several share it
 		Entity FindEntityByName(std::string_view name);
+		// Every entity with the name, for names used as the tag of a group
+		std::vector<Entity> FindEntitiesByName(std::string_view name);
+		// Names change only through here, so the name lookup stays up to date
+		void SetEntityName(Entity entity, std::string name);
+
+		// Brings the spatial index up to date with the mesh entities, every render does so as well
+		void UpdateSpatialIndex();
+		[[nodiscard]] const SpatialIndex& GetSpatialIndex() const { return m_SpatialIndex; }
+		// Closest mesh entity with bounds hit by the ray, as of the last index update
+		Entity Raycast(const Ray& ray, float maxDistance = std::numeric_limits<float>::max());
+
+		void SetTickRate(const uint32_t tickRate, const uint32_t maxStepsPerFrame) { m_FixedTimestep.SetTickRate(tickRate, maxStepsPerFrame); }
+		// Takes effect when the scene starts running
+		void SetThreadedPhysics(const bool threaded) { m_ThreadedPhysics = threaded; }
+		// Seconds simulated since the scene started running
+		[[nodiscard]] double GetSimulationTime() const { return m_FixedTimestep.GetTime(); }
 
 		[[nodiscard]] bool IsRunning() const { return m_IsRunning; }
 
 	private:
 		void OnPhysicsStart();
 		void OnPhysicsStop();
+		void SyncPhysicsTransforms();
+
+		void RegisterSystems();
+
+		void StoreInterpolationStates();
+		glm::mat4 GetRenderTransform(entt::entity entity, const TransformComponent& transform);
 
-		void RenderScene(const Ref<SceneRenderer>& sceneRenderer);
+		void RenderScene(const Ref<SceneRenderer>& sceneRenderer, const Frustum& frustum);
+
+		void AddToNameIndex(entt::entity entity, std::string_view name);
+		void RemoveFromNameIndex(entt::entity entity, std::string_view name);
+
+		// Takes the entities of a loaded scene in place of its own. The spatial index is emptied and physics
+		// starts over, so nothing refers to the entities that were replaced.
+		void ReplaceEntities(entt::registry&& registry, std::unordered_map<UUID, entt::entity>&& entityMap);
 
 	private:
 		entt::registry m_Registry;
 		std::unordered_map<UUID, entt::entity> m_EntityMap;
-
-		btDiscreteDynamicsWorld* m_PhysicsWorld = nullptr;
+		// Entities by the hash of their name
+		std::unordered_map<uint64_t, std::vector<entt::entity>> m_NameIndex;
+
+		SpatialIndex m_SpatialIndex;
+		// Of the asset manager when the mesh bounds in the index were last checked
+		uint64_t m_SpatialLoadGeneration = 0;
+		std::vector<entt::entity> m_VisibleEntities;
+		std::vector<entt::entity> m_ShadowCasters;
+		std::vector<std::vector<entt::entity>> m_LightQueryResults;
+
+		Scope<PhysicsWorld> m_PhysicsWorld;
+		bool m_ThreadedPhysics = false;
+		SystemScheduler m_SystemScheduler;
+		FixedTimestep m_FixedTimestep;
 
 		bool m_IsRunning = false;
 
@@ -2,6 +2,7 @@
 #include "SceneSerializer.h"
 
 #include "Core/Filesystem.h"
+#include "Platform/MappedFile.h"
 #include "Scripting/ScriptClass.h"
 #include "Scripting/ScriptEngine.h"
 
@@ -95,6 +96,214 @@ namespace YAML
 
 namespace Eppo
 {
+	namespace Utils
+	{
+		enum class SceneTableType : uint32_t
+		{
+			Tag = 1,
+			Transform,
+			Sprite,
+			Mesh,
+			DirectionalLight,
+			Script,
+			ScriptField,
+			RigidBody,
+			Camera,
+			PointLight
+		};
+
+		struct BinarySceneHeader
+		{
+			static constexpr uint32_t MagicValue = 0x4E435345; // "ESCN"
+			static constexpr uint32_t CurrentVersion = 1;
+
+			uint32_t Magic = MagicValue;
+			uint32_t Version = CurrentVersion;
+			uint32_t Name = 0;
+			uint32_t EntityCount = 0;
+			uint32_t TableCount = 0;
+			uint32_t StringCount = 0;
+			uint64_t EntityOffset = 0;
+			uint64_t TableOffset = 0;
+			uint64_t StringOffset = 0;
+			uint64_t CharacterOffset = 0;
+			uint64_t CharacterSize = 0;
+		};
+
+		// One component type, the entity indices and the records are separate columns
+		struct BinarySceneTable
+		{
+			uint32_t Type;
+			uint32_t Count;
+			uint32_t Stride;
+			uint32_t Reserved;
+			uint64_t EntityOffset;
+			uint64_t DataOffset;
+		};
+
+		struct BinarySceneString
+		{
+			uint32_t Offset;
+			uint32_t Size;
+		};
+
+		struct BinaryTag
+		{
+			uint32_t Tag;
+		};
+
+		struct BinaryScript
+		{
+			uint32_t ClassName;
+		};
+
+		struct ScriptFieldData
+		{
+			uint8_t Bytes[16];
+		};
+
+		struct BinaryScriptField
+		{
+			uint32_t Name;
+			uint8_t Type;
+			uint8_t Reserved[3];
+			ScriptFieldData Data;
+		};
+
+		struct BinaryRigidBody
+		{
+			uint8_t Type;
+			uint8_t Reserved[3];
+			float Mass;
+		};
+
+		struct BinaryCamera
+		{
+			uint32_t ProjectionType;
+			float PerspectiveFov;
+			float PerspectiveNearClip;
+			float PerspectiveFarClip;
+			float OrthographicSize;
+			float OrthographicNearClip;
+			float OrthographicFarClip;
+		};
+
+		class BinarySceneWriter
+		{
+		public:
+			BinarySceneWriter()
+				: m_Data(sizeof(BinarySceneHeader))
+			{}
+
+			// Equal strings are stored once
+			uint32_t AddString(const std::string_view text)
+			{
+				const auto [it, inserted] = m_StringIndices.try_emplace(std::string(text), static_cast<uint32_t>(m_Strings.size()));
+				if (inserted)
+				{
+					m_Strings.push_back({ static_cast<uint32_t>(m_Characters.size()), static_cast<uint32_t>(text.size()) });
+					m_Characters.insert(m_Characters.end(), text.begin(), text.end());
+				}
+
+				return it->second;
+			}
+
+			template<typename T>
+			void AddTable(const SceneTableType type, const std::vector<uint32_t>& entities, const std::vector<T>& records)
+			{
+				static_assert(std::is_trivially_copyable_v<T>);
+
+				if (records.empty())
+					return;
+
+				BinarySceneTable table{};
+				table.Type = static_cast<uint32_t>(type);
+				table.Count = static_cast<uint32_t>(records.size());
+				table.Stride = sizeof(T);
+				table.EntityOffset = AddColumn(entities.data(), entities.size() * sizeof(uint32_t));
+				table.DataOffset = AddColumn(records.data(), records.size() * sizeof(T));
+
+				m_Tables.push_back(table);
+			}
+
+			std::vector<uint8_t> Finish(const std::string_view name, const std::vector<uint64_t>& uuids)
+			{
+				BinarySceneHeader header;
+				header.Name = AddString(name);
+				header.EntityCount = static_cast<uint32_t>(uuids.size());
+				header.EntityOffset = AddColumn(uuids.data(), uuids.size() * sizeof(uint64_t));
+				header.TableCount = static_cast<uint32_t>(m_Tables.size());
+				header.TableOffset = AddColumn(m_Tables.data(), m_Tables.size() * sizeof(BinarySceneTable));
+				header.StringCount = static_cast<uint32_t>(m_Strings.size());
+				header.StringOffset = AddColumn(m_Strings.data(), m_Strings.size() * sizeof(BinarySceneString));
+				header.CharacterSize = m_Characters.size();
+				header.CharacterOffset = AddColumn(m_Characters.data(), m_Characters.size());
+
+				std::memcpy(m_Data.data(), &header, sizeof(header));
+
+				return std::move(m_Data);
+			}
+
+		private:
+			// Columns start 16 byte aligned, so records can be used in place
+			uint64_t AddColumn(const void* data, const uint64_t size)
+			{
+				m_Data.resize((m_Data.size() + 15) & ~static_cast<size_t>(15));
+
+				const uint64_t offset = m_Data.size();
+				const auto* bytes = static_cast<const uint8_t*>(data);
+				m_Data.insert(m_Data.end(), bytes, bytes + size);
+
+				return offset;
+			}
+
+		private:
+			std::vector<uint8_t> m_Data;
+			std::vector<BinarySceneTable> m_Tables;
+			std::vector<BinarySceneString> m_Strings;
+			std::vector<char> m_Characters;
+			std::unordered_map<std::string, uint32_t> m_StringIndices;
+		};
+
+		template<typename Component, typename Fn>
+		static void WriteTable(BinarySceneWriter& writer, entt::registry& registry, const std::unordered_map<entt::entity, uint32_t>& indices, const SceneTableType type, Fn toRecord)
+		{
+			using Record = std::invoke_result_t<Fn, const Component&>;
+
+			const auto view = registry.view<Component>();
+
+			std::vector<uint32_t> entities;
+			std::vector<Record> records;
+			entities.reserve(view.size());
+			records.reserve(view.size());
+
+			for (const auto e : view)
+			{
+				const auto it = indices.find(e);
+				if (it == indices.end())
+					continue;
+
+				entities.push_back(it->second);
+				records.push_back(toRecord(view.template get<Component>(e)));
+			}
+
+			writer.AddTable(type, entities, records);
+		}
+
+		// Null when the column does not fit in the data or is misaligned for T
+		template<typename T>
+		static const T* GetColumn(const uint8_t* data, const uint64_t size, const uint64_t offset, const uint64_t count)
+		{
+			if (offset > size || count > (size - offset) / sizeof(T))
+				return nullptr;
+
+			if (reinterpret_cast<uintptr_t>(data + offset) % alignof(T) != 0)
+				return nullptr;
+
+			return reinterpret_cast<const T*>(data + offset);
+		}
+	}
+
 	#define WRITE_SCRIPT_FIELD(FieldType, Type)				\
 		case ScriptFieldType::FieldType:					\
 			out << scriptField.GetValue<Type>();			\
@@ -125,9 +334,15 @@ namespace Eppo
 		out << YAML::Key << "Scene" << YAML::Value << sceneName;
 		out << YAML::Key << "Entities" << YAML::Value << YAML::BeginSeq;
 		
-		m_SceneContext->m_Registry.sort<IDComponent>([](const auto& lhs, const auto& rhs) { return lhs.ID < rhs.ID; });
+		// Sorted by ID for stable diffs, without reordering the registry itself
 		const auto view = m_SceneContext->m_Registry.view<IDComponent>();
-		for (const auto e : view)
+		std::vector<entt::entity> entities(view.begin(), view.end());
+		std::sort(entities.begin(), entities.end(), [&view](const entt::entity lhs, const entt::entity rhs)
+		{
+			return view.get<IDComponent>(lhs).ID < view.get<IDComponent>(rhs).ID;
+		});
+
+		for (const auto e : entities)
 		{
 			const Entity entity(e, m_SceneContext.get());
 			if (!entity)
@@ -143,26 +358,210 @@ namespace Eppo
 		return true;
 	}
 
+	bool SceneSerializer::SerializeBinary(const std::filesystem::path& filepath)
+	{
+		EPPO_PROFILE_FUNCTION("SceneSerializer:SerializeBinary");
+
+		const std::vector<uint8_t> data = SerializeBinaryToMemory(filepath.stem().string());
+
+		std::ofstream stream(filepath, std::ios::binary | std::ios::trunc);
+		stream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+		return stream.good();
+	}
+
+	std::vector<uint8_t> SceneSerializer::SerializeBinaryToMemory(const std::string_view sceneName)
+	{
+		EPPO_PROFILE_FUNCTION("SceneSerializer:SerializeBinaryToMemory");
+		EPPO_INFO("Serializing scene '{}' ({}) to binary", sceneName, m_SceneContext->Handle);
+
+		auto& registry = m_SceneContext->m_Registry;
+		Utils::BinarySceneWriter writer;
+
+		// Entities are written in storage order, loading does not depend on it
+		const auto view = registry.view<IDComponent>();
+
+		std::vector<uint64_t> uuids;
+		std::unordered_map<entt::entity, uint32_t> indices;
+		uuids.reserve(view.size());
+		indices.reserve(view.size());
+
+		for (const auto e : view)
+		{
+			indices.emplace(e, static_cast<uint32_t>(uuids.size()));
+			uuids.push_back(view.get<IDComponent>(e).ID);
+		}
+
+		Utils::WriteTable<TagComponent>(writer, registry, indices, Utils::SceneTableType::Tag, [&writer](const TagComponent& c)
+		{
+			return Utils::BinaryTag{ writer.AddString(c.Tag) };
+		});
+
+		// Plain data components are stored as they are in memory
+		const auto copy = [](const auto& c) { return c; };
+		Utils::WriteTable<TransformComponent>(writer, registry, indices, Utils::SceneTableType::Transform, copy);
+		Utils::WriteTable<SpriteComponent>(writer, registry, indices, Utils::SceneTableType::Sprite, copy);
+		Utils::WriteTable<MeshComponent>(writer, registry, indices, Utils::SceneTableType::Mesh, copy);
+		Utils::WriteTable<DirectionalLightComponent>(writer, registry, indices, Utils::SceneTableType::DirectionalLight, copy);
+		Utils::WriteTable<PointLightComponent>(writer, registry, indices, Utils::SceneTableType::PointLight, copy);
+
+		Utils::WriteTable<ScriptComponent>(writer, registry, indices, Utils::SceneTableType::Script, [&writer](const ScriptComponent& c)
+		{
+			return Utils::BinaryScript{ writer.AddString(c.ClassName) };
+		});
+
+		Utils::WriteTable<RigidBodyComponent>(writer, registry, indices, Utils::SceneTableType::RigidBody, [](const RigidBodyComponent& c)
+		{
+			Utils::BinaryRigidBody record{};
+			record.Type = static_cast<uint8_t>(c.Type);
+			record.Mass = c.Mass;
+
+			return record;
+		});
+
+		Utils::WriteTable<CameraComponent>(writer, registry, indices, Utils::SceneTableType::Camera, [](const CameraComponent& c)
+		{
+			const SceneCamera& camera = c.Camera;
+
+			Utils::BinaryCamera record{};
+			record.ProjectionType = static_cast<uint32_t>(camera.GetProjectionType());
+			record.PerspectiveFov = camera.GetPerspectiveFov();
+			record.PerspectiveNearClip = camera.GetPerspectiveNearClip();
+			record.PerspectiveFarClip = camera.GetPerspectiveFarClip();
+			record.OrthographicSize = camera.GetOrthographicSize();
+			record.OrthographicNearClip = camera.GetOrthographicNearClip();
+			record.OrthographicFarClip = camera.GetOrthographicFarClip();
+
+			return record;
+		});
+
+		// Script fields get their own table, an entity index per field
+		{
+			std::vector<uint32_t> entities;
+			std::vector<Utils::BinaryScriptField> records;
+
+			for (const auto e : registry.view<ScriptComponent>())
+			{
+				const auto& [className] = registry.get<ScriptComponent>(e);
+				const auto entityClass = ScriptEngine::GetEntityClass(className);
+				if (!entityClass)
+					continue;
+
+				const UUID uuid = registry.get<IDComponent>(e).ID;
+				auto& entityFields = ScriptEngine::GetScriptFieldMap(uuid);
+
+				for (const auto& [name, field] : entityClass->GetFields())
+				{
+					const auto it = entityFields.find(name);
+					if (it == entityFields.end())
+						continue;
+
+					Utils::BinaryScriptField record{};
+					record.Name = writer.AddString(name);
+					record.Type = static_cast<uint8_t>(field.Type);
+					record.Data = it->second.GetValue<Utils::ScriptFieldData>();
+
+					entities.push_back(indices.at(e));
+					records.push_back(record);
+				}
+			}
+
+			writer.AddTable(Utils::SceneTableType::ScriptField, entities, records);
+		}
+
+		return writer.Finish(sceneName, uuids);
+	}
+
 	bool SceneSerializer::Deserialize(const std::filesystem::path& filepath) const
 	{
 		EPPO_PROFILE_FUNCTION("SceneSerializer:Deserialize");
 
+		const MappedFile file(filepath);
+		if (!file.IsValid())
+		{
+			EPPO_ERROR("Failed to open scene file '{}'!", filepath.string());
+			return false;
+		}
+
+		if (IsBinary(file.GetData(), file.GetSize()))
+			return DeserializeBinary(file.GetData(), file.GetSize(), filepath.string());
+
+		YAML::Node data;
+
+		try
+		{
+			data = YAML::Load(std::string(reinterpret_cast<const char*>(file.GetData()), file.GetSize()));
+		}
+		catch (YAML::ParserException& e)
+		{
+			EPPO_ERROR("Failed to load scene file '{}'!", filepath.string());
+			EPPO_ERROR("YAML Error: {}", e.what());
+			return false;
+		}
+
+		return DeserializeNode(data, filepath.string());
+	}
+
+	bool SceneSerializer::DeserializeFromMemory(const std::string_view source) const
+	{
+		EPPO_PROFILE_FUNCTION("SceneSerializer:DeserializeFromMemory");
+
+		if (IsBinary(source.data(), source.size()))
+			return DeserializeBinary(reinterpret_cast<const uint8_t*>(source.data()), source.size(), "memory");
+
 		YAML::Node data;
 
 		try
 		{
-			data = YAML::LoadFile(filepath.string());
+			data = YAML::Load(std::string(source));
 		}
 		catch (YAML::ParserException& e)
 		{
-			EPPO_ERROR("Failed to load scene file '{}'!", filepath);
+			EPPO_ERROR("Failed to load scene from memory!");
 			EPPO_ERROR("YAML Error: {}", e.what());
 			return false;
 		}
 
+		return DeserializeNode(data, "memory");
+	}
+
+	bool SceneSerializer::IsBinary(const void* data, const uint64_t size)
+	{
+		uint32_t magic = 0;
+		if (size < sizeof(magic))
+			return false;
+
+		std::memcpy(&magic, data, sizeof(magic));
+		return magic == Utils::BinarySceneHeader::MagicValue;
+	}
+
+	bool SceneSerializer::ConvertToBinary(const std::filesystem::path& source, const std::filesystem::path& destination)
+	{
+		EPPO_PROFILE_FUNCTION("SceneSerializer:ConvertToBinary");
+
+		SceneSerializer serializer(CreateRef<Scene>());
+		if (!serializer.Deserialize(source))
+			return false;
+
+		return serializer.SerializeBinary(destination);
+	}
+
+	bool SceneSerializer::ConvertToYAML(const std::filesystem::path& source, const std::filesystem::path& destination)
+	{
+		EPPO_PROFILE_FUNCTION("SceneSerializer:ConvertToYAML");
+
+		SceneSerializer serializer(CreateRef<Scene>());
+		if (!serializer.Deserialize(source))
+			return false;
+
+		return serializer.Serialize(destination);
+	}
+
+	bool SceneSerializer::DeserializeNode(const YAML::Node& data, const std::string& name) const
+	{
 		if (!data["Scene"])
 		{
-			EPPO_ERROR("Failed to load scene file '{}'! Not a scene file!", filepath);
+			EPPO_ERROR("Failed to load scene file '{}'! Not a scene file!", name);
 			return false;
 		}
 
@@ -172,10 +571,10 @@ namespace Eppo
 		auto entities = data["Entities"];
 
 		if (!entities)
-		{
 			EPPO_WARN("Scene '{}' has no entities, are you sure this is correct?", sceneName);
-			return true;
-		}
+
+		// Loaded on the side like binary scenes, so both formats replace the entities of the scene
+		const Ref<Scene> loaded = CreateRef<Scene>();
 
 		for (auto entity : entities)
 		{
@@ -185,8 +584,8 @@ namespace Eppo
 			if (auto tagComponent = entity["TagComponent"]; tagComponent)
 				tag = tagComponent["Tag"].as<std::string>();
 
-			Entity newEntity = m_SceneContext->CreateEntityWithUUID(uuid, tag);
-			EPPO_INFO("Deserializing entity '{}' ({})", tag, uuid);
+			Entity newEntity = loaded->CreateEntityWithUUID(uuid, tag);
+			EPPO_TRACE("Deserializing entity '{}' ({})", tag, uuid);
 
 			if (auto c = entity["TransformComponent"])
 			{
@@ -295,6 +694,280 @@ namespace Eppo
 			}
 		}
 
+		m_SceneContext->ReplaceEntities(std::move(loaded->m_Registry), std::move(loaded->m_EntityMap));
+
+		return true;
+	}
+
+	bool SceneSerializer::DeserializeBinary(const uint8_t* data, const uint64_t size, const std::string& name) const
+	{
+		EPPO_PROFILE_FUNCTION("SceneSerializer:DeserializeBinary");
+
+		const auto* header = Utils::GetColumn<Utils::BinarySceneHeader>(data, size, 0, 1);
+		if (!header || header->Magic != Utils::BinarySceneHeader::MagicValue)
+		{
+			EPPO_ERROR("Failed to load scene file '{}'! Not a binary scene file!", name);
+			return false;
+		}
+
+		if (header->Version != Utils::BinarySceneHeader::CurrentVersion)
+		{
+			EPPO_ERROR("Failed to load scene file '{}'! Binary version {} is not supported, convert it from YAML again", name, header->Version);
+			return false;
+		}
+
+		const auto* uuids = Utils::GetColumn<uint64_t>(data, size, header->EntityOffset, header->EntityCount);
+		const auto* tables = Utils::GetColumn<Utils::BinarySceneTable>(data, size, header->TableOffset, header->TableCount);
+		const auto* strings = Utils::GetColumn<Utils::BinarySceneString>(data, size, header->StringOffset, header->StringCount);
+		const auto* characters = Utils::GetColumn<char>(data, size, header->CharacterOffset, header->CharacterSize);
+		if (!uuids || !tables || !strings || !characters)
+		{
+			EPPO_ERROR("Failed to load scene file '{}'! The file is truncated", name);
+			return false;
+		}
+
+		const auto getString = [&](const uint32_t index)
+		{
+			if (index >= header->StringCount || strings[index].Offset > header->CharacterSize || strings[index].Size > header->CharacterSize - strings[index].Offset)
+				return std::string_view();
+
+			return std::string_view(characters + strings[index].Offset, strings[index].Size);
+		};
+
+		EPPO_INFO("Deserializing scene '{}'", getString(header->Name));
+
+		// Loaded on the side and replaces the entities of the scene once the whole file is read, a corrupt file leaves the scene untouched
+		entt::registry registry;
+		std::unordered_map<UUID, entt::entity> entityMap;
+
+		// All entities and their IDs at once, components follow table by table
+		std::vector<entt::entity> entities(header->EntityCount);
+		registry.create(entities.begin(), entities.end());
+
+		{
+			std::vector<IDComponent> ids;
+			ids.reserve(header->EntityCount);
+
+			entityMap.reserve(header->EntityCount);
+			for (uint32_t i = 0; i < header->EntityCount; i++)
+			{
+				ids.emplace_back(uuids[i]);
+				entityMap[uuids[i]] = entities[i];
+			}
+
+			registry.insert<IDComponent>(entities.begin(), entities.end(), ids.begin());
+		}
+
+		struct PendingScriptField
+		{
+			UUID EntityID;
+			std::string Name;
+			ScriptField Field;
+			const Utils::ScriptFieldData* Data;
+		};
+
+		// Script fields live in the script engine, they are only set after the scene loaded
+		std::vector<PendingScriptField> scriptFields;
+
+		std::vector<entt::entity> tableEntities;
+		std::vector<bool> seen(header->EntityCount);
+
+		for (uint32_t t = 0; t < header->TableCount; t++)
+		{
+			const Utils::BinarySceneTable& table = tables[t];
+			const auto type = static_cast<Utils::SceneTableType>(table.Type);
+
+			const auto* indices = Utils::GetColumn<uint32_t>(data, size, table.EntityOffset, table.Count);
+			const auto* records = Utils::GetColumn<uint8_t>(data, size, table.DataOffset, static_cast<uint64_t>(table.Count) * table.Stride);
+			if (!indices || !records)
+			{
+				EPPO_ERROR("Failed to load scene file '{}'! The file is truncated", name);
+				return false;
+			}
+
+			// Only script fields list an entity more than once, any other component can be added once per entity
+			const bool unique = type != Utils::SceneTableType::ScriptField;
+			std::fill(seen.begin(), seen.end(), false);
+
+			tableEntities.resize(table.Count);
+			for (uint32_t i = 0; i < table.Count; i++)
+			{
+				if (indices[i] >= header->EntityCount)
+				{
+					EPPO_ERROR("Failed to load scene file '{}'! Component table {} refers to a missing entity", name, table.Type);
+					return false;
+				}
+
+				if (unique && seen[indices[i]])
+				{
+					EPPO_ERROR("Failed to load scene file '{}'! Component table {} lists entity {} more than once", name, table.Type, indices[i]);
+					return false;
+				}
+
+				seen[indices[i]] = true;
+				tableEntities[i] = entities[indices[i]];
+			}
+
+			// Components stored as they are in memory are inserted straight from the file
+			const auto insertTable = [&](auto* component)
+			{
+				using Component = std::remove_pointer_t<decltype(component)>;
+				const auto* begin = reinterpret_cast<const Component*>(records);
+				if (table.Stride != sizeof(Component) || reinterpret_cast<uintptr_t>(begin) % alignof(Component) != 0)
+					return false;
+
+				registry.insert<Component>(tableEntities.begin(), tableEntities.end(), begin);
+				return true;
+			};
+
+			// Others are converted from their records first
+			const auto convertTable = [&](auto* record, auto toComponent)
+			{
+				using Record = std::remove_pointer_t<decltype(record)>;
+				using Component = std::invoke_result_t<decltype(toComponent), const Record&>;
+				if (table.Stride != sizeof(Record))
+					return false;
+
+				const auto* begin = reinterpret_cast<const Record*>(records);
+
+				std::vector<Component> components;
+				components.reserve(table.Count);
+				for (uint32_t i = 0; i < table.Count; i++)
+					components.emplace_back(toComponent(begin[i]));
+
+				registry.insert<Component>(tableEntities.begin(), tableEntities.end(), components.begin());
+				return true;
+			};
+
+			bool loaded = true;
+
+			switch (type)
+			{
+				case Utils::SceneTableType::Tag:
+				{
+					loaded = convertTable(static_cast<Utils::BinaryTag*>(nullptr), [&](const Utils::BinaryTag& record)
+					{
+						return TagComponent(std::string(getString(record.Tag)));
+					});
+					break;
+				}
+
+				case Utils::SceneTableType::Transform:			loaded = insertTable(static_cast<TransformComponent*>(nullptr)); break;
+				case Utils::SceneTableType::Sprite:				loaded = insertTable(static_cast<SpriteComponent*>(nullptr)); break;
+				case Utils::SceneTableType::Mesh:				loaded = insertTable(static_cast<MeshComponent*>(nullptr)); break;
+				case Utils::SceneTableType::DirectionalLight:	loaded = insertTable(static_cast<DirectionalLightComponent*>(nullptr)); break;
+				case Utils::SceneTableType::PointLight:			loaded = insertTable(static_cast<PointLightComponent*>(nullptr)); break;
+
+				case Utils::SceneTableType::Script:
+				{
+					loaded = convertTable(static_cast<Utils::BinaryScript*>(nullptr), [&](const Utils::BinaryScript& record)
+					{
+						ScriptComponent component;
+						component.ClassName = getString(record.ClassName);
+
+						return component;
+					});
+					break;
+				}
+
+				case Utils::SceneTableType::ScriptField:
+				{
+					if (table.Stride != sizeof(Utils::BinaryScriptField))
+					{
+						loaded = false;
+						break;
+					}
+
+					const auto* fields = reinterpret_cast<const Utils::BinaryScriptField*>(records);
+					for (uint32_t i = 0; i < table.Count; i++)
+					{
+						const auto* script = registry.try_get<ScriptComponent>(tableEntities[i]);
+						if (!script)
+							continue;
+
+						const Ref<ScriptClass> entityClass = ScriptEngine::GetEntityClass(script->ClassName);
+						if (!entityClass)
+						{
+							EPPO_ERROR("Script class '{}' not found!", script->ClassName);
+							continue;
+						}
+
+						const std::string fieldName(getString(fields[i].Name));
+						const auto& classFields = entityClass->GetFields();
+						if (classFields.find(fieldName) == classFields.end())
+						{
+							EPPO_ERROR("Mono field not found!");
+							continue;
+						}
+
+						scriptFields.push_back({ uuids[indices[i]], fieldName, classFields.at(fieldName), &fields[i].Data });
+					}
+					break;
+				}
+
+				case Utils::SceneTableType::RigidBody:
+				{
+					loaded = convertTable(static_cast<Utils::BinaryRigidBody*>(nullptr), [](const Utils::BinaryRigidBody& record)
+					{
+						RigidBodyComponent component;
+						component.Type = static_cast<RigidBodyComponent::BodyType>(record.Type);
+						component.Mass = record.Mass;
+
+						return component;
+					});
+					break;
+				}
+
+				case Utils::SceneTableType::Camera:
+				{
+					loaded = convertTable(static_cast<Utils::BinaryCamera*>(nullptr), [](const Utils::BinaryCamera& record)
+					{
+						CameraComponent component;
+						component.Camera.SetProjectionType(static_cast<ProjectionType>(record.ProjectionType));
+						component.Camera.SetPerspectiveFov(record.PerspectiveFov);
+						component.Camera.SetPerspectiveNearClip(record.PerspectiveNearClip);
+						component.Camera.SetPerspectiveFarClip(record.PerspectiveFarClip);
+						component.Camera.SetOrthographicSize(record.OrthographicSize);
+						component.Camera.SetOrthographicNearClip(record.OrthographicNearClip);
+						component.Camera.SetOrthographicFarClip(record.OrthographicFarClip);
+
+						return component;
+					});
+					break;
+				}
+
+				default:
+				{
+					EPPO_WARN("Scene file '{}' has an unknown component table {}, it is skipped", name, table.Type);
+					break;
+				}
+			}
+
+			if (!loaded)
+			{
+				EPPO_ERROR("Failed to load scene file '{}'! Component table {} has an unexpected layout", name, table.Type);
+				return false;
+			}
+		}
+
+		// Every entity has a tag and a transform, as if created through the scene
+		for (const entt::entity entity : entities)
+		{
+			if (!registry.all_of<TransformComponent>(entity))
+				registry.emplace<TransformComponent>(entity);
+			if (!registry.all_of<TagComponent>(entity))
+				registry.emplace<TagComponent>(entity, "Entity");
+		}
+
+		m_SceneContext->ReplaceEntities(std::move(registry), std::move(entityMap));
+
+		for (const auto& [entityID, fieldName, field, fieldData] : scriptFields)
+		{
+			ScriptFieldInstance& fieldInstance = ScriptEngine::GetScriptFieldMap(entityID)[fieldName];
+			fieldInstance.Field = field;
+			fieldInstance.SetValue(*fieldData);
+		}
+
 		return true;
 	}
 
@@ -302,7 +975,7 @@ namespace Eppo
 	{
 		EPPO_ASSERT(entity.HasComponent<IDComponent>() && entity.HasComponent<TagComponent>());
 
-		EPPO_INFO("Serializing entity '{}' ({})", entity.GetName(), entity.GetUUID());
+		EPPO_TRACE("Serializing entity '{}' ({})", entity.GetName(), entity.GetUUID());
 
 		out << YAML::BeginMap;
 
@@ -6,6 +6,7 @@
 namespace YAML
 {
 	class Emitter;
+	class Node;
 }
 
 namespace Eppo
@@ -15,11 +16,27 @@ namespace Eppo
 	public:
 		explicit SceneSerializer(const Ref<Scene>& scene);
 
+		// YAML, the diffable interchange format
 		bool Serialize(const std::filesystem::path& filepath);
+		// Versioned binary format, component tables stored column-wise
+		bool SerializeBinary(const std::filesystem::path& filepath);
+		[[nodiscard]] std::vector<uint8_t> SerializeBinaryToMemory(std::string_view sceneName);
+
+		// Either format, told apart by the contents
 		[[nodiscard]] bool Deserialize(const std::filesystem::path& filepath) const;
+		// Scene file contents, as stored in asset packs
+		[[nodiscard]] bool DeserializeFromMemory(std::string_view source) const;
+
+		static bool IsBinary(const void* data, uint64_t size);
+
+		// Converters between the formats, the destination is overwritten
+		static bool ConvertToBinary(const std::filesystem::path& source, const std::filesystem::path& destination);
+		static bool ConvertToYAML(const std::filesystem::path& source, const std::filesystem::path& destination);
 
 	private:
 		void SerializeEntity(YAML::Emitter& out, Entity entity);
+		[[nodiscard]] bool DeserializeNode(const YAML::Node& data, const std::string& name) const;
+		[[nodiscard]] bool DeserializeBinary(const uint8_t* data, uint64_t size, const std::string& name) const;
 
 	private:
 		Ref<Scene> m_SceneContext;
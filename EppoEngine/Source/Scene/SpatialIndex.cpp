@@ -0,0 +1,538 @@
+#include "pch.h"
+#include "SpatialIndex.h"
+
+namespace Eppo
+{
+	SpatialProxy SpatialIndex::Insert(const entt::entity entity, const AABB& bounds)
+	{
+		EPPO_PROFILE_FUNCTION("SpatialIndex::Insert");
+
+		const int32_t leaf = AllocateNode();
+		Node& node = m_Nodes[leaf];
+		node.Box = Grow(bounds);
+		node.Bounds = bounds;
+		node.Entity = entity;
+
+		InsertLeaf(leaf);
+		m_ProxyCount++;
+
+		return leaf;
+	}
+
+	void SpatialIndex::Remove(const SpatialProxy proxy)
+	{
+		EPPO_PROFILE_FUNCTION("SpatialIndex::Remove");
+
+		EPPO_ASSERT(proxy >= 0 && proxy < static_cast<int32_t>(m_Nodes.size()) && m_Nodes[proxy].IsLeaf())
+
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+		m_ProxyCount--;
+	}
+
+	bool SpatialIndex::Update(const SpatialProxy proxy, const AABB& bounds)
+	{
+		EPPO_PROFILE_FUNCTION("SpatialIndex::Update");
+
+		EPPO_ASSERT(proxy >= 0 && proxy < static_cast<int32_t>(m_Nodes.size()) && m_Nodes[proxy].IsLeaf())
+
+		Node& node = m_Nodes[proxy];
+		node.Bounds = bounds;
+
+		// Still inside the grown box, unless that became far too large for bounds that shrank
+		const AABB grown = Grow(bounds);
+		if (node.Box.Contains(bounds) && node.Box.GetArea() <= grown.GetArea() * 4.0f)
+			return false;
+
+		RemoveLeaf(proxy);
+		m_Nodes[proxy].Box = grown;
+		InsertLeaf(proxy);
+
+		return true;
+	}
+
+	void SpatialIndex::Build(const std::vector<entt::entity>& entities, const std::vector<AABB>& bounds, std::vector<SpatialProxy>& proxies)
+	{
+		EPPO_PROFILE_FUNCTION("SpatialIndex::Build");
+
+		EPPO_ASSERT(entities.size() == bounds.size())
+
+		Clear();
+
+		const auto count = static_cast<int32_t>(entities.size());
+		proxies.resize(count);
+		if (count == 0)
+			return;
+
+		// A binary tree over n leaves has n - 1 internal nodes
+		m_Nodes.reserve(2 * static_cast<size_t>(count) - 1);
+
+		for (int32_t i = 0; i < count; i++)
+		{
+			const int32_t leaf = AllocateNode();
+			Node& node = m_Nodes[leaf];
+			node.Box = Grow(bounds[i]);
+			node.Bounds = bounds[i];
+			node.Entity = entities[i];
+
+			proxies[i] = leaf;
+		}
+
+		std::vector<BuildLeaf> leaves(count);
+		for (int32_t i = 0; i < count; i++)
+			leaves[i] = { m_Nodes[proxies[i]].Box.GetCenter(), proxies[i] };
+
+		m_Root = BuildRange(leaves.data(), count);
+		m_Nodes[m_Root].Parent = NullNode;
+		m_ProxyCount = count;
+	}
+
+	void SpatialIndex::Clear()
+	{
+		m_Nodes.clear();
+		m_Root = NullNode;
+		m_FreeList = NullNode;
+		m_ProxyCount = 0;
+	}
+
+	void SpatialIndex::Query(const AABB& box, std::vector<entt::entity>& results) const
+	{
+		EPPO_PROFILE_FUNCTION("SpatialIndex::Query");
+
+		QueryTree([&box](const AABB& nodeBox)
+		{
+			if (!box.Overlaps(nodeBox))
+				return Containment::Outside;
+
+			return box.Contains(nodeBox) ? Containment::Inside : Containment::Intersects;
+		}, results);
+	}
+
+	void SpatialIndex::Query(const Sphere& sphere, std::vector<entt::entity>& results) const
+	{
+		EPPO_PROFILE_FUNCTION("SpatialIndex::Query");
+
+		QueryTree([&sphere](const AABB& nodeBox)
+		{
+			return sphere.Overlaps(nodeBox) ? Containment::Intersects : Containment::Outside;
+		}, results);
+	}
+
+	void SpatialIndex::Query(const Frustum& frustum, std::vector<entt::entity>& results) const
+	{
+		EPPO_PROFILE_FUNCTION("SpatialIndex::Query");
+
+		QueryTree([&frustum](const AABB& nodeBox)
+		{
+			return frustum.Classify(nodeBox);
+		}, results);
+	}
+
+	void SpatialIndex::Raycast(const Ray& ray, const float maxDistance, std::vector<RaycastHit>& hits) const
+	{
+		EPPO_PROFILE_FUNCTION("SpatialIndex::Raycast");
+
+		if (m_Root == NullNode)
+			return;
+
+		const size_t firstHit = hits.size();
+
+		std::vector<int32_t> stack;
+		stack.reserve(64);
+		stack.push_back(m_Root);
+
+		while (!stack.empty())
+		{
+			const Node& node = m_Nodes[stack.back()];
+			stack.pop_back();
+
+			float distance;
+			if (!ray.Intersects(node.Box, maxDistance, distance))
+				continue;
+
+			if (node.IsLeaf())
+			{
+				if (ray.Intersects(node.Bounds, maxDistance, distance))
+					hits.push_back({ node.Entity, distance });
+
+				continue;
+			}
+
+			stack.push_back(node.Child1);
+			stack.push_back(node.Child2);
+		}
+
+		std::sort(hits.begin() + static_cast<std::ptrdiff_t>(firstHit), hits.end(), [](const RaycastHit& a, const RaycastHit& b)
+		{
+			return a.Distance < b.Distance;
+		});
+	}
+
+	uint32_t SpatialIndex::GetHeight() const
+	{
+		return m_Root == NullNode ? 0 : static_cast<uint32_t>(m_Nodes[m_Root].Height);
+	}
+
+	float SpatialIndex::GetAreaRatio() const
+	{
+		if (m_Root == NullNode)
+			return 0.0f;
+
+		const float rootArea = m_Nodes[m_Root].Box.GetArea();
+		if (rootArea <= 0.0f)
+			return 0.0f;
+
+		float totalArea = 0.0f;
+		for (const auto& node : m_Nodes)
+		{
+			if (node.Height > 0)
+				totalArea += node.Box.GetArea();
+		}
+
+		return totalArea / rootArea;
+	}
+
+	bool SpatialIndex::Validate() const
+	{
+		if (m_Root == NullNode)
+			return m_ProxyCount == 0;
+
+		if (m_Nodes[m_Root].Parent != NullNode)
+			return false;
+
+		uint32_t leafCount = 0;
+
+		std::vector<int32_t> stack = { m_Root };
+		while (!stack.empty())
+		{
+			const int32_t index = stack.back();
+			stack.pop_back();
+
+			const Node& node = m_Nodes[index];
+			if (node.IsLeaf())
+			{
+				if (node.Height != 0 || node.Child2 != NullNode || !node.Box.Contains(node.Bounds))
+					return false;
+
+				leafCount++;
+				continue;
+			}
+
+			const Node& child1 = m_Nodes[node.Child1];
+			const Node& child2 = m_Nodes[node.Child2];
+
+			if (child1.Parent != index || child2.Parent != index)
+				return false;
+			if (node.Height != 1 + std::max(child1.Height, child2.Height))
+				return false;
+			if (!node.Box.Contains(child1.Box) || !node.Box.Contains(child2.Box))
+				return false;
+
+			stack.push_back(node.Child1);
+			stack.push_back(node.Child2);
+		}
+
+		return leafCount == m_ProxyCount;
+	}
+
+	int32_t SpatialIndex::AllocateNode()
+	{
+		if (m_FreeList == NullNode)
+		{
+			m_Nodes.emplace_back();
+			return static_cast<int32_t>(m_Nodes.size()) - 1;
+		}
+
+		const int32_t index = m_FreeList;
+		m_FreeList = m_Nodes[index].Parent;
+		m_Nodes[index] = Node();
+
+		return index;
+	}
+
+	void SpatialIndex::FreeNode(const int32_t index)
+	{
+		Node& node = m_Nodes[index];
+		node.Parent = m_FreeList;
+		node.Child1 = NullNode;
+		node.Child2 = NullNode;
+		node.Height = -1;
+		node.Entity = entt::null;
+
+		m_FreeList = index;
+	}
+
+	void SpatialIndex::InsertLeaf(const int32_t leaf)
+	{
+		if (m_Root == NullNode)
+		{
+			m_Root = leaf;
+			m_Nodes[leaf].Parent = NullNode;
+			return;
+		}
+
+		// Walk down towards the sibling for which the new parent and the growth of its ancestors cost the least area
+		const AABB leafBox = m_Nodes[leaf].Box;
+		int32_t index = m_Root;
+
+		while (!m_Nodes[index].IsLeaf())
+		{
+			const Node& node = m_Nodes[index];
+
+			const float area = node.Box.GetArea();
+			const float combinedArea = AABB::Union(node.Box, leafBox).GetArea();
+
+			// Making a new parent of this node and the leaf
+			const float cost = 2.0f * combinedArea;
+			// Paid by every node below this one for growing it
+			const float inheritanceCost = 2.0f * (combinedArea - area);
+
+			const auto descendCost = [&](const Node& child)
+			{
+				const float childCombinedArea = AABB::Union(child.Box, leafBox).GetArea();
+				return (child.IsLeaf() ? childCombinedArea : childCombinedArea - child.Box.GetArea()) + inheritanceCost;
+			};
+
+			const float cost1 = descendCost(m_Nodes[node.Child1]);
+			const float cost2 = descendCost(m_Nodes[node.Child2]);
+
+			if (cost < cost1 && cost < cost2)
+				break;
+
+			index = cost1 < cost2 ? node.Child1 : node.Child2;
+		}
+
+		const int32_t sibling = index;
+		const int32_t oldParent = m_Nodes[sibling].Parent;
+
+		const int32_t newParent = AllocateNode();
+		Node& parent = m_Nodes[newParent];
+		parent.Parent = oldParent;
+		parent.Box = AABB::Union(leafBox, m_Nodes[sibling].Box);
+		parent.Height = m_Nodes[sibling].Height + 1;
+		parent.Child1 = sibling;
+		parent.Child2 = leaf;
+
+		m_Nodes[sibling].Parent = newParent;
+		m_Nodes[leaf].Parent = newParent;
+
+		if (oldParent == NullNode)
+			m_Root = newParent;
+		else if (m_Nodes[oldParent].Child1 == sibling)
+			m_Nodes[oldParent].Child1 = newParent;
+		else
+			m_Nodes[oldParent].Child2 = newParent;
+
+		Refit(oldParent);
+	}
+
+	void SpatialIndex::RemoveLeaf(const int32_t leaf)
+	{
+		if (leaf == m_Root)
+		{
+			m_Root = NullNode;
+			return;
+		}
+
+		// The sibling takes the place of the parent
+		const int32_t parent = m_Nodes[leaf].Parent;
+		const int32_t grandParent = m_Nodes[parent].Parent;
+		const int32_t sibling = m_Nodes[parent].Child1 == leaf ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+
+		m_Nodes[sibling].Parent = grandParent;
+		FreeNode(parent);
+
+		if (grandParent == NullNode)
+		{
+			m_Root = sibling;
+			return;
+		}
+
+		if (m_Nodes[grandParent].Child1 == parent)
+			m_Nodes[grandParent].Child1 = sibling;
+		else
+			m_Nodes[grandParent].Child2 = sibling;
+
+		Refit(grandParent);
+	}
+
+	void SpatialIndex::Refit(int32_t index)
+	{
+		while (index != NullNode)
+		{
+			index = Balance(index);
+
+			Node& node = m_Nodes[index];
+			const Node& child1 = m_Nodes[node.Child1];
+			const Node& child2 = m_Nodes[node.Child2];
+
+			node.Height = 1 + std::max(child1.Height, child2.Height);
+			node.Box = AABB::Union(child1.Box, child2.Box);
+
+			index = node.Parent;
+		}
+	}
+
+	int32_t SpatialIndex::Balance(const int32_t iA)
+	{
+		Node& a = m_Nodes[iA];
+		if (a.IsLeaf() || a.Height < 2)
+			return iA;
+
+		const int32_t iB = a.Child1;
+		const int32_t iC = a.Child2;
+		Node& b = m_Nodes[iB];
+		Node& c = m_Nodes[iC];
+
+		const int32_t balance = c.Height - b.Height;
+
+		// Rotate the taller child up into the place of A, its taller child stays with it and the other one moves to A
+		const auto rotate = [&](const int32_t iUp, Node& up, const Node& other, const bool upIsChild2)
+		{
+			const int32_t iF = up.Child1;
+			const int32_t iG = up.Child2;
+			Node& f = m_Nodes[iF];
+			Node& g = m_Nodes[iG];
+
+			up.Child1 = iA;
+			up.Parent = a.Parent;
+			a.Parent = iUp;
+
+			if (up.Parent == NullNode)
+				m_Root = iUp;
+			else if (m_Nodes[up.Parent].Child1 == iA)
+				m_Nodes[up.Parent].Child1 = iUp;
+			else
+				m_Nodes[up.Parent].Child2 = iUp;
+
+			const bool keepF = f.Height > g.Height;
+			const int32_t iKeep = keepF ? iF : iG;
+			const int32_t iMove = keepF ? iG : iF;
+			Node& keep = m_Nodes[iKeep];
+			Node& move = m_Nodes[iMove];
+
+			up.Child2 = iKeep;
+			if (upIsChild2)
+				a.Child2 = iMove;
+			else
+				a.Child1 = iMove;
+			move.Parent = iA;
+
+			a.Box = AABB::Union(other.Box, move.Box);
+			a.Height = 1 + std::max(other.Height, move.Height);
+			up.Box = AABB::Union(a.Box, keep.Box);
+			up.Height = 1 + std::max(a.Height, keep.Height);
+		};
+
+		if (balance > 1)
+		{
+			rotate(iC, c, b, true);
+			return iC;
+		}
+
+		if (balance < -1)
+		{
+			rotate(iB, b, c, false);
+			return iB;
+		}
+
+		return iA;
+	}
+
+	int32_t SpatialIndex::BuildRange(BuildLeaf* leaves, const int32_t count)
+	{
+		if (count == 1)
+			return leaves[0].Node;
+
+		// Median split along the axis the centers spread the most
+		AABB centers;
+		for (int32_t i = 0; i < count; i++)
+		{
+			centers.Min = glm::min(centers.Min, leaves[i].Center);
+			centers.Max = glm::max(centers.Max, leaves[i].Center);
+		}
+
+		const glm::vec3 spread = centers.Max - centers.Min;
+		const int axis = spread.x > spread.y && spread.x > spread.z ? 0 : (spread.y > spread.z ? 1 : 2);
+
+		const int32_t half = count / 2;
+		std::nth_element(leaves, leaves + half, leaves + count, [axis](const BuildLeaf& a, const BuildLeaf& b)
+		{
+			return a.Center[axis] < b.Center[axis];
+		});
+
+		const int32_t child1 = BuildRange(leaves, half);
+		const int32_t child2 = BuildRange(leaves + half, count - half);
+
+		const int32_t index = AllocateNode();
+		Node& node = m_Nodes[index];
+		node.Child1 = child1;
+		node.Child2 = child2;
+		node.Box = AABB::Union(m_Nodes[child1].Box, m_Nodes[child2].Box);
+		node.Height = 1 + std::max(m_Nodes[child1].Height, m_Nodes[child2].Height);
+
+		m_Nodes[child1].Parent = index;
+		m_Nodes[child2].Parent = index;
+
+		return index;
+	}
+
+	template<typename Classify>
+	void SpatialIndex::QueryTree(const Classify& classify, std::vector<entt::entity>& results) const
+	{
+		if (m_Root == NullNode)
+			return;
+
+		std::vector<int32_t> stack;
+		stack.reserve(64);
+		stack.push_back(m_Root);
+
+		while (!stack.empty())
+		{
+			const int32_t index = stack.back();
+			stack.pop_back();
+
+			const Node& node = m_Nodes[index];
+			if (node.IsLeaf())
+			{
+				if (classify(node.Bounds) != Containment::Outside)
+					results.push_back(node.Entity);
+
+				continue;
+			}
+
+			const Containment containment = classify(node.Box);
+			if (containment == Containment::Outside)
+				continue;
+
+			// Everything below is inside as well, no more tests needed
+			if (containment == Containment::Inside)
+			{
+				CollectLeaves(index, results);
+				continue;
+			}
+
+			stack.push_back(node.Child1);
+			stack.push_back(node.Child2);
+		}
+	}
+
+	void SpatialIndex::CollectLeaves(const int32_t index, std::vector<entt::entity>& results) const
+	{
+		const Node& node = m_Nodes[index];
+		if (node.IsLeaf())
+		{
+			results.push_back(node.Entity);
+			return;
+		}
+
+		CollectLeaves(node.Child1, results);
+		CollectLeaves(node.Child2, results);
+	}
+
+	AABB SpatialIndex::Grow(const AABB& bounds)
+	{
+		const glm::vec3 margin = glm::vec3(AbsoluteMargin) + (bounds.Max - bounds.Min) * RelativeMargin;
+		return { bounds.Min - margin, bounds.Max + margin };
+	}
+}
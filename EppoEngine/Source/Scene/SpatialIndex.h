@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Core/Geometry.h"
+#include "Core/ThreadPool.h"
+
+#include <entt/entt.hpp>
+
+namespace Eppo
+{
+	using SpatialProxy = int32_t;
+	constexpr SpatialProxy NullSpatialProxy = -1;
+
+	struct RaycastHit
+	{
+		entt::entity Entity = entt::null;
+		float Distance = 0.0f;
+	};
+
+	// Dynamic AABB tree over entity bounds. Leaves keep their bounds grown by a margin, so small movements
+	// do not touch the tree. Inserts pick the sibling of least surface area cost, and every change refits
+	// the ancestors and rotates unbalanced nodes on the way up.
+	class SpatialIndex
+	{
+	public:
+		SpatialProxy Insert(entt::entity entity, const AABB& bounds);
+		void Remove(SpatialProxy proxy);
+		// Returns true when the bounds left the grown bounds of the leaf and it was reinserted
+		bool Update(SpatialProxy proxy, const AABB& bounds);
+
+		// Replaces the contents by a tree built top down, much faster than inserting one by one.
+		// The proxies are returned in the order of the entities.
+		void Build(const std::vector<entt::entity>& entities, const std::vector<AABB>& bounds, std::vector<SpatialProxy>& proxies);
+		void Clear();
+
+		// Results are appended, in no particular order
+		void Query(const AABB& box, std::vector<entt::entity>& results) const;
+		void Query(const Sphere& sphere, std::vector<entt::entity>& results) const;
+		void Query(const Frustum& frustum, std::vector<entt::entity>& results) const;
+		// Hits against the bounds, closest first
+		void Raycast(const Ray& ray, float maxDistance, std::vector<RaycastHit>& hits) const;
+
+		// One result list per shape, the queries run on the thread pool
+		template<typename Shape>
+		void QueryBatch(const std::vector<Shape>& shapes, std::vector<std::vector<entt::entity>>& results, ThreadPool& threadPool = ThreadPool::Get()) const
+		{
+			results.resize(shapes.size());
+			threadPool.ParallelFor(static_cast<uint32_t>(shapes.size()), [&](const uint32_t index)
+			{
+				results[index].clear();
+				Query(shapes[index], results[index]);
+			});
+		}
+
+		[[nodiscard]] entt::entity GetEntity(const SpatialProxy proxy) const { return m_Nodes[proxy].Entity; }
+		[[nodiscard]] const AABB& GetBounds(const SpatialProxy proxy) const { return m_Nodes[proxy].Bounds; }
+
+		[[nodiscard]] uint32_t GetProxyCount() const { return m_ProxyCount; }
+		[[nodiscard]] uint32_t GetHeight() const;
+		// Summed area of the internal nodes relative to the root, lower means cheaper queries
+		[[nodiscard]] float GetAreaRatio() const;
+
+		// Checks the links, heights and boxes of every node
+		[[nodiscard]] bool Validate() const;
+
+	private:
+		static constexpr int32_t NullNode = -1;
+
+		// Margin the leaf boxes are grown by, in scene units and relative to the size of the bounds
+		static constexpr float AbsoluteMargin = 0.1f;
+		static constexpr float RelativeMargin = 0.1f;
+
+		struct Node
+		{
+			// Grown bounds for leaves, union of the children otherwise
+			AABB Box;
+			// Exact bounds of a leaf
+			AABB Bounds;
+			entt::entity Entity = entt::null;
+
+			// Next free node while the node is unused
+			int32_t Parent = NullNode;
+			int32_t Child1 = NullNode;
+			int32_t Child2 = NullNode;
+			// Zero for leaves, -1 for free nodes
+			int32_t Height = 0;
+
+			[[nodiscard]] bool IsLeaf() const { return Child1 == NullNode; }
+		};
+
+		int32_t AllocateNode();
+		void FreeNode(int32_t index);
+
+		void InsertLeaf(int32_t leaf);
+		void RemoveLeaf(int32_t leaf);
+		// Fixes boxes and heights from the node up to the root, rotating where needed
+		void Refit(int32_t index);
+		// Rotates a grandchild up when the subtrees differ in height by more than one, returns the new subtree root
+		int32_t Balance(int32_t index);
+
+		struct BuildLeaf
+		{
+			glm::vec3 Center;
+			int32_t Node;
+		};
+
+		int32_t BuildRange(BuildLeaf* leaves, int32_t count);
+
+		template<typename Classify>
+		void QueryTree(const Classify& classify, std::vector<entt::entity>& results) const;
+		void CollectLeaves(int32_t index, std::vector<entt::entity>& results) const;
+
+		static AABB Grow(const AABB& bounds);
+
+	private:
+		std::vector<Node> m_Nodes;
+		int32_t m_Root = NullNode;
+		int32_t m_FreeList = NullNode;
+		uint32_t m_ProxyCount = 0;
+	};
+}
@@ -0,0 +1,75 @@
+#include "pch.h"
+#include "SystemScheduler.h"
+
+namespace Eppo
+{
+	namespace Utils
+	{
+		static bool Overlaps(const std::vector<std::type_index>& lhs, const std::vector<std::type_index>& rhs)
+		{
+			for (const auto& type : lhs)
+			{
+				if (std::find(rhs.begin(), rhs.end(), type) != rhs.end())
+					return true;
+			}
+
+			return false;
+		}
+	}
+
+	bool SystemAccess::ConflictsWith(const SystemAccess& other) const
+	{
+		if (m_Exclusive || other.m_Exclusive)
+			return true;
+
+		return Utils::Overlaps(m_Writes, other.m_Writes) || Utils::Overlaps(m_Writes, other.m_Reads) || Utils::Overlaps(m_Reads, other.m_Writes);
+	}
+
+	void SystemScheduler::AddSystem(std::string name, const SystemAccess& access, SystemFn fn)
+	{
+		m_Systems.push_back({ std::move(name), access, std::move(fn) });
+		m_GraphDirty = true;
+	}
+
+	void SystemScheduler::Clear()
+	{
+		m_Systems.clear();
+		m_Graph.Clear();
+		m_GraphDirty = true;
+	}
+
+	void SystemScheduler::Run(const float timestep, ThreadPool& threadPool)
+	{
+		EPPO_PROFILE_FUNCTION("SystemScheduler::Run");
+
+		if (m_GraphDirty)
+			BuildGraph();
+
+		m_Timestep = timestep;
+		m_Graph.Run(threadPool);
+	}
+
+	void SystemScheduler::BuildGraph()
+	{
+		m_Graph.Clear();
+
+		// Each system waits for the earlier ones it conflicts with
+		for (size_t i = 0; i < m_Systems.size(); i++)
+		{
+			std::vector<JobId> dependencies;
+			for (size_t j = 0; j < i; j++)
+			{
+				if (m_Systems[i].Access.ConflictsWith(m_Systems[j].Access))
+					dependencies.push_back(static_cast<JobId>(j));
+			}
+
+			m_Graph.Add([this, i]()
+			{
+				EPPO_PROFILE_FUNCTION("SystemScheduler::RunSystem");
+				m_Systems[i].Fn(m_Timestep);
+			}, dependencies, m_Systems[i].Access.IsMainThread());
+		}
+
+		m_GraphDirty = false;
+	}
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Core/JobGraph.h"
+
+#include <entt/entt.hpp>
+
+#include <typeindex>
+
+namespace Eppo
+{
+	// Components a system reads and writes. Systems conflict when one of them writes a component the other
+	// one uses, conflicting systems run in the order they were added and all others run concurrently.
+	class SystemAccess
+	{
+	public:
+		template<typename... T>
+		SystemAccess& Read()
+		{
+			(m_Reads.emplace_back(typeid(T)), ...);
+			return *this;
+		}
+
+		template<typename... T>
+		SystemAccess& Write()
+		{
+			(m_Writes.emplace_back(typeid(T)), ...);
+			return *this;
+		}
+
+		// Conflicts with every other system, for systems that may touch anything such as scripts
+		SystemAccess& Exclusive() { m_Exclusive = true; return *this; }
+		// Runs on the thread running the scheduler, for APIs bound to it
+		SystemAccess& MainThread() { m_MainThread = true; return *this; }
+
+		[[nodiscard]] bool ConflictsWith(const SystemAccess& other) const;
+		[[nodiscard]] bool IsMainThread() const { return m_MainThread; }
+
+	private:
+		std::vector<std::type_index> m_Reads;
+		std::vector<std::type_index> m_Writes;
+		bool m_Exclusive = false;
+		bool m_MainThread = false;
+	};
+
+	using SystemFn = std::function<void(float timestep)>;
+
+	class SystemScheduler
+	{
+	public:
+		static constexpr uint32_t DefaultChunkSize = 1024;
+
+		void AddSystem(std::string name, const SystemAccess& access, SystemFn fn);
+		void Clear();
+
+		// Runs every system once and returns when all are done
+		void Run(float timestep, ThreadPool& threadPool = ThreadPool::Get());
+
+		// Calls fn for every item, chunks of the items run on different threads
+		template<typename T, typename Fn>
+		static void ParallelEach(const std::vector<T>& items, Fn fn, ThreadPool& threadPool = ThreadPool::Get(), const uint32_t chunkSize = DefaultChunkSize)
+		{
+			const auto chunkCount = static_cast<uint32_t>((items.size() + chunkSize - 1) / chunkSize);
+
+			threadPool.ParallelFor(chunkCount, [&items, &fn, chunkSize](const uint32_t chunk)
+			{
+				const size_t end = std::min(items.size(), static_cast<size_t>(chunk + 1) * chunkSize);
+				for (size_t i = static_cast<size_t>(chunk) * chunkSize; i < end; i++)
+					fn(items[i]);
+			});
+		}
+
+		// Calls fn for every entity of the view, chunks of the view run on different threads
+		template<typename View, typename Fn>
+		static void ParallelEach(const View& view, Fn fn, ThreadPool& threadPool = ThreadPool::Get(), const uint32_t chunkSize = DefaultChunkSize)
+		{
+			// Views of several components only iterate forward, so the entities are gathered first
+			const std::vector<entt::entity> entities(view.begin(), view.end());
+			ParallelEach(entities, std::move(fn), threadPool, chunkSize);
+		}
+
+	private:
+		void BuildGraph();
+
+	private:
+		struct System
+		{
+			std::string Name;
+			SystemAccess Access;
+			SystemFn Fn;
+		};
+
+		std::vector<System> m_Systems;
+
+		JobGraph m_Graph;
+		bool m_GraphDirty = true;
+		float m_Timestep = 0.0f;
+	};
+}
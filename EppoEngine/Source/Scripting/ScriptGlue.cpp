@@ -6,6 +6,7 @@
 #include "Scene/Entity.h"
 #include "Scripting/ScriptEngine.h"
 
+#include <mono/metadata/appdomain.h>
 #include <mono/metadata/reflection.h>
 #include <bullet/btBulletDynamicsCommon.h>
 
@@ -100,6 +101,26 @@ namespace Eppo
 
 		return entity.GetUUID();
 	}
+
+	static MonoArray* Entity_FindEntitiesByName(MonoString* name)
+	{
+		EPPO_PROFILE_FUNCTION("ScriptGlue::Entity_FindEntitiesByName");
+
+		const Ref<Scene> scene = ScriptEngine::GetSceneContext();
+		EPPO_ASSERT(scene)
+
+		char* cStr = mono_string_to_utf8(name);
+		const std::string nameStr(cStr);
+		mono_free(cStr);
+
+		std::vector<Entity> entities = scene->FindEntitiesByName(nameStr);
+
+		MonoArray* uuids = mono_array_new(ScriptEngine::GetAppDomain(), mono_get_uint64_class(), entities.size());
+		for (size_t i = 0; i < entities.size(); i++)
+			mono_array_set(uuids, uint64_t, i, entities[i].GetUUID());
+
+		return uuids;
+	}
 	
 	static MonoString* Entity_GetName(const UUID uuid)
 	{
@@ -196,6 +217,7 @@ namespace Eppo
 		EPPO_ADD_INTERNAL_CALL(Entity_AddComponent)
 		EPPO_ADD_INTERNAL_CALL(Entity_CreateNewEntity)
 		EPPO_ADD_INTERNAL_CALL(Entity_FindEntityByName)
+		EPPO_ADD_INTERNAL_CALL(Entity_FindEntitiesByName)
 		EPPO_ADD_INTERNAL_CALL(Entity_GetName)
 		EPPO_ADD_INTERNAL_CALL(Entity_HasComponent)
 		EPPO_ADD_INTERNAL_CALL(TransformComponent_GetTranslation)
@@ -0,0 +1,50 @@
+-- Sources are cloned into ./benchmark by Scripts/Setup.py
+project "googlebenchmark"
+    kind "StaticLib"
+    language "C++"
+    cppdialect "C++17"
+    staticruntime "Off"
+
+    targetdir ("%{wks.location}/Bin/" .. OutputDir .. "/%{prj.name}")
+    objdir ("%{wks.location}/Bin-Int/" .. OutputDir .. "/%{prj.name}")
+
+    defines {
+        "BENCHMARK_STATIC_DEFINE",
+        "HAVE_STD_REGEX",
+        "HAVE_STEADY_CLOCK"
+    }
+
+    files {
+        "benchmark/include/benchmark/benchmark.h",
+        "benchmark/include/benchmark/export.h",
+        "benchmark/src/**.h",
+        "benchmark/src/**.cc"
+    }
+
+    removefiles {
+        "benchmark/src/benchmark_main.cc"
+    }
+
+    includedirs {
+        "benchmark/include"
+    }
+
+    filter "system:linux"
+        links {
+            "pthread"
+        }
+
+    filter "Configurations:Debug"
+        runtime "Debug"
+        symbols "On"
+
+    -- Without NDEBUG the library reports itself as a debug build in the results
+    filter "Configurations:Release"
+        defines "NDEBUG"
+        runtime "Release"
+        optimize "On"
+
+    filter "Configurations:Dist"
+        defines "NDEBUG"
+        runtime "Release"
+        optimize "On"
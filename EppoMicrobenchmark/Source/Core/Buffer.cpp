@@ -0,0 +1,52 @@
+#include "Microbenchmark.h"
+
+namespace Eppo
+{
+	static void BM_BufferAllocate(benchmark::State& state)
+	{
+		const auto size = static_cast<uint32_t>(state.range(0));
+
+		for (auto _ : state)
+		{
+			Buffer buffer(size);
+			benchmark::DoNotOptimize(buffer.Data);
+			buffer.Release();
+		}
+
+		state.SetBytesProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_BufferAllocate)->RangeMultiplier(8)->Range(64, 1 << 24);
+
+	static void BM_BufferCopy(benchmark::State& state)
+	{
+		const auto size = static_cast<uint32_t>(state.range(0));
+
+		Buffer source(size);
+		memset(source.Data, 0xAB, size);
+
+		for (auto _ : state)
+		{
+			Buffer buffer = Buffer::Copy(source);
+			benchmark::DoNotOptimize(buffer.Data);
+			buffer.Release();
+		}
+
+		source.Release();
+		state.SetBytesProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_BufferCopy)->RangeMultiplier(8)->Range(64, 1 << 24);
+
+	static void BM_ScopedBuffer(benchmark::State& state)
+	{
+		const auto size = static_cast<uint32_t>(state.range(0));
+
+		for (auto _ : state)
+		{
+			ScopedBuffer buffer(size);
+			benchmark::DoNotOptimize(buffer.Data());
+		}
+
+		state.SetBytesProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_ScopedBuffer)->RangeMultiplier(8)->Range(64, 1 << 24);
+}
@@ -0,0 +1,47 @@
+#include "Microbenchmark.h"
+
+namespace Eppo
+{
+	class FilesystemFixture : public benchmark::Fixture
+	{
+	public:
+		void SetUp(const benchmark::State& state) override
+		{
+			m_Filepath = std::filesystem::temp_directory_path() / ("EppoMicrobenchmark_" + std::to_string(state.range(0)) + ".bin");
+			Filesystem::WriteText(m_Filepath, std::string(state.range(0), 'a'));
+		}
+
+		void TearDown(const benchmark::State& state) override
+		{
+			std::filesystem::remove(m_Filepath);
+		}
+
+	protected:
+		std::filesystem::path m_Filepath;
+	};
+
+	BENCHMARK_DEFINE_F(FilesystemFixture, ReadBytes)(benchmark::State& state)
+	{
+		for (auto _ : state)
+		{
+			Buffer buffer = Filesystem::ReadBytes(m_Filepath);
+			benchmark::DoNotOptimize(buffer.Data);
+			buffer.Release();
+		}
+
+		state.SetBytesProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK_REGISTER_F(FilesystemFixture, ReadBytes)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+
+	BENCHMARK_DEFINE_F(FilesystemFixture, ReadText)(benchmark::State& state)
+	{
+		for (auto _ : state)
+		{
+			std::string text = Filesystem::ReadText(m_Filepath);
+			benchmark::DoNotOptimize(text.data());
+		}
+
+		state.SetBytesProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK_REGISTER_F(FilesystemFixture, ReadText)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+}
@@ -0,0 +1,28 @@
+#include "Microbenchmark.h"
+
+namespace Eppo
+{
+	static void BM_HashFnvBuffer(benchmark::State& state)
+	{
+		Buffer buffer(static_cast<uint32_t>(state.range(0)));
+		memset(buffer.Data, 0xAB, buffer.Size);
+
+		for (auto _ : state)
+			benchmark::DoNotOptimize(Hash::GenerateFnv(buffer));
+
+		buffer.Release();
+		state.SetBytesProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_HashFnvBuffer)->RangeMultiplier(8)->Range(16, 1 << 20);
+
+	static void BM_HashFnvString(benchmark::State& state)
+	{
+		const std::string contents(state.range(0), 'a');
+
+		for (auto _ : state)
+			benchmark::DoNotOptimize(Hash::GenerateFnv(contents));
+
+		state.SetBytesProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_HashFnvString)->RangeMultiplier(8)->Range(16, 1 << 20);
+}
@@ -0,0 +1,48 @@
+#include "Microbenchmark.h"
+
+#include "Core/LayerStack.h"
+
+namespace Eppo
+{
+	static void BM_LayerStackPushPop(benchmark::State& state)
+	{
+		std::vector<Layer> layers(state.range(0));
+
+		for (auto _ : state)
+		{
+			LayerStack layerStack;
+
+			for (auto& layer : layers)
+				layerStack.PushLayer(&layer);
+
+			for (auto it = layers.rbegin(); it != layers.rend(); ++it)
+				layerStack.PopLayer(&*it);
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_LayerStackPushPop)->RangeMultiplier(4)->Range(1, 256);
+
+	static void BM_LayerStackIterate(benchmark::State& state)
+	{
+		std::vector<Layer> layers(state.range(0));
+
+		LayerStack layerStack;
+		for (auto& layer : layers)
+			layerStack.PushLayer(&layer);
+
+		for (auto _ : state)
+		{
+			for (Layer* layer : layerStack)
+				layer->Update(0.016f);
+
+			benchmark::ClobberMemory();
+		}
+
+		for (auto& layer : layers)
+			layerStack.PopLayer(&layer);
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_LayerStackIterate)->RangeMultiplier(4)->Range(1, 256);
+}
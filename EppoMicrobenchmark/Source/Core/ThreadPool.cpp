@@ -0,0 +1,28 @@
+#include "Microbenchmark.h"
+
+namespace Eppo
+{
+	// Hashes independent blocks on pools of growing size, the speedup over one thread shows the scaling with core count
+	static void BM_ThreadPoolParallelFor(benchmark::State& state)
+	{
+		ThreadPool threadPool(static_cast<uint32_t>(state.range(0)));
+
+		constexpr uint32_t blockCount = 256;
+		const std::string block(16 * 1024, 'a');
+		std::vector<uint64_t> hashes(blockCount);
+
+		for (auto _ : state)
+		{
+			threadPool.ParallelFor(blockCount, [&](const uint32_t index)
+			{
+				hashes[index] = Hash::GenerateFnv(block);
+			});
+
+			benchmark::DoNotOptimize(hashes.data());
+		}
+
+		state.counters["threads"] = static_cast<double>(threadPool.GetThreadCount() + 1);
+		state.SetBytesProcessed(state.iterations() * blockCount * block.size());
+	}
+	BENCHMARK(BM_ThreadPoolParallelFor)->DenseRange(0, 7)->UseRealTime();
+}
@@ -0,0 +1,31 @@
+#include "Microbenchmark.h"
+
+#include "Utility/Random.h"
+
+namespace Eppo
+{
+	static void BM_GenerateRandomUInt64(benchmark::State& state)
+	{
+		for (auto _ : state)
+			benchmark::DoNotOptimize(Utility::GenerateRandomUInt64());
+	}
+	BENCHMARK(BM_GenerateRandomUInt64);
+
+	static void BM_UUIDGenerate(benchmark::State& state)
+	{
+		std::vector<UUID> uuids;
+		uuids.reserve(state.range(0));
+
+		for (auto _ : state)
+		{
+			for (int64_t i = 0; i < state.range(0); i++)
+				uuids.emplace_back();
+
+			benchmark::DoNotOptimize(uuids.data());
+			uuids.clear();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_UUIDGenerate)->RangeMultiplier(10)->Range(1, 100000);
+}
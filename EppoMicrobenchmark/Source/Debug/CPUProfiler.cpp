@@ -0,0 +1,33 @@
+#include "Microbenchmark.h"
+
+#include "Debug/CPUProfiler.h"
+
+namespace Eppo
+{
+	// Cost of a profile scope while no capture is running, this is paid by every profiled function
+	static void BM_ProfileScopeIdle(benchmark::State& state)
+	{
+		for (auto _ : state)
+		{
+			ProfileScope scope("BM_ProfileScopeIdle");
+			benchmark::ClobberMemory();
+		}
+	}
+	BENCHMARK(BM_ProfileScopeIdle);
+
+	// Cost of a profile scope while a capture is recording into the ring buffers
+	static void BM_ProfileScopeCapturing(benchmark::State& state)
+	{
+		CPUProfiler::BeginCapture(1, "");
+		CPUProfiler::NewFrame();
+
+		for (auto _ : state)
+		{
+			ProfileScope scope("BM_ProfileScopeCapturing");
+			benchmark::ClobberMemory();
+		}
+
+		CPUProfiler::EndCapture();
+	}
+	BENCHMARK(BM_ProfileScopeCapturing);
+}
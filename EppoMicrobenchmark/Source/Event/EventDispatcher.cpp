@@ -0,0 +1,35 @@
+#include "Microbenchmark.h"
+
+namespace Eppo
+{
+	// Dispatches every event to the same set of handlers the application uses, one of which matches
+	static void BM_EventDispatch(benchmark::State& state)
+	{
+		std::vector<Scope<Event>> events;
+		events.reserve(state.range(0));
+
+		for (int64_t i = 0; i < state.range(0); i++)
+		{
+			if (i % 2 == 0)
+				events.emplace_back(CreateScope<KeyPressedEvent>(Key::A));
+			else
+				events.emplace_back(CreateScope<WindowResizeEvent>(1600, 900));
+		}
+
+		for (auto _ : state)
+		{
+			for (const auto& e : events)
+			{
+				EventDispatcher dispatcher(*e);
+				dispatcher.Dispatch<WindowCloseEvent>([](WindowCloseEvent&) { return true; });
+				dispatcher.Dispatch<WindowResizeEvent>([](const WindowResizeEvent& event) { return event.GetWidth() == 0; });
+				dispatcher.Dispatch<KeyPressedEvent>([](const KeyPressedEvent& event) { return event.IsRepeat(); });
+			}
+
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_EventDispatch)->RangeMultiplier(8)->Range(1, 4096);
+}
@@ -0,0 +1,22 @@
+#include "Microbenchmark.h"
+
+int main(int argc, char** argv)
+{
+	// Timings depend on how the engine was built, which the results do not say on their own
+#if defined(EPPO_DEBUG)
+	benchmark::AddCustomContext("eppo_configuration", "Debug");
+#elif defined(EPPO_RELEASE)
+	benchmark::AddCustomContext("eppo_configuration", "Release");
+#elif defined(EPPO_DIST)
+	benchmark::AddCustomContext("eppo_configuration", "Dist");
+#endif
+
+	benchmark::Initialize(&argc, argv);
+	if (benchmark::ReportUnrecognizedArguments(argc, argv))
+		return 1;
+
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+
+	return 0;
+}
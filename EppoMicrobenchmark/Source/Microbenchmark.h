@@ -0,0 +1,2 @@
+#include <EppoEngine.h>
+#include <benchmark/benchmark.h>
@@ -0,0 +1,77 @@
+#include "Microbenchmark.h"
+
+#include "Physics/PhysicsWorld.h"
+
+namespace Eppo
+{
+	namespace
+	{
+		// Boxes resting on the ground in a grid, stepped until all of them are asleep
+		struct RestingBodies
+		{
+			PhysicsWorld World;
+			std::vector<btRigidBody*> Bodies;
+
+			RestingBodies(const int64_t count, const bool threaded)
+				: World(threaded)
+			{
+				const auto side = static_cast<int64_t>(std::ceil(std::sqrt(static_cast<double>(count))));
+				const float extent = static_cast<float>(side) * 1.5f + 1.0f;
+				World.AddBody(entt::null, glm::vec3(0.0f, -1.0f, 0.0f), glm::quat(), glm::vec3(extent, 1.0f, extent), 0.0f);
+
+				for (int64_t i = 0; i < count; i++)
+				{
+					const glm::vec3 position(static_cast<float>(i % side) * 3.0f - extent, 0.5f, static_cast<float>(i / side) * 3.0f - extent);
+					Bodies.emplace_back(World.AddBody(static_cast<entt::entity>(i), position, glm::quat(), glm::vec3(0.5f), 1.0f));
+				}
+
+				for (uint32_t i = 0; i < 1000; i++)
+				{
+					World.Step(1.0f / 60.0f);
+					// A threaded world publishes nothing after its first step
+					if (i > 0 && World.GetMovedBodies().empty())
+						break;
+				}
+			}
+		};
+	}
+
+	// Main thread time of a step and the transform sync after it, with a percentage of the bodies kicked awake
+	// every step. With nothing else to do in between, a threaded world mostly waits here for the step it
+	// started last time; in a frame, that step overlaps scripts and rendering.
+	static void BM_PhysicsWorldStepMostlySleeping(benchmark::State& state)
+	{
+		RestingBodies scene(state.range(0), state.range(2) != 0);
+		std::vector<TransformComponent> transforms(scene.Bodies.size());
+
+		const int64_t awake = state.range(0) * state.range(1) / 100;
+		size_t next = 0;
+
+		for (auto _ : state)
+		{
+			for (int64_t i = 0; i < awake; i++)
+			{
+				scene.World.ApplyCentralImpulse(scene.Bodies[next], glm::vec3(0.0f, 0.1f, 0.0f));
+				next = (next + 1) % scene.Bodies.size();
+			}
+
+			scene.World.Step(1.0f / 60.0f);
+
+			for (const PhysicsPose& pose : scene.World.GetMovedBodies())
+			{
+				auto& transform = transforms[static_cast<size_t>(pose.Entity)];
+				transform.Translation = pose.Translation;
+				transform.Rotation = pose.Rotation;
+			}
+
+			benchmark::DoNotOptimize(transforms.data());
+		}
+
+		state.counters["moved"] = static_cast<double>(scene.World.GetMovedBodies().size());
+		state.counters["shapes"] = static_cast<double>(scene.World.GetShapeCount());
+	}
+	BENCHMARK(BM_PhysicsWorldStepMostlySleeping)
+		->Args({ 10000, 0, 0 })->Args({ 10000, 1, 0 })->Args({ 10000, 10, 0 })->Args({ 10000, 100, 0 })
+		->Args({ 10000, 0, 1 })->Args({ 10000, 1, 1 })->Args({ 10000, 10, 1 })->Args({ 10000, 100, 1 })
+		->Unit(benchmark::kMicrosecond)->UseRealTime();
+}
@@ -0,0 +1,32 @@
+#include "Microbenchmark.h"
+
+#include "Renderer/CommandQueue.h"
+
+namespace Eppo
+{
+	// Records and executes a frame worth of commands, the capture mimics a typical render command lambda
+	static void BM_CommandQueue(benchmark::State& state)
+	{
+		CommandQueue commandQueue;
+
+		uint64_t counter = 0;
+		const glm::mat4 transform(1.0f);
+
+		for (auto _ : state)
+		{
+			for (int64_t i = 0; i < state.range(0); i++)
+			{
+				commandQueue.AddCommand([&counter, transform]()
+				{
+					counter += static_cast<uint64_t>(transform[0][0]);
+				});
+			}
+
+			commandQueue.Execute();
+		}
+
+		benchmark::DoNotOptimize(counter);
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_CommandQueue)->RangeMultiplier(8)->Range(1, 1 << 15);
+}
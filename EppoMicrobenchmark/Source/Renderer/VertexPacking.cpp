@@ -0,0 +1,86 @@
+#include "Microbenchmark.h"
+
+#include "Renderer/Mesh/VertexPacking.h"
+
+namespace Eppo
+{
+	namespace
+	{
+		// A mesh packed in one format, with both of its streams
+		struct PackedMesh
+		{
+			std::vector<uint8_t> VertexData;
+			std::vector<uint8_t> PositionData;
+
+			PackedMesh(const int64_t vertexCount, const VertexFormat format)
+			{
+				std::mt19937 random(42);
+				std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+				std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+				std::vector<Vertex> vertices(vertexCount);
+				for (Vertex& vertex : vertices)
+				{
+					vertex.Position = glm::vec3(position(random), position(random), position(random));
+					vertex.Normal = glm::normalize(glm::vec3(unit(random), unit(random), 1.0f));
+					vertex.TexCoord = glm::vec2(unit(random), unit(random));
+				}
+
+				const VertexQuantization quantization = VertexPacking::GetQuantization(format, glm::vec3(-10.0f), glm::vec3(10.0f));
+				VertexPacking::Pack(vertices.data(), vertices.size(), format, quantization, VertexData, PositionData);
+			}
+		};
+
+		// Reads the first value of every vertex, which pulls each cache line of the stream in like a vertex fetch
+		float FetchVertices(const std::vector<uint8_t>& data, const uint32_t stride)
+		{
+			float sum = 0.0f;
+			for (size_t i = 0; i < data.size(); i += stride)
+			{
+				uint32_t value;
+				std::memcpy(&value, data.data() + i, sizeof(value));
+				sum += static_cast<float>(value & 0xFFFF);
+			}
+
+			return sum;
+		}
+	}
+
+	// Streams the depth pass reads per vertex. Before the position-only streams it bound the interleaved
+	// vertices, arg 0 is that case, then full precision positions and quantized positions.
+	static void BM_DepthPassVertexFetch(benchmark::State& state)
+	{
+		const int64_t stream = state.range(0);
+		const int64_t vertexCount = state.range(1);
+
+		const VertexFormat format = stream == 2 ? VertexFormat::PackedQuantized : VertexFormat::Standard;
+		const PackedMesh mesh(vertexCount, format);
+
+		const std::vector<uint8_t>& data = stream == 0 ? mesh.VertexData : mesh.PositionData;
+		const uint32_t stride = stream == 0 ? VertexPacking::GetLayout(format).GetStride() : VertexPacking::GetPositionLayout(format).GetStride();
+
+		for (auto _ : state)
+			benchmark::DoNotOptimize(FetchVertices(data, stride));
+
+		state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(data.size()));
+		state.counters["bytes_per_vertex"] = stride;
+	}
+	BENCHMARK(BM_DepthPassVertexFetch)->ArgsProduct({ { 0, 1, 2 }, { 1 << 16, 1 << 20 } })->Unit(benchmark::kMicrosecond);
+
+	// Interleaved stream the geometry pass reads per vertex, arg 0 is the vertex format
+	static void BM_GeometryPassVertexFetch(benchmark::State& state)
+	{
+		const auto format = static_cast<VertexFormat>(state.range(0));
+		const int64_t vertexCount = state.range(1);
+
+		const PackedMesh mesh(vertexCount, format);
+		const uint32_t stride = VertexPacking::GetLayout(format).GetStride();
+
+		for (auto _ : state)
+			benchmark::DoNotOptimize(FetchVertices(mesh.VertexData, stride));
+
+		state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(mesh.VertexData.size()));
+		state.counters["bytes_per_vertex"] = stride;
+	}
+	BENCHMARK(BM_GeometryPassVertexFetch)->ArgsProduct({ { 0, 1, 2 }, { 1 << 16, 1 << 20 } })->Unit(benchmark::kMicrosecond);
+}
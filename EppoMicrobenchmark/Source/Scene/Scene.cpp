@@ -0,0 +1,73 @@
+#include "Microbenchmark.h"
+
+namespace Eppo
+{
+	static Ref<Scene> CreatePlayModeScene(const int64_t entityCount)
+	{
+		Ref<Scene> scene = CreateRef<Scene>();
+
+		for (int64_t i = 0; i < entityCount; i++)
+		{
+			Entity entity = scene->CreateEntity();
+			entity.AddComponent<MeshComponent>();
+
+			if (i % 4 == 0)
+				entity.AddComponent<PointLightComponent>();
+		}
+
+		return scene;
+	}
+
+	// Entering play mode, the editor scene is copied
+	static void BM_SceneEnterPlayMode(benchmark::State& state)
+	{
+		const Ref<Scene> scene = CreatePlayModeScene(state.range(0));
+
+		for (auto _ : state)
+		{
+			Ref<Scene> runtimeScene = Scene::Copy(scene);
+			benchmark::DoNotOptimize(runtimeScene.get());
+
+			state.PauseTiming();
+			runtimeScene.reset();
+			state.ResumeTiming();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_SceneEnterPlayMode)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+
+	// Leaving play mode, the copy is released and the editor scene is used as it was
+	static void BM_SceneLeavePlayMode(benchmark::State& state)
+	{
+		const Ref<Scene> scene = CreatePlayModeScene(state.range(0));
+
+		for (auto _ : state)
+		{
+			state.PauseTiming();
+			Ref<Scene> runtimeScene = Scene::Copy(scene);
+			state.ResumeTiming();
+
+			runtimeScene.reset();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_SceneLeavePlayMode)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+
+	// Looked up by scripts every frame, among entities of a few hundred different names
+	static void BM_SceneFindEntityByName(benchmark::State& state)
+	{
+		const Ref<Scene> scene = CreateRef<Scene>();
+		for (int64_t i = 0; i < state.range(0); i++)
+			scene->CreateEntity("Entity" + std::to_string(i % 256));
+
+		Entity player = scene->CreateEntity("Player");
+
+		for (auto _ : state)
+			benchmark::DoNotOptimize(scene->FindEntityByName("Player") == player);
+
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_SceneFindEntityByName)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kNanosecond);
+}
@@ -0,0 +1,207 @@
+#include "Microbenchmark.h"
+
+namespace Eppo
+{
+	namespace
+	{
+		// Boxes of up to a few units spread over a square kilometer
+		struct SpatialScene
+		{
+			std::vector<entt::entity> Entities;
+			std::vector<AABB> Bounds;
+
+			explicit SpatialScene(const int64_t count)
+			{
+				std::mt19937 random(42);
+				std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+				std::uniform_real_distribution<float> size(0.5f, 4.0f);
+
+				for (int64_t i = 0; i < count; i++)
+				{
+					const glm::vec3 min(position(random), position(random) * 0.05f, position(random));
+
+					Entities.emplace_back(static_cast<entt::entity>(i));
+					Bounds.emplace_back(min, min + glm::vec3(size(random), size(random), size(random)));
+				}
+			}
+		};
+
+		Frustum CreateFrustum(const float angle)
+		{
+			const glm::vec3 eye(std::cos(angle) * 100.0f, 20.0f, std::sin(angle) * 100.0f);
+			const glm::mat4 view = glm::lookAt(eye, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+			return Frustum(glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 300.0f) * view);
+		}
+	}
+
+	static void BM_SpatialIndexBuild(benchmark::State& state)
+	{
+		const SpatialScene scene(state.range(0));
+		std::vector<SpatialProxy> proxies;
+
+		for (auto _ : state)
+		{
+			SpatialIndex index;
+			index.Build(scene.Entities, scene.Bounds, proxies);
+			benchmark::DoNotOptimize(index.GetHeight());
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_SpatialIndexBuild)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+
+	static void BM_SpatialIndexInsert(benchmark::State& state)
+	{
+		const SpatialScene scene(state.range(0));
+
+		for (auto _ : state)
+		{
+			SpatialIndex index;
+			for (size_t i = 0; i < scene.Entities.size(); i++)
+				index.Insert(scene.Entities[i], scene.Bounds[i]);
+
+			benchmark::DoNotOptimize(index.GetHeight());
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_SpatialIndexInsert)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+
+	// A tenth of the entities move every frame, as with physics or animation
+	static void BM_SpatialIndexUpdate(benchmark::State& state)
+	{
+		SpatialScene scene(state.range(0));
+
+		SpatialIndex index;
+		std::vector<SpatialProxy> proxies;
+		index.Build(scene.Entities, scene.Bounds, proxies);
+
+		std::mt19937 random(7);
+		std::uniform_real_distribution<float> offset(-0.2f, 0.2f);
+
+		uint32_t reinserted = 0;
+		for (auto _ : state)
+		{
+			for (size_t i = 0; i < proxies.size(); i += 10)
+			{
+				const glm::vec3 delta(offset(random), offset(random), offset(random));
+				scene.Bounds[i] = AABB(scene.Bounds[i].Min + delta, scene.Bounds[i].Max + delta);
+
+				reinserted += index.Update(proxies[i], scene.Bounds[i]) ? 1 : 0;
+			}
+		}
+
+		state.counters["height"] = static_cast<double>(index.GetHeight());
+		state.counters["reinserted"] = benchmark::Counter(static_cast<double>(reinserted), benchmark::Counter::kAvgIterations);
+		state.SetItemsProcessed(state.iterations() * (state.range(0) / 10));
+	}
+	BENCHMARK(BM_SpatialIndexUpdate)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMicrosecond);
+
+	static void BM_SpatialIndexQueryFrustum(benchmark::State& state)
+	{
+		const SpatialScene scene(state.range(0));
+
+		SpatialIndex index;
+		std::vector<SpatialProxy> proxies;
+		index.Build(scene.Entities, scene.Bounds, proxies);
+
+		std::vector<entt::entity> results;
+		float angle = 0.0f;
+
+		for (auto _ : state)
+		{
+			results.clear();
+			index.Query(CreateFrustum(angle), results);
+			benchmark::DoNotOptimize(results.data());
+
+			angle += 0.01f;
+		}
+
+		state.counters["visible"] = static_cast<double>(results.size());
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_SpatialIndexQueryFrustum)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMicrosecond);
+
+	// The O(N) walk the index replaces, every box tested against the frustum
+	static void BM_SpatialIndexQueryFrustumLinear(benchmark::State& state)
+	{
+		const SpatialScene scene(state.range(0));
+
+		std::vector<entt::entity> results;
+		float angle = 0.0f;
+
+		for (auto _ : state)
+		{
+			results.clear();
+
+			const Frustum frustum = CreateFrustum(angle);
+			for (size_t i = 0; i < scene.Bounds.size(); i++)
+			{
+				if (frustum.Classify(scene.Bounds[i]) != Containment::Outside)
+					results.emplace_back(scene.Entities[i]);
+			}
+
+			benchmark::DoNotOptimize(results.data());
+			angle += 0.01f;
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_SpatialIndexQueryFrustumLinear)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMicrosecond);
+
+	// Light ranges of a frame, one sphere query per light
+	static void BM_SpatialIndexQuerySphereBatch(benchmark::State& state)
+	{
+		const SpatialScene scene(state.range(0));
+
+		SpatialIndex index;
+		std::vector<SpatialProxy> proxies;
+		index.Build(scene.Entities, scene.Bounds, proxies);
+
+		std::mt19937 random(3);
+		std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+
+		std::vector<Sphere> spheres;
+		for (uint32_t i = 0; i < 64; i++)
+			spheres.emplace_back(glm::vec3(position(random), 0.0f, position(random)), 25.0f);
+
+		ThreadPool threadPool(ThreadPool::GetDefaultThreadCount());
+		std::vector<std::vector<entt::entity>> results;
+
+		for (auto _ : state)
+		{
+			index.QueryBatch(spheres, results, threadPool);
+			benchmark::DoNotOptimize(results.data());
+		}
+
+		state.SetItemsProcessed(state.iterations() * spheres.size());
+	}
+	BENCHMARK(BM_SpatialIndexQuerySphereBatch)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+	static void BM_SpatialIndexRaycast(benchmark::State& state)
+	{
+		const SpatialScene scene(state.range(0));
+
+		SpatialIndex index;
+		std::vector<SpatialProxy> proxies;
+		index.Build(scene.Entities, scene.Bounds, proxies);
+
+		std::vector<RaycastHit> hits;
+		float angle = 0.0f;
+
+		for (auto _ : state)
+		{
+			hits.clear();
+
+			const glm::vec3 origin(std::cos(angle) * 600.0f, 1.0f, std::sin(angle) * 600.0f);
+			index.Raycast(Ray(origin, glm::normalize(-origin)), 1200.0f, hits);
+			benchmark::DoNotOptimize(hits.data());
+
+			angle += 0.01f;
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_SpatialIndexRaycast)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMicrosecond);
+}
@@ -0,0 +1,57 @@
+project "EppoMicrobenchmark"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++17"
+    staticruntime "Off"
+
+    targetdir ("%{wks.location}/Bin/" .. OutputDir .. "/%{prj.name}")
+    objdir ("%{wks.location}/Bin-Int/" .. OutputDir .. "/%{prj.name}")
+
+	dependson {
+		"EppoEngine"
+	}
+
+    files {
+        "Source/**.h",
+        "Source/**.cpp"
+    }
+
+    includedirs {
+        "Source",
+        "%{wks.location}/EppoEngine/Source",
+
+		-- TODO: Remove some of the dependencies here
+		"%{IncludeDir.entt}",
+		"%{IncludeDir.glm}",
+		"%{IncludeDir.googlebenchmark}",
+		"%{IncludeDir.imgui}",
+		"%{IncludeDir.spdlog}",
+		"%{IncludeDir.tracy}",
+		"%{IncludeDir.vulkan}",
+		"%{IncludeDir.vma}"
+    }
+
+    links {
+        "googlebenchmark",
+        "EppoEngine"
+    }
+
+    filter "system:windows"
+        links {
+            "Shlwapi.lib"
+        }
+
+    filter "Configurations:Debug"
+        defines "EPPO_DEBUG"
+        runtime "Debug"
+        symbols "On"
+    
+    filter "Configurations:Release"
+        defines "EPPO_RELEASE"
+        runtime "Release"
+        optimize "On"
+    
+    filter "Configurations:Dist"
+        defines "EPPO_DIST"
+        runtime "Release"
+        optimize "On"
@@ -24,6 +24,8 @@ namespace Eppo
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
 		internal extern static ulong Entity_FindEntityByName(string name);
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static ulong[] Entity_FindEntitiesByName(string name);
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
 		internal extern static bool Entity_HasComponent(ulong uuid, Type componentType);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
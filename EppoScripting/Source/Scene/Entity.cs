@@ -106,6 +106,17 @@ namespace Eppo
 			return new Entity(uuid);
 		}
 
+		public static Entity[] FindEntitiesByName(string name)
+		{
+			ulong[] uuids = InternalCalls.Entity_FindEntitiesByName(name);
+
+			Entity[] entities = new Entity[uuids.Length];
+			for (int i = 0; i < uuids.Length; i++)
+				entities[i] = new Entity(uuids[i]);
+
+			return entities;
+		}
+
 		public static Entity CreateNewEntity(string name = "")
 		{
 			ulong uuid = InternalCalls.Entity_CreateNewEntity(name);
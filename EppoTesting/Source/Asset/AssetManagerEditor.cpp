@@ -0,0 +1,186 @@
+#include "Test.h"
+
+namespace Eppo
+{
+	namespace
+	{
+		// Holds CPU memory only, so evicting it needs no renderer
+		struct ResidentTestAsset : Asset
+		{
+			[[nodiscard]] AssetMemoryUsage GetMemoryUsage() const override { return { 100, 0 }; }
+		};
+
+		// Project in a temporary directory, with a registered mesh that is not a glTF file at all
+		class AssetManagerEditorTest : public testing::Test
+		{
+		protected:
+			static constexpr uint64_t MeshHandle = 42;
+
+			void SetUp() override
+			{
+				m_Directory = std::filesystem::temp_directory_path() / "AssetManagerEditorTest";
+				std::filesystem::remove_all(m_Directory);
+				std::filesystem::create_directories(m_Directory / "Assets" / "Meshes");
+
+				ProjectSpecification specification;
+				specification.ProjectDirectory = m_Directory;
+				Project::New(specification);
+
+				{
+					std::ofstream registry(m_Directory / "Assets" / "AssetRegistry.epporeg");
+					registry << "- AssetHandle: " << MeshHandle << "\n  Type: Mesh\n  Filepath: Meshes/Broken.glb\n";
+				}
+
+				WriteFile("Meshes/Broken.glb", "glTF, cut short");
+
+				m_AssetManager = CreateRef<AssetManagerEditor>();
+				Project::GetActive()->SetAssetManager(m_AssetManager);
+				ASSERT_TRUE(m_AssetManager->DeserializeAssetRegistry());
+			}
+
+			void TearDown() override
+			{
+				m_AssetManager.reset();
+				Project::SetActive(nullptr);
+				std::filesystem::remove_all(m_Directory);
+			}
+
+			void WriteFile(const std::filesystem::path& filepath, const std::string_view contents) const
+			{
+				std::ofstream stream(m_Directory / "Assets" / filepath, std::ios::binary | std::ios::trunc);
+				stream.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+			}
+
+			// Registered and loaded, only the asset manager holds on to it
+			AssetHandle CreateResidentAsset(const std::filesystem::path& filepath) const
+			{
+				const auto asset = CreateRef<ResidentTestAsset>();
+				EXPECT_TRUE(m_AssetManager->CreateAsset(asset, Project::GetAssetFilepath(filepath)));
+
+				return asset->Handle;
+			}
+
+			std::filesystem::path m_Directory;
+			Ref<AssetManagerEditor> m_AssetManager;
+		};
+	}
+
+	TEST_F(AssetManagerEditorTest, FailedAsyncLoad)
+	{
+		ASSERT_EQ(m_AssetManager->GetAssetAsync(MeshHandle), nullptr);
+
+		for (uint32_t i = 0; i < 5000 && m_AssetManager->GetAssetLoadState(MeshHandle) == AssetLoadState::Loading; i++)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			ASSERT_EQ(m_AssetManager->GetAssetAsync(MeshHandle), nullptr);
+		}
+
+		ASSERT_EQ(m_AssetManager->GetAssetLoadState(MeshHandle), AssetLoadState::Failed);
+		ASSERT_FALSE(m_AssetManager->IsAssetLoaded(MeshHandle));
+	}
+
+	TEST_F(AssetManagerEditorTest, FailedReloadKeepsPreviousVersion)
+	{
+		// Stands in for the version loaded before the file was overwritten
+		const auto previous = CreateRef<Asset>();
+		previous->Handle = 7;
+		ASSERT_TRUE(m_AssetManager->CreateAsset(previous, Project::GetAssetFilepath("Meshes/Reloaded.glb")));
+
+		// Saving was cut short after the header
+		WriteFile("Meshes/Reloaded.glb", std::string_view("glTF\x02\x00\x00\x00\x00\x10\x00\x00", 12));
+
+		ASSERT_TRUE(m_AssetManager->ReloadAsset(previous->Handle));
+		ASSERT_FALSE(m_AssetManager->ReloadAsset(previous->Handle));
+
+		for (uint32_t i = 0; i < 5000 && m_AssetManager->IsReloading(previous->Handle); i++)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			m_AssetManager->Update();
+		}
+
+		ASSERT_FALSE(m_AssetManager->IsReloading(previous->Handle));
+		ASSERT_EQ(m_AssetManager->GetAsset(previous->Handle), previous);
+	}
+
+	TEST_F(AssetManagerEditorTest, LoadGeneration)
+	{
+		const uint64_t generation = m_AssetManager->GetLoadGeneration();
+
+		const auto asset = CreateRef<Asset>();
+		asset->Handle = 7;
+		ASSERT_TRUE(m_AssetManager->CreateAsset(asset, Project::GetAssetFilepath("Meshes/Created.glb")));
+		EXPECT_NE(m_AssetManager->GetLoadGeneration(), generation);
+
+		// Using a loaded asset changes nothing cached from it
+		const uint64_t loaded = m_AssetManager->GetLoadGeneration();
+		ASSERT_EQ(m_AssetManager->GetAsset(asset->Handle), asset);
+		EXPECT_EQ(m_AssetManager->GetLoadGeneration(), loaded);
+	}
+
+	TEST_F(AssetManagerEditorTest, EvictsLeastRecentlyUsedFirst)
+	{
+		const AssetHandle first = CreateResidentAsset("Scenes/First.epscene");
+		const AssetHandle second = CreateResidentAsset("Scenes/Second.epscene");
+		const AssetHandle third = CreateResidentAsset("Scenes/Third.epscene");
+		ASSERT_EQ(m_AssetManager->GetResidentMemory(), 300);
+
+		// Using the first one makes the second the least recently used
+		ASSERT_NE(m_AssetManager->GetAsset(first), nullptr);
+
+		const uint64_t generation = m_AssetManager->GetLoadGeneration();
+		m_AssetManager->SetMemoryBudget(200);
+		EXPECT_FALSE(m_AssetManager->IsAssetLoaded(second));
+		EXPECT_TRUE(m_AssetManager->IsAssetLoaded(first));
+		EXPECT_TRUE(m_AssetManager->IsAssetLoaded(third));
+		EXPECT_NE(m_AssetManager->GetLoadGeneration(), generation);
+
+		m_AssetManager->SetMemoryBudget(100);
+		EXPECT_FALSE(m_AssetManager->IsAssetLoaded(third));
+		EXPECT_TRUE(m_AssetManager->IsAssetLoaded(first));
+		EXPECT_EQ(m_AssetManager->GetResidentMemory(), 100);
+
+		const std::vector<AssetResidencyInfo> report = m_AssetManager->GetResidencyReport(10);
+		ASSERT_EQ(report.size(), 1);
+		EXPECT_EQ(report[0].Handle, first);
+		EXPECT_EQ(report[0].Memory.Cpu, 100);
+		EXPECT_EQ(report[0].Filepath, std::filesystem::path("Scenes/First.epscene"));
+	}
+
+	TEST_F(AssetManagerEditorTest, ReferencedAssetsStayResident)
+	{
+		const AssetHandle unreferenced = CreateResidentAsset("Scenes/Unreferenced.epscene");
+		const AssetHandle referenced = CreateResidentAsset("Scenes/Referenced.epscene");
+
+		// Least recently used, but still in use
+		const Ref<Asset> asset = m_AssetManager->GetAsset(referenced);
+		ASSERT_NE(asset, nullptr);
+		ASSERT_NE(m_AssetManager->GetAsset(unreferenced), nullptr);
+
+		m_AssetManager->SetMemoryBudget(50);
+		EXPECT_FALSE(m_AssetManager->IsAssetLoaded(unreferenced));
+		EXPECT_TRUE(m_AssetManager->IsAssetLoaded(referenced));
+		EXPECT_EQ(m_AssetManager->GetResidentMemory(), 100);
+
+		// Loading more does not push it out either
+		CreateResidentAsset("Scenes/Loaded.epscene");
+		EXPECT_TRUE(m_AssetManager->IsAssetLoaded(referenced));
+		EXPECT_EQ(m_AssetManager->GetAsset(referenced), asset);
+	}
+
+	TEST_F(AssetManagerEditorTest, EvictedAssetReloads)
+	{
+		std::filesystem::create_directories(m_Directory / "Assets" / "Scenes");
+		WriteFile("Scenes/Evicted.epscene", "Scene: Evicted\nEntities: []\n");
+
+		const AssetHandle handle = CreateResidentAsset("Scenes/Evicted.epscene");
+		m_AssetManager->SetMemoryBudget(1);
+		ASSERT_FALSE(m_AssetManager->IsAssetLoaded(handle));
+
+		// Imported from its file again, under the same handle
+		const Ref<Asset> asset = m_AssetManager->GetAsset(handle);
+		ASSERT_NE(asset, nullptr);
+		EXPECT_EQ(asset->Handle, handle);
+		EXPECT_TRUE(m_AssetManager->IsAssetLoaded(handle));
+		EXPECT_EQ(m_AssetManager->GetAssetType(handle), AssetType::Scene);
+	}
+}
@@ -0,0 +1,56 @@
+#include "Test.h"
+
+#include "Asset/AssetPack.h"
+
+namespace Eppo
+{
+	TEST(AssetPackTest, RoundTrip)
+	{
+		const std::string compressible(4096, 'e');
+		const std::string incompressible = "abcdefgh";
+
+		const DerivedDataKey meshKey = DerivedDataKey("Test", 1).Append(std::string_view(compressible));
+		const DerivedDataKey sceneKey = DerivedDataKey("Test", 1).Append(std::string_view(incompressible));
+
+		AssetPackBuilder builder;
+		builder.SetStartScene(7);
+		builder.AddAsset(42, AssetType::Mesh, meshKey);
+		builder.AddAsset(7, AssetType::Scene, sceneKey);
+		builder.AddAsset(1000, AssetType::Mesh, meshKey);
+		builder.AddData(meshKey, compressible.data(), compressible.size());
+		builder.AddData(sceneKey, incompressible.data(), incompressible.size());
+
+		const std::filesystem::path filepath = std::filesystem::temp_directory_path() / "AssetPackTest.eppak";
+		ASSERT_TRUE(builder.Write(filepath, true));
+
+		{
+			const AssetPack pack(filepath);
+			ASSERT_TRUE(pack.IsValid());
+			ASSERT_EQ(pack.GetStartScene(), 7);
+
+			const AssetPackEntry* mesh = pack.FindAsset(42);
+			ASSERT_NE(mesh, nullptr);
+			ASSERT_EQ(mesh->Type, static_cast<uint32_t>(AssetType::Mesh));
+			ASSERT_EQ(mesh->Key, meshKey.GetValue());
+			ASSERT_EQ(pack.FindAsset(1000)->Key, meshKey.GetValue());
+			ASSERT_EQ(pack.FindAsset(43), nullptr);
+
+			// Only data that gets smaller is stored compressed, blobs stay aligned
+			const AssetPackData* meshData = pack.FindData(meshKey);
+			ASSERT_EQ(meshData->Compression, static_cast<uint32_t>(AssetPackCompression::LZ4));
+			ASSERT_EQ(pack.FindData(sceneKey)->Compression, static_cast<uint32_t>(AssetPackCompression::None));
+			ASSERT_EQ(meshData->Offset % 16, 0);
+
+			const DerivedData data = pack.LoadData(meshKey);
+			ASSERT_TRUE(data.IsValid());
+			ASSERT_EQ(std::string(reinterpret_cast<const char*>(data.Data), data.Size), compressible);
+
+			const DerivedData storedData = pack.LoadData(sceneKey);
+			ASSERT_EQ(std::string(reinterpret_cast<const char*>(storedData.Data), storedData.Size), incompressible);
+
+			ASSERT_FALSE(pack.LoadData(DerivedDataKey("Test", 2)).IsValid());
+		}
+
+		std::filesystem::remove(filepath);
+	}
+}
@@ -0,0 +1,81 @@
+#include "Test.h"
+
+#include "Asset/AssetRegistryJournal.h"
+
+namespace Eppo
+{
+	TEST(AssetRegistryJournalTest, Replay)
+	{
+		const std::filesystem::path filepath = std::filesystem::temp_directory_path() / "AssetRegistryJournalTest.journal";
+		AssetRegistryJournal::Clear(filepath);
+
+		AssetMetadata mesh;
+		mesh.Handle = 1;
+		mesh.Type = AssetType::Mesh;
+		mesh.Filepath = "Meshes/Cube.glb";
+
+		AssetMetadata scene;
+		scene.Handle = 2;
+		scene.Type = AssetType::Scene;
+		scene.Filepath = "Scenes/Main.epscene";
+
+		ASSERT_TRUE(AssetRegistryJournal::Append(filepath, AssetRegistryOperation::Add, mesh));
+		ASSERT_TRUE(AssetRegistryJournal::Append(filepath, AssetRegistryOperation::Add, scene));
+		ASSERT_TRUE(AssetRegistryJournal::Append(filepath, AssetRegistryOperation::Remove, mesh));
+
+		std::map<AssetHandle, AssetMetadata> registry;
+		ASSERT_EQ(AssetRegistryJournal::Replay(filepath, registry), 3);
+		ASSERT_EQ(registry.size(), 1);
+		ASSERT_EQ(registry.at(2).Filepath, scene.Filepath);
+		ASSERT_EQ(registry.at(2).Type, AssetType::Scene);
+
+		// A record cut short by a crash is dropped, the ones before it still apply
+		const uintmax_t completeSize = std::filesystem::file_size(filepath);
+		{
+			std::ofstream stream(filepath, std::ios::binary | std::ios::app);
+			stream.write("\x03\x00\x00", 3);
+		}
+
+		registry.clear();
+		ASSERT_EQ(AssetRegistryJournal::Replay(filepath, registry), 3);
+		ASSERT_EQ(registry.size(), 1);
+		ASSERT_EQ(std::filesystem::file_size(filepath), completeSize);
+
+		// Changes made after the crash are appended behind the last complete record and replay as well
+		ASSERT_TRUE(AssetRegistryJournal::Append(filepath, AssetRegistryOperation::Add, mesh));
+
+		registry.clear();
+		ASSERT_EQ(AssetRegistryJournal::Replay(filepath, registry), 4);
+		ASSERT_EQ(registry.size(), 2);
+		ASSERT_EQ(registry.at(1).Filepath, mesh.Filepath);
+
+		AssetRegistryJournal::Clear(filepath);
+	}
+
+	TEST(AssetRegistryJournalTest, Index)
+	{
+		const std::filesystem::path filepath = std::filesystem::temp_directory_path() / "AssetRegistryJournalTest.index";
+
+		std::map<AssetHandle, AssetMetadata> registry;
+		for (uint64_t i = 1; i <= 100; i++)
+		{
+			AssetMetadata& metadata = registry[i];
+			metadata.Handle = i;
+			metadata.Type = AssetType::Mesh;
+			metadata.Filepath = "Meshes/Mesh" + std::to_string(i) + ".glb";
+		}
+
+		ASSERT_TRUE(AssetRegistryIndex::Write(filepath, 1234, registry));
+
+		// Written for other registry contents
+		std::map<AssetHandle, AssetMetadata> loaded;
+		ASSERT_FALSE(AssetRegistryIndex::Read(filepath, 4321, loaded));
+		ASSERT_TRUE(loaded.empty());
+
+		ASSERT_TRUE(AssetRegistryIndex::Read(filepath, 1234, loaded));
+		ASSERT_EQ(loaded.size(), registry.size());
+		ASSERT_EQ(loaded.at(42).Filepath, registry.at(42).Filepath);
+
+		std::filesystem::remove(filepath);
+	}
+}
@@ -0,0 +1,36 @@
+#include "Test.h"
+
+#include "Core/Compression.h"
+
+namespace Eppo
+{
+	TEST(CompressionTest, LZ4RoundTrip)
+	{
+		std::vector<uint8_t> data;
+		for (uint32_t i = 0; i < 100000; i++)
+			data.push_back(static_cast<uint8_t>((i % 251) ^ (i / 1000)));
+
+		const std::vector<uint8_t> compressed = Compression::CompressLZ4(data.data(), data.size());
+		ASSERT_LT(compressed.size(), data.size() / 4);
+
+		std::vector<uint8_t> decompressed(data.size());
+		ASSERT_TRUE(Compression::DecompressLZ4(compressed.data(), compressed.size(), decompressed.data(), decompressed.size()));
+		ASSERT_EQ(decompressed, data);
+
+		// A wrong size or truncated input is rejected instead of read past
+		ASSERT_FALSE(Compression::DecompressLZ4(compressed.data(), compressed.size(), decompressed.data(), decompressed.size() - 1));
+		ASSERT_FALSE(Compression::DecompressLZ4(compressed.data(), compressed.size() / 2, decompressed.data(), decompressed.size()));
+	}
+
+	TEST(CompressionTest, LZ4SmallInputs)
+	{
+		for (const std::string text : { "", "a", "abcabcabcabc", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa" })
+		{
+			const std::vector<uint8_t> compressed = Compression::CompressLZ4(text.data(), text.size());
+
+			std::string decompressed(text.size(), '\0');
+			ASSERT_TRUE(Compression::DecompressLZ4(compressed.data(), compressed.size(), decompressed.data(), decompressed.size()));
+			ASSERT_EQ(decompressed, text);
+		}
+	}
+}
@@ -0,0 +1,44 @@
+#include "Test.h"
+
+namespace Eppo
+{
+	TEST(FixedTimestepTest, Advance)
+	{
+		FixedTimestep fixedTimestep(50, 4);
+		ASSERT_DOUBLE_EQ(fixedTimestep.GetStep(), 0.02);
+
+		// Frames shorter than a step carry their time over
+		EXPECT_EQ(fixedTimestep.Advance(0.015), 0);
+		EXPECT_NEAR(fixedTimestep.GetAlpha(), 0.75f, 1e-5f);
+
+		EXPECT_EQ(fixedTimestep.Advance(0.015), 1);
+		EXPECT_NEAR(fixedTimestep.GetAlpha(), 0.5f, 1e-5f);
+		EXPECT_NEAR(fixedTimestep.GetTime(), 0.02, 1e-12);
+
+		EXPECT_EQ(fixedTimestep.Advance(0.05), 3);
+		EXPECT_NEAR(fixedTimestep.GetAlpha(), 0.0f, 1e-5f);
+
+		// A stall takes no more than the maximum steps, the rest of it is dropped
+		EXPECT_EQ(fixedTimestep.Advance(1.005), 4);
+		EXPECT_NEAR(fixedTimestep.GetAlpha(), 0.25f, 1e-5f);
+		EXPECT_NEAR(fixedTimestep.GetTime(), 0.16, 1e-12);
+
+		fixedTimestep.Reset();
+		EXPECT_EQ(fixedTimestep.GetTime(), 0.0);
+		EXPECT_EQ(fixedTimestep.GetAlpha(), 0.0f);
+	}
+
+	TEST(FixedTimestepTest, LongRunning)
+	{
+		FixedTimestep fixedTimestep(60);
+
+		// A day of frames at 144 Hz keeps the simulated time within a step of the real time
+		const double frameTime = 1.0 / 144.0;
+		uint64_t steps = 0;
+		for (uint32_t i = 0; i < 144 * 60 * 60 * 24; i++)
+			steps += fixedTimestep.Advance(frameTime);
+
+		EXPECT_NEAR(static_cast<double>(steps), 60.0 * 60.0 * 60.0 * 24.0, 1.0);
+		EXPECT_NEAR(fixedTimestep.GetTime(), 60.0 * 60.0 * 24.0, fixedTimestep.GetStep());
+	}
+}
@@ -33,4 +33,14 @@ namespace Eppo
 		hash = Hash::GenerateFnv(buffer);
 		EXPECT_EQ(14272954169027804443, hash);
 	}
+
+	TEST(HashTest, GenerateXXH64)
+	{
+		EXPECT_EQ(0xEF46DB3751D8E999, Hash::GenerateXXH64("", 0));
+		EXPECT_EQ(0x44BC2CF5AD770999, Hash::GenerateXXH64("abc", 3));
+
+		// Long enough for the four lane path
+		const std::string text = "Nobody inspects the spammish repetition";
+		EXPECT_EQ(0xFBCEA83C8A378BF1, Hash::GenerateXXH64(text.data(), text.size()));
+	}
 }
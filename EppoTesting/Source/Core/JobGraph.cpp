@@ -0,0 +1,70 @@
+#include "Test.h"
+
+#include "Core/JobGraph.h"
+
+namespace Eppo
+{
+	TEST(JobGraphTest, Dependencies)
+	{
+		for (const uint32_t threadCount : { 0u, 1u, 4u })
+		{
+			ThreadPool threadPool(threadCount);
+
+			// A diamond, the last job sees the results of both jobs in the middle
+			std::atomic<uint32_t> value = 0;
+			uint32_t left = 0;
+			uint32_t right = 0;
+			uint32_t result = 0;
+
+			JobGraph graph;
+			const JobId first = graph.Add([&value]() { value = 1; });
+			const JobId leftId = graph.Add([&]() { left = value + 1; }, { first });
+			const JobId rightId = graph.Add([&]() { right = value + 2; }, { first });
+			graph.Add([&]() { result = left + right; }, { leftId, rightId });
+
+			// Graphs can run again
+			for (uint32_t run = 0; run < 3; run++)
+			{
+				result = 0;
+				graph.Run(threadPool);
+				ASSERT_EQ(result, 5);
+			}
+		}
+	}
+
+	TEST(JobGraphTest, MainThread)
+	{
+		ThreadPool threadPool(4);
+
+		const std::thread::id mainThread = std::this_thread::get_id();
+		std::atomic<uint32_t> mainThreadCount = 0;
+
+		JobGraph graph;
+		for (uint32_t i = 0; i < 64; i++)
+		{
+			const JobId worker = graph.Add([]() {});
+			graph.Add([&]() { mainThreadCount += std::this_thread::get_id() == mainThread; }, { worker }, true);
+		}
+
+		graph.Run(threadPool);
+		ASSERT_EQ(mainThreadCount, 64);
+	}
+
+	TEST(JobGraphTest, IgnoresUnrelatedJobs)
+	{
+		ThreadPool threadPool(1);
+
+		const std::thread::id mainThread = std::this_thread::get_id();
+		std::thread::id unrelatedThread;
+		std::future<void> unrelated;
+
+		// A main thread job queues work of its own, as asset loads from scripts do, while the graph is still busy
+		JobGraph graph;
+		graph.Add([]() { std::this_thread::sleep_for(std::chrono::milliseconds(20)); });
+		graph.Add([&]() { unrelated = threadPool.SubmitAsync([&unrelatedThread]() { unrelatedThread = std::this_thread::get_id(); }); }, {}, true);
+
+		graph.Run(threadPool);
+		unrelated.wait();
+		ASSERT_NE(unrelatedThread, mainThread);
+	}
+}
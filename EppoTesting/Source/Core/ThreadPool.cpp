@@ -0,0 +1,62 @@
+#include "Test.h"
+
+#include "Core/ThreadPool.h"
+
+#include <atomic>
+
+namespace Eppo
+{
+	TEST(ThreadPoolTest, ParallelFor)
+	{
+		// No workers runs everything on the calling thread
+		for (const uint32_t threadCount : { 0u, 1u, 4u })
+		{
+			ThreadPool threadPool(threadCount);
+
+			std::vector<uint32_t> calls(1000, 0);
+			threadPool.ParallelFor(static_cast<uint32_t>(calls.size()), [&calls](const uint32_t index) { calls[index]++; });
+
+			for (const uint32_t count : calls)
+				ASSERT_EQ(count, 1);
+		}
+	}
+
+	TEST(ThreadPoolTest, NestedParallelFor)
+	{
+		ThreadPool threadPool(2);
+
+		std::atomic<uint32_t> sum = 0;
+		threadPool.ParallelFor(16, [&](const uint32_t)
+		{
+			threadPool.ParallelFor(16, [&sum](const uint32_t index) { sum += index; });
+		});
+
+		ASSERT_EQ(sum, 16 * 120);
+	}
+
+	TEST(ThreadPoolTest, Submit)
+	{
+		std::atomic<uint32_t> count = 0;
+
+		{
+			ThreadPool threadPool(2);
+			for (uint32_t i = 0; i < 100; i++)
+				threadPool.Submit([&count]() { count++; });
+		}
+
+		// Queued jobs finish before the workers stop
+		ASSERT_EQ(count, 100);
+	}
+
+	TEST(ThreadPoolTest, SubmitAsync)
+	{
+		ThreadPool threadPool(2);
+
+		std::future<uint32_t> result = threadPool.SubmitAsync([]() { return 42u; });
+		ASSERT_EQ(result.get(), 42);
+
+		// Exceptions reach the caller through the future
+		std::future<void> failure = threadPool.SubmitAsync([]() { throw std::runtime_error("failed"); });
+		ASSERT_THROW(failure.get(), std::runtime_error);
+	}
+}
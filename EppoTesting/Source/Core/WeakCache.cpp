@@ -0,0 +1,41 @@
+#include "Test.h"
+
+namespace Eppo
+{
+	TEST(WeakCacheTest, SharesLiveValues)
+	{
+		WeakCache<uint64_t, int> cache;
+		EXPECT_EQ(cache.Find(1), nullptr);
+
+		const Ref<int> value = cache.Insert(1, CreateRef<int>(10));
+		EXPECT_EQ(cache.Find(1), value);
+
+		// A value inserted under a key that is still in use loses to the shared one
+		EXPECT_EQ(cache.Insert(1, CreateRef<int>(20)), value);
+		EXPECT_EQ(*cache.Find(1), 10);
+	}
+
+	TEST(WeakCacheTest, DoesNotOwnValues)
+	{
+		WeakCache<uint64_t, int> cache;
+		cache.Insert(1, CreateRef<int>(10));
+		EXPECT_EQ(cache.Find(1), nullptr);
+
+		// Released values are replaced
+		const Ref<int> value = cache.Insert(1, CreateRef<int>(20));
+		EXPECT_EQ(cache.Find(1), value);
+	}
+
+	TEST(WeakCacheTest, DropsReleasedEntries)
+	{
+		WeakCache<uint64_t, int> cache;
+
+		const Ref<int> kept = cache.Insert(0, CreateRef<int>(0));
+		for (uint64_t i = 1; i < 1000; i++)
+			cache.Insert(i, CreateRef<int>(static_cast<int>(i)));
+
+		// Released entries are dropped as the table grows, so it does not keep every key ever inserted
+		EXPECT_LT(cache.GetEntryCount(), 200);
+		EXPECT_EQ(cache.Find(0), kept);
+	}
+}
@@ -0,0 +1,78 @@
+#include "Test.h"
+
+#include "Physics/PhysicsWorld.h"
+
+namespace Eppo
+{
+	TEST(PhysicsWorldTest, SharedShapes)
+	{
+		PhysicsWorld world;
+
+		for (uint32_t i = 0; i < 100; i++)
+			world.AddBody(static_cast<entt::entity>(i), glm::vec3(static_cast<float>(i) * 3.0f, 0.0f, 0.0f), glm::quat(), glm::vec3(i % 2 == 0 ? 0.5f : 1.0f), 1.0f);
+
+		EXPECT_EQ(world.GetBodyCount(), 100);
+		EXPECT_EQ(world.GetShapeCount(), 2);
+	}
+
+	TEST(PhysicsWorldTest, MovedBodies)
+	{
+		PhysicsWorld world;
+
+		const auto ground = static_cast<entt::entity>(0);
+		const auto falling = static_cast<entt::entity>(1);
+		world.AddBody(ground, glm::vec3(0.0f, -1.0f, 0.0f), glm::quat(), glm::vec3(50.0f, 1.0f, 50.0f), 0.0f);
+		btRigidBody* body = world.AddBody(falling, glm::vec3(0.0f, 5.0f, 0.0f), glm::quat(), glm::vec3(0.5f), 1.0f);
+
+		// Static bodies are never reported, falling ones are
+		world.Step(1.0f / 60.0f);
+		ASSERT_EQ(world.GetMovedBodies().size(), 1);
+		EXPECT_EQ(world.GetMovedBodies()[0].Entity, falling);
+		EXPECT_LT(world.GetMovedBodies()[0].Translation.y, 5.0f);
+
+		// Once at rest on the ground the body falls asleep and drops out
+		for (uint32_t i = 0; i < 600 && !world.GetMovedBodies().empty(); i++)
+			world.Step(1.0f / 60.0f);
+
+		EXPECT_TRUE(world.GetMovedBodies().empty());
+
+		// An impulse wakes it up again
+		world.ApplyCentralImpulse(body, glm::vec3(0.0f, 5.0f, 0.0f));
+		world.Step(1.0f / 60.0f);
+		EXPECT_EQ(world.GetMovedBodies().size(), 1);
+	}
+
+	TEST(PhysicsWorldTest, Threaded)
+	{
+		PhysicsWorld world(true);
+		ASSERT_TRUE(world.IsThreaded());
+
+		const auto falling = static_cast<entt::entity>(1);
+		world.AddBody(static_cast<entt::entity>(0), glm::vec3(0.0f, -1.0f, 0.0f), glm::quat(), glm::vec3(50.0f, 1.0f, 50.0f), 0.0f);
+		btRigidBody* body = world.AddBody(falling, glm::vec3(0.0f, 5.0f, 0.0f), glm::quat(), glm::vec3(0.5f), 1.0f);
+
+		// Results trail by a step, the first one is still running when Step returns
+		world.Step(1.0f / 60.0f);
+		EXPECT_TRUE(world.GetMovedBodies().empty());
+
+		world.Step(1.0f / 60.0f);
+		ASSERT_EQ(world.GetMovedBodies().size(), 1);
+		EXPECT_EQ(world.GetMovedBodies()[0].Entity, falling);
+
+		for (uint32_t i = 0; i < 600 && !world.GetMovedBodies().empty(); i++)
+			world.Step(1.0f / 60.0f);
+
+		EXPECT_TRUE(world.GetMovedBodies().empty());
+
+		// The queued impulse goes in before the next step, whose poses the step after publishes
+		world.ApplyCentralImpulse(body, glm::vec3(0.0f, 5.0f, 0.0f));
+		world.Step(1.0f / 60.0f);
+		world.Step(1.0f / 60.0f);
+		EXPECT_EQ(world.GetMovedBodies().size(), 1);
+
+		// Removed bodies leave the published poses as well
+		world.RemoveBody(body);
+		EXPECT_TRUE(world.GetMovedBodies().empty());
+		EXPECT_EQ(world.GetBodyCount(), 1);
+	}
+}
@@ -0,0 +1,56 @@
+#include "Test.h"
+
+namespace Eppo
+{
+	TEST(DynamicResolutionTest, Disabled)
+	{
+		DynamicResolution drs;
+
+		for (uint32_t i = 0; i < 100; i++)
+			EXPECT_FLOAT_EQ(1.0f, drs.Update(50.0f));
+	}
+
+	TEST(DynamicResolutionTest, WithinHysteresis)
+	{
+		DynamicResolutionSpecification spec;
+		spec.Enabled = true;
+		spec.TargetFrameTime = 10.0f;
+		DynamicResolution drs(spec);
+
+		for (uint32_t i = 0; i < 100; i++)
+			EXPECT_FLOAT_EQ(1.0f, drs.Update(10.5f));
+	}
+
+	TEST(DynamicResolutionTest, SettleFrames)
+	{
+		DynamicResolutionSpecification spec;
+		spec.Enabled = true;
+		spec.TargetFrameTime = 10.0f;
+		spec.SettleFrames = 4;
+		DynamicResolution drs(spec);
+
+		for (uint32_t i = 0; i < 3; i++)
+			EXPECT_FLOAT_EQ(1.0f, drs.Update(20.0f));
+
+		EXPECT_FLOAT_EQ(1.0f - spec.MaxScaleStep, drs.Update(20.0f));
+	}
+
+	TEST(DynamicResolutionTest, ClampToBounds)
+	{
+		DynamicResolutionSpecification spec;
+		spec.Enabled = true;
+		spec.TargetFrameTime = 10.0f;
+		spec.SettleFrames = 1;
+		DynamicResolution drs(spec);
+
+		for (uint32_t i = 0; i < 100; i++)
+			drs.Update(100.0f);
+
+		EXPECT_FLOAT_EQ(spec.MinScale, drs.GetScale());
+
+		for (uint32_t i = 0; i < 100; i++)
+			drs.Update(1.0f);
+
+		EXPECT_FLOAT_EQ(spec.MaxScale, drs.GetScale());
+	}
+}
@@ -0,0 +1,45 @@
+#include "Test.h"
+
+namespace Eppo
+{
+	TEST(GPUProfilerTest, CalculateStatistics)
+	{
+		std::vector<float> samples;
+		for (uint32_t i = 1; i <= 100; i++)
+			samples.push_back(static_cast<float>(i));
+
+		const TimingStatistics stats = GPUProfiler::CalculateStatistics(samples);
+		EXPECT_EQ(100, stats.SampleCount);
+		EXPECT_FLOAT_EQ(1.0f, stats.Min);
+		EXPECT_FLOAT_EQ(100.0f, stats.Max);
+		EXPECT_FLOAT_EQ(50.5f, stats.Average);
+		EXPECT_FLOAT_EQ(95.0f, stats.P95);
+		EXPECT_FLOAT_EQ(99.0f, stats.P99);
+	}
+
+	TEST(GPUProfilerTest, HistoryWrapsAround)
+	{
+		GPUProfiler profiler(4);
+
+		for (uint32_t i = 1; i <= 6; i++)
+		{
+			profiler.BeginFrame(i);
+			profiler.AddTiming("Geometry", static_cast<float>(i));
+		}
+
+		const TimingStatistics stats = profiler.GetStatistics("Geometry");
+		EXPECT_EQ(4, profiler.GetFrameCount());
+		EXPECT_EQ(4, stats.SampleCount);
+		EXPECT_FLOAT_EQ(3.0f, stats.Min);
+		EXPECT_FLOAT_EQ(6.0f, stats.Max);
+		EXPECT_FLOAT_EQ(4.5f, stats.Average);
+	}
+
+	TEST(GPUProfilerTest, UnknownTiming)
+	{
+		GPUProfiler profiler;
+		profiler.BeginFrame(0);
+
+		EXPECT_EQ(0, profiler.GetStatistics("Unknown").SampleCount);
+	}
+}
@@ -0,0 +1,134 @@
+#include "Test.h"
+
+#include "Platform/MappedFile.h"
+#include "Renderer/Mesh/MeshCooker.h"
+
+namespace Eppo
+{
+	TEST(MeshCookerTest, RoundTrip)
+	{
+		const std::string source = "source";
+		const DerivedDataKey key = MeshCooker::GetCacheKey(source.data(), source.size(), VertexFormat::Standard);
+
+		const std::vector<uint8_t> vertices(96, 7);
+		const std::vector<uint8_t> positions(36, 3);
+		const std::vector<uint32_t> indices = { 0, 1, 2 };
+
+		SubmeshData submesh;
+		submesh.Name = "Triangle";
+		submesh.BoundingRadius = 2.0f;
+		submesh.Vertices = { vertices.data(), static_cast<uint32_t>(vertices.size()) };
+		submesh.Positions = { positions.data(), static_cast<uint32_t>(positions.size()) };
+		submesh.Indices = { indices.data(), static_cast<uint32_t>(indices.size() * sizeof(uint32_t)) };
+
+		Primitive& primitive = submesh.Primitives.emplace_back();
+		primitive.VertexCount = 3;
+		primitive.IndexCount = 3;
+		primitive.MaterialIndex = 0;
+
+		MeshCooker cooker(key, VertexFormat::Standard);
+		cooker.AddSubmesh(submesh);
+		cooker.AddMaterial(Material());
+		ASSERT_TRUE(cooker.Write());
+		ASSERT_TRUE(DerivedDataCache::Contains(key, MeshCooker::MeshExtension));
+
+		{
+			const MappedFile file(DerivedDataCache::GetFilepath(key, MeshCooker::MeshExtension));
+			ASSERT_TRUE(file.IsValid());
+
+			// Cooked for a different vertex format
+			ASSERT_EQ(MeshCooker::Validate(file.GetData(), file.GetSize(), key, VertexFormat::Packed), nullptr);
+
+			const CookedMeshHeader* header = MeshCooker::Validate(file.GetData(), file.GetSize(), key, VertexFormat::Standard);
+			ASSERT_NE(header, nullptr);
+			ASSERT_EQ(header->SubmeshCount, 1);
+			ASSERT_EQ(header->PrimitiveCount, 1);
+			ASSERT_EQ(header->MaterialCount, 1);
+
+			const auto* cookedSubmesh = reinterpret_cast<const CookedSubmesh*>(file.GetData() + header->SubmeshOffset);
+			ASSERT_EQ(std::string(reinterpret_cast<const char*>(file.GetData() + cookedSubmesh->Name.Offset), cookedSubmesh->Name.Size), "Triangle");
+			ASSERT_EQ(cookedSubmesh->Vertices.Offset % 16, 0);
+			ASSERT_EQ(cookedSubmesh->Vertices.Size, vertices.size());
+			ASSERT_EQ(std::memcmp(file.GetData() + cookedSubmesh->Indices.Offset, indices.data(), cookedSubmesh->Indices.Size), 0);
+
+			const auto* cookedPrimitive = reinterpret_cast<const CookedPrimitive*>(file.GetData() + header->PrimitiveOffset);
+			ASSERT_EQ(cookedPrimitive->IndexCount, 3);
+			ASSERT_EQ(cookedPrimitive->MaterialIndex, 0);
+
+			// A changed source gives a different key, which the entry does not match
+			const std::string changedSource = "changed source";
+			ASSERT_EQ(MeshCooker::Validate(file.GetData(), file.GetSize(), MeshCooker::GetCacheKey(changedSource.data(), changedSource.size(), VertexFormat::Standard), VertexFormat::Standard), nullptr);
+		}
+
+		ASSERT_TRUE(DerivedDataCache::Remove(key, MeshCooker::MeshExtension));
+	}
+
+	TEST(MeshCookerTest, CacheKeys)
+	{
+		const std::string source = "source";
+
+		// Keys only depend on contents and settings, so they are stable across machines
+		ASSERT_EQ(MeshCooker::GetCacheKey(source.data(), source.size(), VertexFormat::Standard), MeshCooker::GetCacheKey(source.data(), source.size(), VertexFormat::Standard));
+		ASSERT_NE(MeshCooker::GetCacheKey(source.data(), source.size(), VertexFormat::Standard), MeshCooker::GetCacheKey(source.data(), source.size(), VertexFormat::Packed));
+		ASSERT_NE(MeshCooker::GetCacheKey(source.data(), source.size(), VertexFormat::Standard), MeshCooker::GetTextureCacheKey(source.data(), source.size()));
+		ASSERT_EQ(MeshCooker::GetTextureCacheKey(source.data(), source.size()).ToString().size(), 16);
+	}
+
+	TEST(MeshCookerTest, CorruptRanges)
+	{
+		const std::string source = "corrupt ranges";
+		const DerivedDataKey key = MeshCooker::GetCacheKey(source.data(), source.size(), VertexFormat::Standard);
+
+		const std::vector<uint8_t> vertices(96, 7);
+		const std::vector<uint8_t> positions(36, 3);
+		const std::vector<uint32_t> indices = { 0, 1, 2, 0, 2, 1 };
+
+		SubmeshData submesh;
+		submesh.Vertices = { vertices.data(), static_cast<uint32_t>(vertices.size()) };
+		submesh.Positions = { positions.data(), static_cast<uint32_t>(positions.size()) };
+		submesh.Indices = { indices.data(), static_cast<uint32_t>(indices.size() * sizeof(uint32_t)) };
+
+		Primitive& primitive = submesh.Primitives.emplace_back();
+		primitive.VertexCount = 3;
+		primitive.IndexCount = 3;
+		primitive.Lods.push_back({ 3, 3, 0.5f });
+
+		MeshCooker cooker(key, VertexFormat::Standard);
+		cooker.AddSubmesh(submesh);
+		ASSERT_TRUE(cooker.Write());
+
+		std::vector<uint8_t> cooked;
+		{
+			const MappedFile file(DerivedDataCache::GetFilepath(key, MeshCooker::MeshExtension));
+			ASSERT_TRUE(file.IsValid());
+			cooked.assign(file.GetData(), file.GetData() + file.GetSize());
+		}
+
+		ASSERT_TRUE(DerivedDataCache::Remove(key, MeshCooker::MeshExtension));
+
+		const auto* header = MeshCooker::Validate(cooked.data(), cooked.size(), key, VertexFormat::Standard);
+		ASSERT_NE(header, nullptr);
+
+		// Every corruption is applied to a copy of the valid file on its own
+		const auto isRejected = [&](const std::function<void(CookedSubmesh&, CookedPrimitive&)>& corrupt)
+		{
+			std::vector<uint8_t> data = cooked;
+			auto& cookedSubmesh = *reinterpret_cast<CookedSubmesh*>(data.data() + header->SubmeshOffset);
+			auto& cookedPrimitive = *reinterpret_cast<CookedPrimitive*>(data.data() + header->PrimitiveOffset);
+			corrupt(cookedSubmesh, cookedPrimitive);
+
+			return MeshCooker::Validate(data.data(), data.size(), key, VertexFormat::Standard) == nullptr;
+		};
+
+		ASSERT_FALSE(isRejected([](CookedSubmesh&, CookedPrimitive&) {}));
+		ASSERT_TRUE(isRejected([](CookedSubmesh&, CookedPrimitive& p) { p.VertexCount = 4; }));
+		ASSERT_TRUE(isRejected([](CookedSubmesh&, CookedPrimitive& p) { p.FirstVertex = 0xFFFFFFFF; }));
+		ASSERT_TRUE(isRejected([](CookedSubmesh&, CookedPrimitive& p) { p.FirstIndex = 4; }));
+		ASSERT_TRUE(isRejected([](CookedSubmesh&, CookedPrimitive& p) { p.IndexCount = 7; }));
+		ASSERT_TRUE(isRejected([](CookedSubmesh&, CookedPrimitive& p) { p.Lods[0].IndexCount = 4; }));
+		ASSERT_TRUE(isRejected([](CookedSubmesh&, CookedPrimitive& p) { p.LodCount = Primitive::MaxLods; }));
+		ASSERT_TRUE(isRejected([](CookedSubmesh& s, CookedPrimitive&) { s.Vertices.Size = 95; }));
+		ASSERT_TRUE(isRejected([](CookedSubmesh& s, CookedPrimitive&) { s.Positions.Size = 24; }));
+		ASSERT_TRUE(isRejected([](CookedSubmesh& s, CookedPrimitive&) { s.Indices.Size = 22; }));
+	}
+}
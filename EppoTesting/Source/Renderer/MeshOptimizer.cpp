@@ -0,0 +1,108 @@
+#include "Test.h"
+
+#include "Renderer/Mesh/MeshOptimizer.h"
+
+#include <random>
+
+namespace Eppo
+{
+	namespace Utils
+	{
+		// Grid with its triangles in random order, the worst case for the vertex cache
+		static void CreateShuffledGrid(const uint32_t size, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices)
+		{
+			for (uint32_t y = 0; y <= size; y++)
+			{
+				for (uint32_t x = 0; x <= size; x++)
+					vertices.emplace_back(glm::vec3(static_cast<float>(x), 0.0f, static_cast<float>(y)));
+			}
+
+			std::vector<std::array<uint32_t, 3>> triangles;
+			for (uint32_t y = 0; y < size; y++)
+			{
+				for (uint32_t x = 0; x < size; x++)
+				{
+					const uint32_t i = y * (size + 1) + x;
+					triangles.push_back({ i, i + size + 1, i + 1 });
+					triangles.push_back({ i + 1, i + size + 1, i + size + 2 });
+				}
+			}
+
+			std::mt19937 engine(1);
+			std::shuffle(triangles.begin(), triangles.end(), engine);
+
+			for (const auto& triangle : triangles)
+				indices.insert(indices.end(), triangle.begin(), triangle.end());
+		}
+
+		// Triangles as sorted position triplets, independent of triangle order and vertex numbering
+		static std::vector<std::array<float, 9>> GetTriangleSet(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices)
+		{
+			std::vector<std::array<float, 9>> triangles;
+
+			for (size_t i = 0; i < indices.size(); i += 3)
+			{
+				std::array<std::array<float, 3>, 3> corners;
+				for (uint32_t c = 0; c < 3; c++)
+				{
+					const glm::vec3& p = vertices[indices[i + c]].Position;
+					corners[c] = { p.x, p.y, p.z };
+				}
+
+				std::sort(corners.begin(), corners.end());
+				triangles.push_back({ corners[0][0], corners[0][1], corners[0][2], corners[1][0], corners[1][1], corners[1][2], corners[2][0], corners[2][1], corners[2][2] });
+			}
+
+			std::sort(triangles.begin(), triangles.end());
+			return triangles;
+		}
+	}
+
+	TEST(MeshOptimizerTest, OptimizeVertexCache)
+	{
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+		Utils::CreateShuffledGrid(32, vertices, indices);
+
+		const auto before = MeshOptimizer::AnalyzeVertexCache(indices.data(), indices.size(), vertices.size());
+		const auto triangles = Utils::GetTriangleSet(vertices, indices);
+
+		MeshOptimizer::OptimizeVertexCache(indices.data(), indices.size(), vertices.size());
+		MeshOptimizer::OptimizeOverdraw(indices.data(), indices.size(), vertices.data(), vertices.size());
+
+		const auto after = MeshOptimizer::AnalyzeVertexCache(indices.data(), indices.size(), vertices.size());
+
+		ASSERT_EQ(before.Triangles, after.Triangles);
+		ASSERT_EQ(before.Vertices, after.Vertices);
+		ASSERT_LT(after.GetACMR(), before.GetACMR());
+		ASSERT_LT(after.GetACMR(), 1.0f);
+		ASSERT_EQ(triangles, Utils::GetTriangleSet(vertices, indices));
+	}
+
+	TEST(MeshOptimizerTest, OptimizeVertexFetch)
+	{
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+		Utils::CreateShuffledGrid(8, vertices, indices);
+
+		// Unused vertex at the end gets dropped
+		vertices.emplace_back(glm::vec3(-1.0f));
+
+		const auto triangles = Utils::GetTriangleSet(vertices, indices);
+		const size_t vertexCount = MeshOptimizer::OptimizeVertexFetch(vertices.data(), vertices.size(), indices.data(), indices.size());
+
+		ASSERT_EQ(vertexCount, vertices.size() - 1);
+		vertices.resize(vertexCount);
+
+		// Vertices are numbered in order of first use
+		uint32_t next = 0;
+		for (const uint32_t index : indices)
+		{
+			ASSERT_LE(index, next);
+			if (index == next)
+				next++;
+		}
+
+		ASSERT_EQ(triangles, Utils::GetTriangleSet(vertices, indices));
+	}
+}
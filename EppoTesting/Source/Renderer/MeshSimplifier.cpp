@@ -0,0 +1,99 @@
+#include "Test.h"
+
+#include "Renderer/Mesh/MeshSimplifier.h"
+
+namespace Eppo
+{
+	namespace Utils
+	{
+		// Grid of (size + 1)^2 vertices on the XZ plane, optionally with bumps
+		static void CreateGrid(const uint32_t size, const bool bumpy, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices)
+		{
+			for (uint32_t y = 0; y <= size; y++)
+			{
+				for (uint32_t x = 0; x <= size; x++)
+				{
+					const float u = static_cast<float>(x) / static_cast<float>(size);
+					const float v = static_cast<float>(y) / static_cast<float>(size);
+
+					Vertex& vertex = vertices.emplace_back();
+					vertex.Position = glm::vec3(u, bumpy ? 0.1f * std::sin(u * 12.0f) * std::sin(v * 12.0f) : 0.0f, v);
+					vertex.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
+					vertex.TexCoord = glm::vec2(u, v);
+				}
+			}
+
+			for (uint32_t y = 0; y < size; y++)
+			{
+				for (uint32_t x = 0; x < size; x++)
+				{
+					const uint32_t i = y * (size + 1) + x;
+					indices.insert(indices.end(), { i, i + size + 1, i + 1, i + 1, i + size + 1, i + size + 2 });
+				}
+			}
+		}
+	}
+
+	TEST(MeshSimplifierTest, FlatGridHasNoError)
+	{
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+		Utils::CreateGrid(16, false, vertices, indices);
+
+		MeshSimplifierSpecification spec;
+		spec.TargetIndexCount = indices.size() / 4;
+
+		float error = -1.0f;
+		const std::vector<uint32_t> result = MeshSimplifier::Simplify(vertices.data(), vertices.size(), indices.data(), indices.size(), spec, &error);
+
+		ASSERT_FALSE(result.empty());
+		ASSERT_LE(result.size(), spec.TargetIndexCount);
+		ASSERT_EQ(result.size() % 3, 0);
+		ASSERT_NEAR(error, 0.0f, 0.0001f);
+
+		for (const uint32_t index : result)
+			ASSERT_LT(index, vertices.size());
+	}
+
+	TEST(MeshSimplifierTest, BorderIsPreserved)
+	{
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+		Utils::CreateGrid(8, false, vertices, indices);
+
+		MeshSimplifierSpecification spec;
+		spec.TargetIndexCount = 0;
+		spec.MaxError = 0.001f;
+
+		const std::vector<uint32_t> result = MeshSimplifier::Simplify(vertices.data(), vertices.size(), indices.data(), indices.size(), spec);
+
+		// Straight borders collapse, but all four corners have to survive
+		ASSERT_LT(result.size(), indices.size());
+
+		for (const uint32_t corner : { 0u, 8u, 72u, 80u })
+			ASSERT_NE(std::find(result.begin(), result.end(), corner), result.end());
+	}
+
+	TEST(MeshSimplifierTest, MaxErrorLimitsSimplification)
+	{
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+		Utils::CreateGrid(32, true, vertices, indices);
+
+		MeshSimplifierSpecification spec;
+		spec.TargetIndexCount = 0;
+		spec.MaxError = 0.001f;
+
+		float strictError = 0.0f;
+		const std::vector<uint32_t> strict = MeshSimplifier::Simplify(vertices.data(), vertices.size(), indices.data(), indices.size(), spec, &strictError);
+
+		spec.MaxError = 0.1f;
+
+		float looseError = 0.0f;
+		const std::vector<uint32_t> loose = MeshSimplifier::Simplify(vertices.data(), vertices.size(), indices.data(), indices.size(), spec, &looseError);
+
+		ASSERT_LE(strictError, 0.001f);
+		ASSERT_LE(looseError, 0.1f);
+		ASSERT_LT(loose.size(), strict.size());
+	}
+}
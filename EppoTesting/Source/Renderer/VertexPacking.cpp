@@ -0,0 +1,103 @@
+#include "Test.h"
+
+#include "Renderer/Mesh/VertexPacking.h"
+
+#include <glm/gtc/packing.hpp>
+
+namespace Eppo
+{
+	TEST(VertexPackingTest, Strides)
+	{
+		ASSERT_EQ(VertexPacking::GetLayout(VertexFormat::Standard).GetStride(), sizeof(Vertex));
+		ASSERT_EQ(VertexPacking::GetLayout(VertexFormat::Packed).GetStride(), sizeof(PackedVertex));
+		ASSERT_EQ(VertexPacking::GetLayout(VertexFormat::PackedQuantized).GetStride(), sizeof(QuantizedVertex));
+
+		ASSERT_EQ(VertexPacking::GetPositionLayout(VertexFormat::Standard).GetStride(), 12);
+		ASSERT_EQ(VertexPacking::GetPositionLayout(VertexFormat::PackedQuantized).GetStride(), 8);
+	}
+
+	TEST(VertexPackingTest, LayoutEquality)
+	{
+		// Formats that stream positions the same way can share a depth pipeline, only the quantized one differs
+		EXPECT_EQ(VertexPacking::GetPositionLayout(VertexFormat::Standard), VertexPacking::GetPositionLayout(VertexFormat::Packed));
+		EXPECT_NE(VertexPacking::GetPositionLayout(VertexFormat::Standard), VertexPacking::GetPositionLayout(VertexFormat::PackedQuantized));
+
+		EXPECT_NE(VertexPacking::GetLayout(VertexFormat::Standard), VertexPacking::GetLayout(VertexFormat::Packed));
+		EXPECT_NE(VertexPacking::GetLayout(VertexFormat::Packed), VertexPacking::GetLayout(VertexFormat::PackedQuantized));
+
+		// Equal strides are not enough, the elements have to match as well
+		const VertexBufferLayout floats = { { ShaderDataType::Float3, "inPosition" } };
+		const VertexBufferLayout halves = { { ShaderDataType::Half2, "inPosition" }, { ShaderDataType::Float2, "inTexCoord" } };
+		const VertexBufferLayout normalized = { { ShaderDataType::UShort4, "inPosition", true } };
+		const VertexBufferLayout unnormalized = { { ShaderDataType::UShort4, "inPosition" } };
+		ASSERT_EQ(floats.GetStride(), halves.GetStride());
+		EXPECT_NE(floats, halves);
+		EXPECT_NE(normalized, unnormalized);
+
+		// Names are only for readability
+		EXPECT_EQ(floats, VertexBufferLayout({ { ShaderDataType::Float3, "inPos" } }));
+	}
+
+	TEST(VertexPackingTest, OctahedralNormals)
+	{
+		// Points on a sphere including the poles and the octahedron edges
+		for (int32_t i = -8; i <= 8; i++)
+		{
+			for (int32_t j = 0; j < 16; j++)
+			{
+				const float theta = static_cast<float>(i) / 8.0f * 1.5707964f;
+				const float phi = static_cast<float>(j) / 16.0f * 6.2831855f;
+				const glm::vec3 normal(std::cos(theta) * std::cos(phi), std::cos(theta) * std::sin(phi), std::sin(theta));
+
+				const glm::vec2 encoded = VertexPacking::EncodeOctahedral(normal);
+				ASSERT_LE(std::abs(encoded.x), 1.0f);
+				ASSERT_LE(std::abs(encoded.y), 1.0f);
+
+				// Through snorm16, like the GPU reads them
+				const glm::vec2 quantized(glm::unpackSnorm1x16(glm::packSnorm1x16(encoded.x)), glm::unpackSnorm1x16(glm::packSnorm1x16(encoded.y)));
+				ASSERT_GT(glm::dot(VertexPacking::DecodeOctahedral(quantized), normal), 0.99999f);
+			}
+		}
+	}
+
+	TEST(VertexPackingTest, QuantizedPositions)
+	{
+		const glm::vec3 min(-3.0f, 0.0f, 10.0f);
+		const glm::vec3 max(5.0f, 0.0f, 12.0f);
+
+		std::vector<Vertex> vertices;
+		for (uint32_t i = 0; i <= 100; i++)
+		{
+			const float t = static_cast<float>(i) / 100.0f;
+			vertices.emplace_back(min + (max - min) * t * t);
+		}
+
+		const VertexQuantization quantization = VertexPacking::GetQuantization(VertexFormat::PackedQuantized, min, max);
+
+		std::vector<uint8_t> vertexData;
+		std::vector<uint8_t> positionData;
+		VertexPacking::Pack(vertices.data(), vertices.size(), VertexFormat::PackedQuantized, quantization, vertexData, positionData);
+
+		ASSERT_EQ(vertexData.size(), vertices.size() * sizeof(QuantizedVertex));
+		ASSERT_EQ(positionData.size(), vertices.size() * 8);
+
+		const auto* packed = reinterpret_cast<const QuantizedVertex*>(vertexData.data());
+		const auto* positions = reinterpret_cast<const uint16_t*>(positionData.data());
+
+		// Half a quantization step of the largest axis
+		const float tolerance = 8.0f / 65535.0f * 0.5f + 0.00001f;
+
+		for (size_t i = 0; i < vertices.size(); i++)
+		{
+			const glm::vec3 unorm(glm::unpackUnorm1x16(packed[i].Position[0]), glm::unpackUnorm1x16(packed[i].Position[1]), glm::unpackUnorm1x16(packed[i].Position[2]));
+			const glm::vec3 position = quantization.Offset + unorm * quantization.Scale;
+
+			ASSERT_NEAR(position.x, vertices[i].Position.x, tolerance);
+			ASSERT_NEAR(position.y, vertices[i].Position.y, tolerance);
+			ASSERT_NEAR(position.z, vertices[i].Position.z, tolerance);
+
+			// Both streams hold the same positions
+			ASSERT_EQ(std::memcmp(&positions[i * 4], packed[i].Position, sizeof(packed[i].Position)), 0);
+		}
+	}
+}
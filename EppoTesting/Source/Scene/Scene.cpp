@@ -0,0 +1,118 @@
+#include "Test.h"
+
+namespace Eppo
+{
+	TEST(SceneTest, FindEntityByName)
+	{
+		const Ref<Scene> scene = CreateRef<Scene>();
+
+		Entity player = scene->CreateEntity("Player");
+		for (uint32_t i = 0; i < 5; i++)
+			scene->CreateEntity("Enemy");
+
+		EXPECT_EQ(scene->FindEntityByName("Player"), player);
+		EXPECT_EQ(scene->FindEntitiesByName("Enemy").size(), 5);
+		EXPECT_FALSE(scene->FindEntityByName("Camera"));
+		EXPECT_TRUE(scene->FindEntitiesByName("Camera").empty());
+
+		// Renamed entities are found under the new name only
+		player.SetName("Camera");
+		EXPECT_FALSE(scene->FindEntityByName("Player"));
+		EXPECT_EQ(scene->FindEntityByName("Camera"), player);
+
+		Entity enemy = scene->FindEntityByName("Enemy");
+		scene->DestroyEntity(enemy);
+		EXPECT_EQ(scene->FindEntitiesByName("Enemy").size(), 4);
+
+		// The copy has its own lookup, renames in it leave the source as it was
+		const Ref<Scene> copy = Scene::Copy(scene);
+		EXPECT_EQ(copy->FindEntitiesByName("Enemy").size(), 4);
+
+		copy->FindEntityByName("Enemy").SetName("Boss");
+		EXPECT_EQ(copy->FindEntitiesByName("Enemy").size(), 3);
+		EXPECT_EQ(scene->FindEntitiesByName("Enemy").size(), 4);
+		EXPECT_FALSE(scene->FindEntityByName("Boss"));
+	}
+
+	TEST(SceneTest, Copy)
+	{
+		const Ref<Scene> scene = CreateRef<Scene>();
+
+		std::vector<UUID> uuids;
+		for (uint64_t i = 1; i <= 200; i++)
+		{
+			Entity entity = scene->CreateEntityWithUUID(i, "Entity" + std::to_string(i % 10));
+			entity.GetComponent<TransformComponent>().Translation = glm::vec3(static_cast<float>(i), 2.0f, 3.0f);
+
+			if (i % 2 == 0)
+				entity.AddComponent<MeshComponent>().MeshHandle = 1000 + i;
+			if (i % 5 == 0)
+				entity.AddComponent<PointLightComponent>().Color = glm::vec4(static_cast<float>(i), 0.25f, 1.0f, 1.0f);
+			if (i % 10 == 0)
+				entity.AddComponent<RigidBodyComponent>().Mass = static_cast<float>(i);
+
+			uuids.emplace_back(i);
+		}
+
+		// Destroyed entities leave gaps in the handles, recreated ones reuse them
+		for (uint64_t i = 3; i <= 200; i += 7)
+		{
+			scene->DestroyEntity(scene->FindEntityByUUID(i));
+			uuids.erase(std::find(uuids.begin(), uuids.end(), UUID(i)));
+		}
+		for (uint64_t i = 301; i <= 310; i++)
+		{
+			scene->CreateEntityWithUUID(i, "Recreated").AddComponent<PointLightComponent>();
+			uuids.emplace_back(i);
+		}
+
+		// Recycling the same handles once more bumps their versions again, and the last entity leaves a gap at the end
+		for (uint64_t i = 301; i <= 305; i++)
+		{
+			scene->DestroyEntity(scene->FindEntityByUUID(i));
+			uuids.erase(std::find(uuids.begin(), uuids.end(), UUID(i)));
+		}
+		for (uint64_t i = 401; i <= 403; i++)
+		{
+			scene->CreateEntityWithUUID(i, "Recreated").AddComponent<PointLightComponent>().Color = glm::vec4(static_cast<float>(i));
+			uuids.emplace_back(i);
+		}
+		scene->DestroyEntity(scene->FindEntityByUUID(310));
+		uuids.erase(std::find(uuids.begin(), uuids.end(), UUID(310)));
+
+		const Ref<Scene> copy = Scene::Copy(scene);
+
+		for (const UUID uuid : uuids)
+		{
+			Entity lhs = scene->FindEntityByUUID(uuid);
+			Entity rhs = copy->FindEntityByUUID(uuid);
+			ASSERT_TRUE(rhs);
+
+			// Copies keep the handles, so the UUID lookup stays valid
+			EXPECT_EQ(static_cast<EntityHandle>(lhs), static_cast<EntityHandle>(rhs));
+			EXPECT_EQ(rhs.GetUUID(), uuid);
+			EXPECT_EQ(lhs.GetName(), rhs.GetName());
+			EXPECT_EQ(lhs.GetComponent<TransformComponent>().Translation, rhs.GetComponent<TransformComponent>().Translation);
+			EXPECT_EQ(lhs.HasComponent<MeshComponent>(), rhs.HasComponent<MeshComponent>());
+			EXPECT_EQ(lhs.HasComponent<PointLightComponent>(), rhs.HasComponent<PointLightComponent>());
+			EXPECT_EQ(lhs.HasComponent<RigidBodyComponent>(), rhs.HasComponent<RigidBodyComponent>());
+
+			if (lhs.HasComponent<MeshComponent>())
+				EXPECT_EQ(lhs.GetComponent<MeshComponent>().MeshHandle, rhs.GetComponent<MeshComponent>().MeshHandle);
+			if (lhs.HasComponent<PointLightComponent>())
+				EXPECT_EQ(lhs.GetComponent<PointLightComponent>().Color, rhs.GetComponent<PointLightComponent>().Color);
+			if (lhs.HasComponent<RigidBodyComponent>())
+				EXPECT_EQ(lhs.GetComponent<RigidBodyComponent>().Mass, rhs.GetComponent<RigidBodyComponent>().Mass);
+		}
+
+		EXPECT_FALSE(copy->FindEntityByUUID(3));
+		EXPECT_FALSE(copy->FindEntityByUUID(301));
+		EXPECT_FALSE(copy->FindEntityByUUID(310));
+		EXPECT_EQ(copy->FindEntitiesByName("Entity3").size(), scene->FindEntitiesByName("Entity3").size());
+		EXPECT_EQ(copy->FindEntitiesByName("Recreated").size(), 7);
+
+		// The copy owns its components
+		copy->FindEntityByUUID(1).GetComponent<TransformComponent>().Translation = glm::vec3(0.0f);
+		EXPECT_EQ(scene->FindEntityByUUID(1).GetComponent<TransformComponent>().Translation, glm::vec3(1.0f, 2.0f, 3.0f));
+	}
+}
@@ -0,0 +1,161 @@
+#include "Test.h"
+
+#include "Scene/SceneSerializer.h"
+
+namespace Eppo
+{
+	static Ref<Scene> CreateTestScene()
+	{
+		Ref<Scene> scene = CreateRef<Scene>();
+
+		for (uint64_t i = 1; i <= 100; i++)
+		{
+			Entity entity = scene->CreateEntityWithUUID(i, "Entity" + std::to_string(i % 10));
+			entity.GetComponent<TransformComponent>().Translation = glm::vec3(static_cast<float>(i), 2.0f, 3.0f);
+
+			if (i % 2 == 0)
+				entity.AddComponent<MeshComponent>().MeshHandle = 1000 + i;
+			if (i % 5 == 0)
+				entity.AddComponent<PointLightComponent>().Color = glm::vec4(0.5f, 0.25f, 1.0f, 1.0f);
+			if (i % 10 == 0)
+				entity.AddComponent<RigidBodyComponent>().Mass = static_cast<float>(i);
+		}
+
+		Entity camera = scene->CreateEntityWithUUID(500, "Camera");
+		camera.AddComponent<CameraComponent>().Camera.SetOrthographicSize(42.0f);
+
+		return scene;
+	}
+
+	static void ExpectEqualScenes(const Ref<Scene>& expected, const Ref<Scene>& actual)
+	{
+		for (uint64_t i = 1; i <= 100; i++)
+		{
+			Entity lhs = expected->FindEntityByUUID(i);
+			Entity rhs = actual->FindEntityByUUID(i);
+			ASSERT_TRUE(rhs);
+
+			EXPECT_EQ(lhs.GetName(), rhs.GetName());
+			EXPECT_EQ(lhs.GetComponent<TransformComponent>().Translation, rhs.GetComponent<TransformComponent>().Translation);
+			EXPECT_EQ(lhs.HasComponent<MeshComponent>(), rhs.HasComponent<MeshComponent>());
+			EXPECT_EQ(lhs.HasComponent<PointLightComponent>(), rhs.HasComponent<PointLightComponent>());
+
+			if (lhs.HasComponent<MeshComponent>())
+				EXPECT_EQ(lhs.GetComponent<MeshComponent>().MeshHandle, rhs.GetComponent<MeshComponent>().MeshHandle);
+			if (lhs.HasComponent<RigidBodyComponent>())
+				EXPECT_EQ(lhs.GetComponent<RigidBodyComponent>().Mass, rhs.GetComponent<RigidBodyComponent>().Mass);
+		}
+
+		// Loaded entities are found by name as well
+		EXPECT_EQ(actual->FindEntitiesByName("Entity3").size(), 10);
+
+		Entity camera = actual->FindEntityByUUID(500);
+		ASSERT_TRUE(camera);
+		EXPECT_EQ(camera.GetComponent<CameraComponent>().Camera.GetOrthographicSize(), 42.0f);
+	}
+
+	TEST(SceneSerializerTest, BinaryRoundTrip)
+	{
+		const Ref<Scene> scene = CreateTestScene();
+		const std::vector<uint8_t> data = SceneSerializer(scene).SerializeBinaryToMemory("Test");
+		ASSERT_TRUE(SceneSerializer::IsBinary(data.data(), data.size()));
+
+		const Ref<Scene> loaded = CreateRef<Scene>();
+		ASSERT_TRUE(SceneSerializer(loaded).DeserializeFromMemory(std::string_view(reinterpret_cast<const char*>(data.data()), data.size())));
+		ExpectEqualScenes(scene, loaded);
+
+		// Cut short anywhere past the magic, the scene is rejected instead of read out of bounds
+		const Ref<Scene> truncated = CreateRef<Scene>();
+		ASSERT_FALSE(SceneSerializer(truncated).DeserializeFromMemory(std::string_view(reinterpret_cast<const char*>(data.data()), data.size() / 2)));
+	}
+
+	TEST(SceneSerializerTest, DuplicateEntityIndex)
+	{
+		// Mirrors the start of the binary header and the component table layout
+		struct Header
+		{
+			uint32_t Magic, Version, Name, EntityCount, TableCount, StringCount;
+			uint64_t EntityOffset, TableOffset;
+		};
+
+		struct Table
+		{
+			uint32_t Type, Count, Stride, Reserved;
+			uint64_t EntityOffset, DataOffset;
+		};
+
+		std::vector<uint8_t> data = SceneSerializer(CreateTestScene()).SerializeBinaryToMemory("Test");
+
+		Header header;
+		std::memcpy(&header, data.data(), sizeof(Header));
+
+		// Point the second transform at the entity of the first one
+		bool corrupted = false;
+		for (uint32_t i = 0; i < header.TableCount && !corrupted; i++)
+		{
+			Table table;
+			std::memcpy(&table, data.data() + header.TableOffset + i * sizeof(Table), sizeof(Table));
+			if (table.Type != 2 || table.Count < 2)
+				continue;
+
+			std::memcpy(data.data() + table.EntityOffset + sizeof(uint32_t), data.data() + table.EntityOffset, sizeof(uint32_t));
+			corrupted = true;
+		}
+		ASSERT_TRUE(corrupted);
+
+		// The file is rejected and the scene keeps what it had
+		const Ref<Scene> loaded = CreateRef<Scene>();
+		loaded->CreateEntityWithUUID(1000, "Existing");
+
+		ASSERT_FALSE(SceneSerializer(loaded).DeserializeFromMemory(std::string_view(reinterpret_cast<const char*>(data.data()), data.size())));
+		EXPECT_TRUE(loaded->FindEntityByUUID(1000));
+		EXPECT_FALSE(loaded->FindEntityByUUID(1));
+		EXPECT_EQ(loaded->FindEntitiesByName("Entity3").size(), 0);
+	}
+
+	TEST(SceneSerializerTest, LoadReplacesEntities)
+	{
+		const std::filesystem::path yamlFilepath = std::filesystem::temp_directory_path() / "SceneSerializerTestReplace.epscene";
+
+		const Ref<Scene> scene = CreateTestScene();
+		const std::vector<uint8_t> data = SceneSerializer(scene).SerializeBinaryToMemory("Test");
+		ASSERT_TRUE(SceneSerializer(scene).Serialize(yamlFilepath));
+
+		// Either format leaves only the loaded entities, whatever the scene held before
+		const Ref<Scene> binary = CreateRef<Scene>();
+		binary->CreateEntityWithUUID(1000, "Existing");
+		ASSERT_TRUE(SceneSerializer(binary).DeserializeFromMemory(std::string_view(reinterpret_cast<const char*>(data.data()), data.size())));
+
+		const Ref<Scene> yaml = CreateRef<Scene>();
+		yaml->CreateEntityWithUUID(1000, "Existing");
+		ASSERT_TRUE(SceneSerializer(yaml).Deserialize(yamlFilepath));
+
+		for (const Ref<Scene>& loaded : { binary, yaml })
+		{
+			EXPECT_FALSE(loaded->FindEntityByUUID(1000));
+			EXPECT_TRUE(loaded->FindEntitiesByName("Existing").empty());
+			EXPECT_EQ(loaded->GetSpatialIndex().GetProxyCount(), 0);
+			ExpectEqualScenes(scene, loaded);
+		}
+
+		std::filesystem::remove(yamlFilepath);
+	}
+
+	TEST(SceneSerializerTest, Convert)
+	{
+		const std::filesystem::path binaryFilepath = std::filesystem::temp_directory_path() / "SceneSerializerTest.epscene";
+		const std::filesystem::path yamlFilepath = std::filesystem::temp_directory_path() / "SceneSerializerTestYAML.epscene";
+
+		const Ref<Scene> scene = CreateTestScene();
+		ASSERT_TRUE(SceneSerializer(scene).SerializeBinary(binaryFilepath));
+		ASSERT_TRUE(SceneSerializer::ConvertToYAML(binaryFilepath, yamlFilepath));
+		ASSERT_TRUE(SceneSerializer::ConvertToBinary(yamlFilepath, binaryFilepath));
+
+		const Ref<Scene> loaded = CreateRef<Scene>();
+		ASSERT_TRUE(SceneSerializer(loaded).Deserialize(binaryFilepath));
+		ExpectEqualScenes(scene, loaded);
+
+		std::filesystem::remove(binaryFilepath);
+		std::filesystem::remove(yamlFilepath);
+	}
+}
@@ -0,0 +1,180 @@
+#include "Test.h"
+
+#include "Scene/SpatialIndex.h"
+
+#include <random>
+
+namespace Eppo
+{
+	namespace
+	{
+		struct TestScene
+		{
+			std::vector<entt::entity> Entities;
+			std::vector<AABB> Bounds;
+		};
+
+		AABB RandomBox(std::mt19937& random)
+		{
+			std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+			std::uniform_real_distribution<float> size(0.1f, 4.0f);
+
+			const glm::vec3 min(position(random), position(random), position(random));
+			return { min, min + glm::vec3(size(random), size(random), size(random)) };
+		}
+
+		TestScene CreateTestScene(std::mt19937& random, const uint32_t count)
+		{
+			TestScene scene;
+			for (uint32_t i = 0; i < count; i++)
+			{
+				scene.Entities.emplace_back(static_cast<entt::entity>(i));
+				scene.Bounds.emplace_back(RandomBox(random));
+			}
+
+			return scene;
+		}
+
+		template<typename Overlaps>
+		std::vector<entt::entity> BruteForce(const TestScene& scene, const std::vector<bool>& alive, const Overlaps& overlaps)
+		{
+			std::vector<entt::entity> results;
+			for (size_t i = 0; i < scene.Entities.size(); i++)
+			{
+				if (alive[i] && overlaps(scene.Bounds[i]))
+					results.emplace_back(scene.Entities[i]);
+			}
+
+			return results;
+		}
+
+		std::vector<entt::entity> Sorted(std::vector<entt::entity> entities)
+		{
+			std::sort(entities.begin(), entities.end());
+			return entities;
+		}
+	}
+
+	TEST(SpatialIndexTest, Queries)
+	{
+		std::mt19937 random(42);
+		TestScene scene = CreateTestScene(random, 2000);
+		std::vector<bool> alive(scene.Entities.size(), true);
+
+		SpatialIndex index;
+		std::vector<SpatialProxy> proxies;
+		for (size_t i = 0; i < scene.Entities.size(); i++)
+			proxies.emplace_back(index.Insert(scene.Entities[i], scene.Bounds[i]));
+
+		ASSERT_TRUE(index.Validate());
+		ASSERT_EQ(index.GetProxyCount(), 2000);
+
+		// Moves, most of them small enough to stay inside the grown boxes
+		std::uniform_real_distribution<float> offset(-0.5f, 0.5f);
+		for (size_t i = 0; i < scene.Entities.size(); i += 2)
+		{
+			const glm::vec3 delta = i % 10 == 0 ? glm::vec3(50.0f, 0.0f, 0.0f) : glm::vec3(offset(random), offset(random), offset(random));
+			scene.Bounds[i] = AABB(scene.Bounds[i].Min + delta, scene.Bounds[i].Max + delta);
+			index.Update(proxies[i], scene.Bounds[i]);
+		}
+
+		for (size_t i = 1; i < scene.Entities.size(); i += 3)
+		{
+			index.Remove(proxies[i]);
+			alive[i] = false;
+		}
+
+		ASSERT_TRUE(index.Validate());
+
+		for (uint32_t query = 0; query < 20; query++)
+		{
+			const AABB box = AABB::Union(RandomBox(random), RandomBox(random));
+			std::vector<entt::entity> results;
+			index.Query(box, results);
+			ASSERT_EQ(Sorted(results), BruteForce(scene, alive, [&](const AABB& bounds) { return box.Overlaps(bounds); }));
+
+			const Sphere sphere(RandomBox(random).Min, 30.0f);
+			results.clear();
+			index.Query(sphere, results);
+			ASSERT_EQ(Sorted(results), BruteForce(scene, alive, [&](const AABB& bounds) { return sphere.Overlaps(bounds); }));
+		}
+
+		const glm::mat4 viewProjection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 150.0f)
+			* glm::lookAt(glm::vec3(-120.0f, 10.0f, 5.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+		const Frustum frustum(viewProjection);
+
+		std::vector<entt::entity> visible;
+		index.Query(frustum, visible);
+		ASSERT_FALSE(visible.empty());
+		ASSERT_EQ(Sorted(visible), BruteForce(scene, alive, [&](const AABB& bounds) { return frustum.Classify(bounds) != Containment::Outside; }));
+	}
+
+	TEST(SpatialIndexTest, Raycast)
+	{
+		SpatialIndex index;
+		for (uint32_t i = 0; i < 10; i++)
+		{
+			const glm::vec3 center(static_cast<float>(i) * 5.0f, 0.0f, 0.0f);
+			index.Insert(static_cast<entt::entity>(i), AABB(center - glm::vec3(1.0f), center + glm::vec3(1.0f)));
+		}
+
+		// Off to the side of every box
+		index.Insert(static_cast<entt::entity>(10), AABB(glm::vec3(0.0f, 10.0f, 0.0f), glm::vec3(1.0f, 11.0f, 1.0f)));
+
+		std::vector<RaycastHit> hits;
+		index.Raycast(Ray(glm::vec3(100.0f, 0.0f, 0.0f), glm::vec3(-1.0f, 0.0f, 0.0f)), 1000.0f, hits);
+
+		ASSERT_EQ(hits.size(), 10);
+		for (uint32_t i = 0; i < 10; i++)
+			ASSERT_EQ(hits[i].Entity, static_cast<entt::entity>(9 - i));
+		ASSERT_FLOAT_EQ(hits[0].Distance, 54.0f);
+
+		// Limited to the first three boxes
+		hits.clear();
+		index.Raycast(Ray(glm::vec3(100.0f, 0.0f, 0.0f), glm::vec3(-1.0f, 0.0f, 0.0f)), 65.0f, hits);
+		ASSERT_EQ(hits.size(), 3);
+	}
+
+	TEST(SpatialIndexTest, Build)
+	{
+		std::mt19937 random(7);
+		const TestScene scene = CreateTestScene(random, 10000);
+		const std::vector<bool> alive(scene.Entities.size(), true);
+
+		SpatialIndex index;
+		std::vector<SpatialProxy> proxies;
+		index.Build(scene.Entities, scene.Bounds, proxies);
+
+		ASSERT_TRUE(index.Validate());
+		ASSERT_EQ(index.GetProxyCount(), 10000);
+		// Median splits keep the tree as shallow as it gets
+		ASSERT_LE(index.GetHeight(), 14);
+
+		for (size_t i = 0; i < proxies.size(); i++)
+			ASSERT_EQ(index.GetEntity(proxies[i]), scene.Entities[i]);
+
+		// Incremental changes on top of a built tree keep it balanced
+		for (size_t i = 0; i < proxies.size(); i += 4)
+			index.Update(proxies[i], RandomBox(random));
+
+		ASSERT_TRUE(index.Validate());
+		ASSERT_LE(index.GetHeight(), 28);
+
+		ThreadPool threadPool(4);
+
+		std::vector<Sphere> spheres;
+		for (uint32_t i = 0; i < 64; i++)
+			spheres.emplace_back(RandomBox(random).Min, 20.0f);
+
+		std::vector<std::vector<entt::entity>> batch;
+		index.QueryBatch(spheres, batch, threadPool);
+
+		ASSERT_EQ(batch.size(), spheres.size());
+		for (size_t i = 0; i < spheres.size(); i++)
+		{
+			std::vector<entt::entity> results;
+			index.Query(spheres[i], results);
+			ASSERT_EQ(Sorted(batch[i]), Sorted(results));
+		}
+	}
+}
@@ -0,0 +1,64 @@
+#include "Test.h"
+
+#include "Scene/SystemScheduler.h"
+
+namespace Eppo
+{
+	namespace
+	{
+		struct Position { float Value = 0.0f; };
+		struct Velocity { float Value = 0.0f; };
+	}
+
+	TEST(SystemSchedulerTest, Conflicts)
+	{
+		const SystemAccess move = SystemAccess().Read<Velocity>().Write<Position>();
+		const SystemAccess readPosition = SystemAccess().Read<Position>();
+		const SystemAccess readVelocity = SystemAccess().Read<Velocity>();
+
+		ASSERT_TRUE(move.ConflictsWith(readPosition));
+		ASSERT_TRUE(readPosition.ConflictsWith(move));
+		ASSERT_FALSE(move.ConflictsWith(readVelocity));
+		ASSERT_FALSE(readPosition.ConflictsWith(readVelocity));
+		ASSERT_TRUE(SystemAccess().Exclusive().ConflictsWith(readVelocity));
+	}
+
+	TEST(SystemSchedulerTest, Run)
+	{
+		ThreadPool threadPool(4);
+
+		entt::registry registry;
+		for (uint32_t i = 0; i < 10000; i++)
+		{
+			const entt::entity entity = registry.create();
+			registry.emplace<Position>(entity);
+			registry.emplace<Velocity>(entity, 2.0f);
+		}
+
+		SystemScheduler scheduler;
+		scheduler.AddSystem("Move", SystemAccess().Read<Velocity>().Write<Position>(), [&](const float timestep)
+		{
+			const auto view = registry.view<Position, Velocity>();
+			SystemScheduler::ParallelEach(view, [&view, timestep](const entt::entity entity)
+			{
+				auto [position, velocity] = view.get<Position, Velocity>(entity);
+				position.Value += velocity.Value * timestep;
+			}, threadPool, 256);
+		});
+
+		// Runs after Move, it reads what Move writes
+		float sum = 0.0f;
+		scheduler.AddSystem("Sum", SystemAccess().Read<Position>(), [&](const float)
+		{
+			sum = 0.0f;
+			for (const auto entity : registry.view<Position>())
+				sum += registry.get<Position>(entity).Value;
+		});
+
+		scheduler.Run(0.5f, threadPool);
+		ASSERT_FLOAT_EQ(sum, 10000.0f);
+
+		scheduler.Run(0.5f, threadPool);
+		ASSERT_FLOAT_EQ(sum, 20000.0f);
+	}
+}
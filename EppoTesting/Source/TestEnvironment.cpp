@@ -0,0 +1,25 @@
+#include "Test.h"
+
+namespace Eppo
+{
+	namespace
+	{
+		// Engine wide systems the code under test logs to and runs jobs on
+		class EngineEnvironment : public testing::Environment
+		{
+		public:
+			void SetUp() override
+			{
+				Log::Init();
+				ThreadPool::Init();
+			}
+
+			void TearDown() override
+			{
+				ThreadPool::Shutdown();
+			}
+		};
+
+		[[maybe_unused]] testing::Environment* const s_EngineEnvironment = testing::AddGlobalTestEnvironment(new EngineEnvironment);
+	}
+}
@@ -0,0 +1,126 @@
+import argparse
+import json
+import os
+import sys
+
+# Compares a Google Benchmark JSON result (--benchmark_out=<file> --benchmark_out_format=json) against a baseline
+defaultBaseline = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "EppoMicrobenchmark", "Baselines", "Baseline.json")
+
+recordCommand = "EppoMicrobenchmark --benchmark_repetitions=5 --benchmark_report_aggregates_only=true --benchmark_out=EppoMicrobenchmark/Baselines/Baseline.json --benchmark_out_format=json"
+
+def LoadResults(filepath):
+    with open(filepath, "r") as f:
+        data = json.load(f)
+
+    benchmarks = {}
+    medians = {}
+    for benchmark in data["benchmarks"]:
+        # With repetitions the median is compared, it is the least affected by noise
+        if benchmark.get("run_type", "iteration") == "aggregate":
+            if benchmark.get("aggregate_name") == "median":
+                medians[benchmark["run_name"]] = benchmark
+            continue
+        benchmarks[benchmark["name"]] = benchmark
+
+    benchmarks.update(medians)
+    return data.get("context", {}), benchmarks
+
+def DescribeContext(context):
+    return f"{context.get('host_name', '?')}, {context.get('num_cpus', '?')} CPUs at {context.get('mhz_per_cpu', '?')} MHz, {context.get('eppo_configuration', '?')} engine, {context.get('library_build_type', '?')} Google Benchmark {context.get('library_version', '')}".rstrip()
+
+# Timings of a debug build, or from other hardware, say nothing about a regression
+def CheckContexts(baselineContext, currentContext, allowDebug):
+    valid = True
+
+    for label, context in (("Baseline", baselineContext), ("Current run", currentContext)):
+        print(f"{label}: {DescribeContext(context)}")
+
+        # Runs from before the engine configuration was recorded only have the library build type
+        configuration = context.get("eppo_configuration")
+        if configuration is None:
+            if context.get("library_build_type") == "debug" and not allowDebug:
+                print(f"{label} comes from a debug build of Google Benchmark, use a release build")
+                valid = False
+        elif configuration == "Debug" and not allowDebug:
+            print(f"{label} comes from a debug build of the engine, use the Release configuration")
+            valid = False
+        elif context.get("library_build_type") == "debug":
+            print(f"Warning: {label.lower()} uses a debug build of Google Benchmark, which adds a little to every iteration")
+
+    if baselineContext.get("eppo_configuration") != currentContext.get("eppo_configuration"):
+        print("The runs come from different engine configurations")
+        valid = False
+
+    if baselineContext.get("num_cpus") != currentContext.get("num_cpus") or baselineContext.get("host_name") != currentContext.get("host_name"):
+        print("Warning: the runs come from different machines, re-record the baseline on the reference machine")
+
+    print()
+    return valid
+
+def Main():
+    parser = argparse.ArgumentParser(description="Compare microbenchmark results against a baseline.")
+    parser.add_argument("current", help="Result file of the current run")
+    parser.add_argument("--baseline", default=defaultBaseline, help="Baseline result file")
+    parser.add_argument("--metric", default="cpu_time", choices=["cpu_time", "real_time"], help="Time to compare")
+    parser.add_argument("--threshold", type=float, default=10.0, help="Allowed slowdown in percent before failing")
+    parser.add_argument("--allow-debug", action="store_true", help="Compare results of debug builds of Google Benchmark")
+    parser.add_argument("--allow-new", action="store_true", help="Do not fail on benchmarks the baseline does not have")
+    args = parser.parse_args()
+
+    if not os.path.exists(args.baseline):
+        print(f"No baseline at {args.baseline}, record one from a release build on the reference machine with:")
+        print(f"  {recordCommand}")
+        return 2
+
+    baselineContext, baseline = LoadResults(args.baseline)
+    currentContext, current = LoadResults(args.current)
+
+    if not CheckContexts(baselineContext, currentContext, args.allow_debug):
+        return 2
+
+    regressions = 0
+    uncovered = 0
+    nameWidth = max([len(name) for name in current] + [9])
+
+    print(f"{'Benchmark':<{nameWidth}} {'Baseline':>14} {'Current':>14} {'Change':>9}")
+    for name, benchmark in current.items():
+        if name not in baseline:
+            print(f"{name:<{nameWidth}} {'-':>14} {benchmark[args.metric]:>11.1f} {benchmark['time_unit']:>2} {'new':>9}")
+            uncovered += 1
+            continue
+
+        # Both files should use the same unit, but convert to be safe
+        units = { "ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9 }
+        baselineTime = baseline[name][args.metric] * units[baseline[name]["time_unit"]]
+        currentTime = benchmark[args.metric] * units[benchmark["time_unit"]]
+
+        change = (currentTime - baselineTime) / baselineTime * 100.0 if baselineTime > 0.0 else 0.0
+        marker = ""
+        if change > args.threshold:
+            marker = " REGRESSION"
+            regressions += 1
+
+        print(f"{name:<{nameWidth}} {baselineTime:>11.1f} ns {currentTime:>11.1f} ns {change:>+8.1f}%{marker}")
+
+    for name in baseline:
+        if name not in current:
+            print(f"{name:<{nameWidth}} missing from the current run")
+
+    failed = False
+    if regressions > 0:
+        print(f"\n{regressions} benchmark(s) regressed more than {args.threshold}%")
+        failed = True
+
+    # Benchmarks without a baseline are not covered by the gate at all
+    if uncovered > 0 and not args.allow_new:
+        print(f"\n{uncovered} benchmark(s) are not in the baseline, re-record it with:\n  {recordCommand}")
+        failed = True
+
+    if failed:
+        return 1
+
+    print("\nNo regressions")
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(Main())
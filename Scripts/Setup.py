@@ -14,6 +14,12 @@ premakeInstalled = PremakeRequirements.Validate()
 print("\nUpdating submodules...")
 subprocess.call(["git", "submodule", "update", "--init", "--recursive"])
 
+# Google Benchmark has no premake fork, its premake file lives next to the sources
+googleBenchmarkDirectory = "./EppoEngine/Vendor/googlebenchmark/benchmark"
+if (not os.path.exists(googleBenchmarkDirectory)):
+    print("\nCloning Google Benchmark...")
+    subprocess.call(["git", "clone", "--depth", "1", "--branch", "v1.8.3", "https://github.com/google/benchmark.git", googleBenchmarkDirectory])
+
 if (premakeInstalled):
     print("\nRunning premake...")
     if platform.system() == "Windows":
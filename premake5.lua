@@ -19,6 +19,7 @@ workspace "EppoEngine"
     OutputDir = "%{cfg.buildcfg}-%{cfg.system}-%{cfg.architecture}"
 
     group "Dependencies"
+        include "EppoEngine/Vendor/googlebenchmark"
         include "EppoEngine/Vendor/googletest"
         include "EppoEngine/Vendor/glfw"
         include "EppoEngine/Vendor/imgui"
@@ -32,6 +33,8 @@ workspace "EppoEngine"
     group ""
 
     group "Tools"
+        include "EppoBenchmark"
         include "EppoEditor"
+        include "EppoMicrobenchmark"
         include "EppoTesting"
     group ""